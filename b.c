@@ -6,15 +6,143 @@
  * @author Jacob Smith
  */
 
+// Direct I/O
+#ifdef B_TREE_DIRECT_IO
+    #define _GNU_SOURCE
+#endif
+
 // Header
 #include <tree/b.h>
 
+// io_uring
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #define B_TREE_IO_URING
+        #include <linux/io_uring.h>
+        #include <sys/mman.h>
+        #include <sys/syscall.h>
+    #endif
+#endif
+
+// Structure definitions
+struct b_tree_frame_s
+{
+    b_tree_node        *p_b_tree_node;
+    unsigned long long  node_pointer;
+    size_t              next,
+                        pins;
+    bool                referenced,
+                        dirty,
+                        loading;
+};
+
+struct b_tree_pool_s
+{
+    pthread_mutex_t        _lock;
+    pthread_cond_t         _loaded;
+    struct b_tree_frame_s *p_frames;
+    size_t                *p_buckets;
+    char                  *p_nodes;
+    size_t                 quantity,
+                           used,
+                           hand,
+                           bucket_mask,
+                           frame_size;
+    unsigned long long     hits,
+                           misses;
+};
+
+struct b_tree_async_operation_s
+{
+    struct b_tree_async_operation_s *p_next;
+    const void                      *p_key,
+                                    *p_value;
+    fn_b_tree_complete              *pfn_complete;
+    void                            *p_context;
+    int                              result;
+    bool                             insert,
+                                     waiting;
+};
+
+struct b_tree_async_read_s
+{
+    struct b_tree_async_read_s      *p_next;
+    struct b_tree_async_operation_s *p_waiting;
+    char                            *p_page;
+    unsigned long long               node_pointer;
+    size_t                           frame_index;
+    ssize_t                          result;
+};
+
+struct b_tree_async_s
+{
+    pthread_mutex_t                  _lock;
+    struct b_tree_async_operation_s *p_ready,
+                                    *p_blocked,
+                                    *p_done;
+    struct b_tree_async_read_s      *p_queued;
+    size_t                           operations,
+                                     reads,
+                                     inserts;
+    int                              ring;
+    unsigned                         entries,
+                                     in_flight,
+                                     unsubmitted,
+                                    *p_sq_head,
+                                    *p_sq_tail,
+                                    *p_sq_mask,
+                                    *p_sq_array,
+                                    *p_cq_head,
+                                    *p_cq_tail,
+                                    *p_cq_mask;
+    void                            *p_sq_ring,
+                                    *p_cq_ring,
+                                    *p_sqes,
+                                    *p_cqes;
+    size_t                           sq_ring_size,
+                                     cq_ring_size,
+                                     sqes_size;
+};
+
+struct b_tree_bulk_level_s
+{
+    b_tree_node        *p_current,
+                       *p_pending;
+    unsigned long long *p_pending_slot;
+    int                 children;
+};
+
+struct b_tree_bulk_s
+{
+    struct b_tree_bulk_level_s *p_levels;
+    size_t                      level_quantity;
+    unsigned long long          node_pointer,
+                                root_address;
+    int                         fill,
+                                height;
+};
+
+// Type definitions
+typedef struct b_tree_frame_s           b_tree_frame;
+typedef struct b_tree_pool_s            b_tree_pool;
+typedef struct b_tree_async_operation_s b_tree_async_operation;
+typedef struct b_tree_async_read_s      b_tree_async_read;
+typedef struct b_tree_async_s           b_tree_async;
+typedef struct b_tree_bulk_level_s      b_tree_bulk_level;
+typedef struct b_tree_bulk_s            b_tree_bulk;
+
+// Preprocessor definitions
+#define B_TREE_PAGE_SIZE(degree) ( ( 2 * sizeof(int) ) + ( ( ( 4 * (size_t) (degree) ) - 1 ) * sizeof(unsigned long long) ) )
+
+// Static data
+static const unsigned long long eight_bytes_of_f = 0xffffffffffffffff;
+
 // Function declarations
 /** !
  * Allocate a node for a specific b tree, and set the node pointer. 
  * 
- * The node pointer is an integer ordinal that is atomically incremented 
- * each time the allocator is called. 
+ * The node pointer is an integer ordinal that is incremented each time the 
+ * allocator is called. The node is pinned in the buffer pool.
  * 
  * @param p_b_tree       the b tree to allocate a node to
  * @param pp_b_tree_node return
@@ -24,15 +152,285 @@
 int b_tree_node_allocate ( b_tree *p_b_tree, b_tree_node **pp_b_tree_node );
 
 /** !
- * Construct a b tree node
+ * Construct a buffer pool for a b tree
+ * 
+ * @param p_b_tree  the b tree
+ * @param pool_size the size of the buffer pool in megabytes IF not zero ELSE B_TREE_POOL_SIZE
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_pool_construct ( b_tree *const p_b_tree, size_t pool_size );
+
+/** !
+ * Find a node in a b tree's buffer pool, evicting another node to make room 
+ * for it if it is not there, and pin its frame. A claimed frame is loading, 
+ * and other threads wait for it, until the caller calls b_tree_pool_loaded
+ * 
+ * @param p_b_tree      the b tree
+ * @param node_pointer  the node pointer
+ * @param read          true if the node is read from the random access file else false for a new node
+ * @param wait          true to wait for a node that another thread is reading else false
+ * @param p_frame_index return
+ * 
+ * @return 1 IF the node is in the buffer pool, 2 IF the caller must fill the claimed frame, 3 IF another thread is reading the node and wait is false, 0 on error
+ */
+int b_tree_pool_claim ( const b_tree *const p_b_tree, unsigned long long node_pointer, bool read, bool wait, size_t *const p_frame_index );
+
+/** !
+ * Finish filling a claimed frame, and wake the threads that wait for it
+ * 
+ * @param p_b_tree    the b tree
+ * @param frame_index the frame
+ * @param loaded      true IF the node was filled ELSE false to release the frame
+ * @param unpin       true to drop the pin of the claim else false to keep it
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_pool_loaded ( const b_tree *const p_b_tree, size_t frame_index, bool loaded, bool unpin );
+
+/** !
+ * Find a node in a b tree's buffer pool, evicting another node to make room 
+ * for it if it is not there, and pin it. 
  * 
- * @param pp_b_tree_node result
  * @param p_b_tree       the b tree
- * @param on_disk        true if node is on disk else false
+ * @param node_pointer   the node pointer
+ * @param read           true if the node is read from the random access file else false for a new node
+ * @param pp_b_tree_node return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_pool_pin ( const b_tree *const p_b_tree, unsigned long long node_pointer, bool read, b_tree_node **pp_b_tree_node );
+
+/** !
+ * Unpin a node, so the buffer pool may evict it
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_node the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_node_unpin ( const b_tree *const p_b_tree, b_tree_node *const p_b_tree_node );
+
+/** !
+ * Release a buffer pool. Changed nodes are not written 
+ * 
+ * @param p_b_tree_pool the buffer pool
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_pool_destroy ( b_tree_pool *p_b_tree_pool );
+
+/** !
+ * Allocate a buffer for one page, aligned for direct I/O. Release it with free
+ * 
+ * @param p_b_tree the b tree
+ * 
+ * @return pointer to the buffer on success, null pointer on error
+ */
+char *b_tree_page_allocate ( const b_tree *const p_b_tree );
+
+/** !
+ * Read a node's page from the random access file
+ * 
+ * @param p_b_tree      the b tree
+ * @param node_pointer  the node pointer
+ * @param p_b_tree_node return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_page_read ( const b_tree *const p_b_tree, unsigned long long node_pointer, b_tree_node *const p_b_tree_node );
+
+/** !
+ * Parse a node from a page that was read from the random access file
+ * 
+ * @param p_b_tree      the b tree
+ * @param node_pointer  the node pointer
+ * @param p_page        the page
+ * @param p_b_tree_node return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_page_parse ( const b_tree *const p_b_tree, unsigned long long node_pointer, const char *const p_page, b_tree_node *const p_b_tree_node );
+
+/** !
+ * Write a node's page to the random access file
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_node the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_page_write ( const b_tree *const p_b_tree, const b_tree_node *const p_b_tree_node );
+
+/** !
+ * Construct the state of a b tree's asynchronous operations. Pages are read 
+ * with io_uring IF the kernel allows it ELSE with the poll fallback
+ * 
+ * @param p_b_tree the b tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_construct ( b_tree *const p_b_tree );
+
+#ifdef B_TREE_IO_URING
+/** !
+ * Construct an io_uring, and map its rings
+ * 
+ * @param p_b_tree_async the async state
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_ring_construct ( b_tree_async *const p_b_tree_async );
+#endif
+
+/** !
+ * Queue a page read. The read goes to the ring IF it has room ELSE it waits 
+ * for the next poll. Call with the async lock held
+ * 
+ * @param p_b_tree the b tree
+ * @param p_read   the read
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_read_queue ( const b_tree *const p_b_tree, b_tree_async_read *const p_read );
+
+/** !
+ * Fill a frame from a completed page read, resume the operations that waited
+ * for it, and release the read. Call with the async lock held
+ * 
+ * @param p_b_tree the b tree
+ * @param p_read   the read
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_read_finish ( const b_tree *const p_b_tree, b_tree_async_read *p_read );
+
+/** !
+ * Start the queued page reads, and finish the page reads that completed. Call
+ * with the async lock held. The lock is released while pages are read with 
+ * the poll fallback, or while the ring is waited on
+ * 
+ * @param p_b_tree the b tree
+ * @param wait     true to wait for a read IF reads are in flight and none completed else false
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_reap ( const b_tree *const p_b_tree, bool wait );
+
+/** !
+ * Finish the async reads of a b tree for a thread that needs a frame that is 
+ * being read. An async read only runs when the b tree is polled, so a thread 
+ * that waits on the frame of a queued read may wait forever. Call without the
+ * async lock
+ * 
+ * @param p_b_tree the b tree
+ * @param p_wait   return true IF no async reads are outstanding, so a thread 
+ *                 that reads the page with pread fills the frame, ELSE false
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_help ( const b_tree *const p_b_tree, bool *const p_wait );
+
+/** !
+ * Run an asynchronous operation from the root, until it completes, or until 
+ * it needs a page that is not in the buffer pool. Call with the async lock held
+ * 
+ * @param p_b_tree    the b tree
+ * @param p_operation the operation
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_step ( b_tree *const p_b_tree, b_tree_async_operation *const p_operation );
+
+/** !
+ * Submit an asynchronous search or insert
+ * 
+ * @param p_b_tree     the b tree
+ * @param p_key        the key IF search ELSE the property
+ * @param pfn_complete called when the operation completes IF not null
+ * @param p_context    passed to pfn_complete
+ * @param insert       true for an insert else false for a search
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_submit ( b_tree *const p_b_tree, const void *const p_key, fn_b_tree_complete *pfn_complete, void *p_context, bool insert );
+
+/** !
+ * Complete each outstanding asynchronous operation, and release the state of
+ * a b tree's asynchronous operations
+ * 
+ * @param p_b_tree the b tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_async_destroy ( b_tree *const p_b_tree );
+
+/** !
+ * Allocate a node for a bulk load, outside of the buffer pool. Release it 
+ * with TREE_REALLOC
+ * 
+ * @param p_b_tree the b tree
+ * @param leaf     true for a leaf else false
+ * 
+ * @return pointer to the node on success, null pointer on error
+ */
+b_tree_node *b_tree_bulk_node_allocate ( const b_tree *const p_b_tree, bool leaf );
+
+/** !
+ * Add a level above the top level of a bulk load
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_bulk the bulk load
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_bulk_level_add ( const b_tree *const p_b_tree, b_tree_bulk *const p_b_tree_bulk );
+
+/** !
+ * Write a node of a bulk load to the next page, store its node pointer in 
+ * the slot of its parent, and release it
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_bulk the bulk load
+ * @param p_b_tree_node the node
+ * @param p_slot        return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_bulk_node_write ( const b_tree *const p_b_tree, b_tree_bulk *const p_b_tree_bulk, b_tree_node *p_b_tree_node, unsigned long long *const p_slot );
+
+/** !
+ * Add the next property of a bulk load to the leaves
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_bulk the bulk load
+ * @param p_property    the property
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_bulk_add ( const b_tree *const p_b_tree, b_tree_bulk *const p_b_tree_bulk, const void *const p_property );
+
+/** !
+ * Fill the short last node of a level of a bulk load from the node before it,
+ * or merge the two nodes IF their properties fit in one node
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_bulk the bulk load
+ * @param l             the level
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_bulk_rebalance ( const b_tree *const p_b_tree, b_tree_bulk *const p_b_tree_bulk, size_t l );
+
+/** !
+ * Write the last nodes of each level of a bulk load, from the leaves to the root
+ * 
+ * @param p_b_tree      the b tree
+ * @param p_b_tree_bulk the bulk load
  * 
  * @return 1 on success, 0 on error
  */
-int b_tree_node_construct ( b_tree_node **const pp_b_tree_node, b_tree *const p_b_tree, bool on_disk );
+int b_tree_bulk_finish ( const b_tree *const p_b_tree, b_tree_bulk *const p_b_tree_bulk );
 
 /** !
  * Get the root node of a B tree
@@ -65,7 +463,8 @@ int b_tree_split_root ( b_tree *const p_b_tree );
 int b_tree_split_child ( b_tree *const p_b_tree, b_tree_node *p_b_tree_node, size_t i );
 
 /** !
- * Insert a property into a b tree in the correct location
+ * Insert a property into a b tree in the correct location. The node must be 
+ * pinned, and is unpinned by the call, unless it is the root
  * 
  * @param p_b_tree      the b tree
  * @param p_b_tree_node the b tree node
@@ -94,15 +493,27 @@ int b_tree_write_meta_data ( const b_tree *const p_b_tree );
 int b_tree_read_meta_data ( b_tree *const p_b_tree );
 
 /** !
- * Read a chunk of data from the random access file
+ * Read a node through the buffer pool, and pin it. The caller unpins the node
+ * with b_tree_node_unpin
  * 
  * @param p_b_tree       pointer to B tree
- * @param disk_address   pointer to data on disk
+ * @param disk_address   the node pointer
  * @param pp_b_tree_node return
  * 
  * @return 1 on success, 0 on error
 */
-int b_tree_disk_read ( b_tree *p_b_tree, unsigned long long disk_address, b_tree_node **pp_b_tree_node );
+int b_tree_disk_read ( const b_tree *const p_b_tree, unsigned long long disk_address, b_tree_node **pp_b_tree_node );
+
+/** !
+ * Mark a pinned node as changed. The node is written to the random access 
+ * file when it is evicted, or when the B tree is flushed
+ * 
+ * @param p_b_tree      pointer to B tree
+ * @param p_b_tree_node the node
+ * 
+ * @return 1 on success, 0 on error
+*/
+int b_tree_disk_write ( const b_tree *const p_b_tree, b_tree_node *const p_b_tree_node );
 
 /** !
  * Traverse a b tree using the pre order technique
@@ -115,14 +526,38 @@ int b_tree_disk_read ( b_tree *p_b_tree, unsigned long long disk_address, b_tree
 int b_tree_traverse_preorder_node ( b_tree_node *p_b_tree_node, fn_b_tree_traverse *pfn_traverse );
 
 /** !
- * Traverse a b tree using the in order technique
+ * Traverse a b tree using the in order technique. Each child is read 
+ * through the buffer pool, and unpinned after it is traversed
  * 
+ * @param p_b_tree      pointer to b tree
  * @param p_b_tree_node pointer to b tree node
- * @param pfn_traverse  called for each node in the binary tree
+ * @param pfn_traverse  called for each property in the b tree
+ * 
+ * @return 1 on success, 0 on error
+*/
+int b_tree_traverse_inorder_node ( const b_tree *const p_b_tree, b_tree_node *p_b_tree_node, fn_b_tree_traverse *pfn_traverse );
+
+/** !
+ * Pin the leaf of a b tree cursor. A leaf that was read ahead is taken
+ * from the buffer pool, finishing its read IF it is in flight
+ * 
+ * @param p_b_tree_cursor pointer to b tree cursor
+ * @param node_pointer    the leaf
  * 
  * @return 1 on success, 0 on error
 */
-int b_tree_traverse_inorder_node ( b_tree_node *p_b_tree_node, fn_b_tree_traverse *pfn_traverse );
+int b_tree_cursor_leaf ( b_tree_cursor *const p_b_tree_cursor, unsigned long long node_pointer );
+
+/** !
+ * Read the leaves after the leaf of a b tree cursor, before the cursor 
+ * reaches them. With io_uring, up to B_TREE_READ_AHEAD leaves are queued 
+ * on the ring of the b tree. Else, the kernel is advised of the next leaf
+ * 
+ * @param p_b_tree_cursor pointer to b tree cursor
+ * 
+ * @return 1 on success, 0 on error
+*/
+int b_tree_cursor_read_ahead ( b_tree_cursor *const p_b_tree_cursor );
 
 /** !
  * Traverse a b tree using the post order technique
@@ -146,54 +581,6 @@ int b_tree_traverse_postorder_node ( b_tree_node *p_b_tree_node, fn_b_tree_trave
 size_t load_file ( const char *path, void *buffer, bool binary_mode );
 
 // Function definitions
-int b_tree_node_create ( b_tree_node **const pp_b_tree_node )
-{
-    
-    // Argument check
-    if ( pp_b_tree_node == (void *) 0 ) goto no_b_tree_node;
-
-    // Initialized data
-    b_tree_node *p_b_tree_node = TREE_REALLOC(0, sizeof(b_tree_node));
-
-    // Error check
-    if ( p_b_tree_node == (void *) 0 ) goto no_mem;
-
-    // Zero set the struct
-    memset(p_b_tree_node, 0, sizeof(b_tree));
-
-    // Return a pointer to the caller
-    *pp_b_tree_node = p_b_tree_node;
-
-    // Success
-    return 1;
-
-    // Error handling
-    {
-        
-        // Argument errors
-        {
-            no_b_tree_node:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"pp_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-        }
-
-        // Standard library errors
-        {
-            no_mem:
-                #ifndef NDEBUG
-                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-        }
-    }
-}
-
 int b_tree_create ( b_tree **const pp_b_tree )
 {
     
@@ -242,81 +629,117 @@ int b_tree_create ( b_tree **const pp_b_tree )
     }
 }
 
-int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree_equal *pfn_is_equal, int degree, unsigned long long node_size )
+int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree_equal *pfn_is_equal, int degree, unsigned long long node_size, size_t pool_size )
+{
+
+    // Construct a b tree with the default flags
+    return b_tree_construct_with_flags(pp_b_tree, path, pfn_is_equal, degree, node_size, pool_size, B_TREE_FLAG_NONE);
+}
+
+int b_tree_construct_with_flags ( b_tree **const pp_b_tree, const char *const path, fn_tree_equal *pfn_is_equal, int degree, unsigned long long node_size, size_t pool_size, int flags )
 {
 
     // Argument check
     if ( pp_b_tree == (void *) 0 ) goto no_b_tree;
+    if ( path      == (void *) 0 ) goto no_path;
     if ( degree    <           2 ) goto no_degree;
-    if ( pp_b_tree == (void *) 0 ) goto no_node_size;
+    if ( node_size < B_TREE_PAGE_SIZE(degree) ) goto no_node_size;
+
+    #ifdef B_TREE_DIRECT_IO
+
+        // Direct I/O transfers whole, aligned pages
+        if ( node_size % B_TREE_PAGE_ALIGNMENT ) goto no_node_size;
+    #endif
 
     // Initialized data
     b_tree *p_b_tree = (void *) 0;
     bool  file_exists = load_file(path, 0, true);
-    FILE *p_random_access_file = (void *) 0;
+    int   open_flags = O_RDWR | ( ( file_exists ) ? 0 : O_CREAT | O_TRUNC ),
+          random_access_file = -1;
 
-    // File does not exist
-    if ( file_exists == false )
-        
-        // Create the file
-        p_random_access_file = fopen(path, "w+");
+    #ifdef B_TREE_DIRECT_IO
 
-    // File exists
-    else 
+        // Bypass the page cache
+        random_access_file = open(path, open_flags | O_DIRECT, 0644);
 
-        // Load the file
-        p_random_access_file = fopen(path, "rw");
+        // Fall back to buffered I/O IF the file system does not support direct I/O
+        if ( random_access_file == -1 && errno == EINVAL )
+    #endif
+
+        // Open the file
+        random_access_file = open(path, open_flags, 0644);
 
     // Error check
-    if ( p_random_access_file == (void *) 0 ) goto failed_to_get_random_access_file;
+    if ( random_access_file == -1 ) goto failed_to_get_random_access_file;
 
     // Allocate a b tree
     if ( b_tree_create(&p_b_tree) == 0 ) goto failed_to_allocate_b_tree;
-    
+
     // Populate the struct
     *p_b_tree = (b_tree)
     {
-        .p_random_access = p_random_access_file,
+        .random_access = random_access_file,
         .p_root = 0,
-        .functions = 
+        .p_pool = 0,
+        .p_async = 0,
+        .functions =
         {
             .pfn_is_equal       = 0,
             .pfn_serialize_node = 0,
             .pfn_parse_node     = 0
         },
-        ._metadata = (b_tree_metadata) 
+        ._metadata = (b_tree_metadata)
         {
             .node_quantity     = 1,
-            .node_size         = node_size,
+            .node_size         = (int) node_size,
             .key_quantity      = 0,
             .degree            = degree,
             .height            = 0,
+            .flags             = flags,
             .next_disk_address = sizeof(b_tree_metadata)
         }
     };
-    
+
+    // Construct the lock
+    if ( pthread_rwlock_init(&p_b_tree->_rwlock, (void *) 0) != 0 ) goto failed_to_create_lock;
+
     // Read the metadata from the file
     if ( file_exists )
     {
 
         // Read the metadata
-        b_tree_read_meta_data(p_b_tree);
+        if ( b_tree_read_meta_data(p_b_tree) == 0 ) goto failed_to_read_meta_data;
 
-        // Load the root of the B tree
-        b_tree_disk_read(p_b_tree, p_b_tree->_metadata.root_address, &p_b_tree->p_root);
+        // Error check
+        if ( node_size < B_TREE_PAGE_SIZE(p_b_tree->_metadata.degree) ) goto no_node_size;
+
+        // Construct the buffer pool
+        if ( b_tree_pool_construct(p_b_tree, pool_size) == 0 ) goto failed_to_construct_pool;
+
+        // Load the root of the B tree. The root stays pinned
+        if ( b_tree_disk_read(p_b_tree, p_b_tree->_metadata.root_address, &p_b_tree->p_root) == 0 ) goto failed_to_read_node;
     }
 
     // Populate B tree metadata. Write root
     else
     {
 
+        // Construct the buffer pool
+        if ( b_tree_pool_construct(p_b_tree, pool_size) == 0 ) goto failed_to_construct_pool;
+
+        // Allocate the root node. The root stays pinned
+        if ( b_tree_node_allocate(p_b_tree, &p_b_tree->p_root) == 0 ) goto failed_to_allocate_node;
+
+        // Store the address of the root node
+        p_b_tree->_metadata.root_address = p_b_tree->p_root->node_pointer;
+
         // Write the b tree metadata
         b_tree_write_meta_data(p_b_tree);
-
-        // Allocate the root node
-        if ( b_tree_node_construct(&p_b_tree->p_root, p_b_tree, false) == 0 ) goto failed_to_construct_b_tree_node;
     }
 
+    // Construct the state of asynchronous operations
+    if ( b_tree_async_construct(p_b_tree) == 0 ) goto failed_to_construct_async;
+
     // Store the comparator
     p_b_tree->functions.pfn_is_equal = ( pfn_is_equal ) ? pfn_is_equal : tree_compare_function;
 
@@ -339,7 +762,15 @@ int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree
                 // Error
                 return 0;
 
-            no_degree:
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_degree:
                 #ifndef NDEBUG
                     log_error("[tree] [b] Parameter \"degree\" must be greater than or equal to 2 in call to function \"%s\"\n", __FUNCTION__);
                 #endif
@@ -349,7 +780,7 @@ int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree
 
             no_node_size:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Parameter \"node_size\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Parameter \"node_size\" is too small for a node of the b tree in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -374,9 +805,49 @@ int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree
                 // Error
                 return 0;
 
-            failed_to_construct_b_tree_node:
+            failed_to_read_meta_data:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read metadata from random access file \"%s\" in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_create_lock:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to create lock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_pool:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to construct buffer pool in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_async:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to construct async state in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_allocate_node:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Failed to construct b tree node in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -395,11 +866,8 @@ int b_tree_node_allocate ( b_tree *p_b_tree, b_tree_node **pp_b_tree_node )
     // Initialized data
     b_tree_node *p_b_tree_node = (void *) 0;
 
-    // Allocate a node
-    if ( b_tree_node_create(&p_b_tree_node) == 0 ) goto failed_to_allocate_node;
-
-    // Store the node pointer
-    p_b_tree_node->node_pointer = p_b_tree->_metadata.node_quantity;
+    // Pin a frame for the node, without reading it
+    if ( b_tree_pool_pin(p_b_tree, p_b_tree->_metadata.node_quantity, false, &p_b_tree_node) == 0 ) goto failed_to_allocate_node;
 
     // Increment the node quantity
     p_b_tree->_metadata.node_quantity++;
@@ -422,7 +890,7 @@ int b_tree_node_allocate ( b_tree *p_b_tree, b_tree_node **pp_b_tree_node )
 
                 // Error
                 return 0;
-                
+
             no_b_tree_node:
                 #ifndef NDEBUG
                     printf("[tree] [b] Null pointer provided for parameter \"pp_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
@@ -436,7 +904,7 @@ int b_tree_node_allocate ( b_tree *p_b_tree, b_tree_node **pp_b_tree_node )
         {
             failed_to_allocate_node:
                 #ifndef NDEBUG
-                    printf("[tree] [b] Call to function \"b_tree_node_create\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [b] Call to function \"b_tree_pool_pin\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -445,58 +913,93 @@ int b_tree_node_allocate ( b_tree *p_b_tree, b_tree_node **pp_b_tree_node )
     }
 }
 
-int b_tree_node_construct ( b_tree_node **const pp_b_tree_node, b_tree *const p_b_tree, bool on_disk )
+int b_tree_pool_construct ( b_tree *const p_b_tree, size_t pool_size )
 {
 
     // Argument check
-    if ( pp_b_tree_node == (void *) 0 ) goto no_b_tree_node;
-    if ( p_b_tree       == (void *) 0 ) goto no_b_tree;
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
 
     // Initialized data
-    b_tree_node *p_b_tree_node = TREE_REALLOC(0, sizeof(b_tree_node) + ((p_b_tree->_metadata.degree * 2) * sizeof(unsigned long long)));
+    b_tree_pool *p_b_tree_pool   = (void *) 0;
+    size_t       degree          = (size_t) p_b_tree->_metadata.degree,
+                 node_size       = sizeof(b_tree_node) + ( 2 * degree * sizeof(unsigned long long) ),
+                 frame_size      = node_size + ( ( ( 2 * degree ) - 1 ) * sizeof(void *) ),
+                 quantity        = ( ( ( pool_size ) ? pool_size : B_TREE_POOL_SIZE ) * 1024 * 1024 ) / frame_size,
+                 bucket_quantity = 1;
 
-    // Error check
-    if ( p_b_tree_node == (void *) 0 ) goto no_mem;
+    // The buffer pool must hold every node that may be pinned at once
+    if ( quantity < B_TREE_POOL_FRAMES_MIN ) quantity = B_TREE_POOL_FRAMES_MIN;
 
-    // Is a leaf
-    p_b_tree_node->leaf = true;
+    // Use at least as many buckets as frames
+    while ( bucket_quantity < quantity ) bucket_quantity *= 2;
 
-    // Allocate memory for properties
-    p_b_tree_node->properties = TREE_REALLOC(0, sizeof(void *) * ( (p_b_tree->_metadata.degree * 2) - 1 ));
+    // Allocate the buffer pool
+    p_b_tree_pool = TREE_REALLOC(0, sizeof(b_tree_pool));
 
     // Error check
-    if ( p_b_tree_node->properties == (void *) 0 ) goto no_mem;
+    if ( p_b_tree_pool == (void *) 0 ) goto no_mem;
 
-    // Set the location
-    if ( on_disk )
+    // Populate the buffer pool
+    *p_b_tree_pool = (b_tree_pool)
     {
-        
-        // Store the next node address
-        p_b_tree_node->node_pointer = p_b_tree->_metadata.next_disk_address;
+        .p_frames    = TREE_REALLOC(0, quantity * sizeof(b_tree_frame)),
+        .p_buckets   = TREE_REALLOC(0, bucket_quantity * sizeof(size_t)),
+        .p_nodes     = TREE_REALLOC(0, quantity * frame_size),
+        .quantity    = quantity,
+        .used        = 0,
+        .hand        = 0,
+        .bucket_mask = bucket_quantity - 1,
+        .frame_size  = frame_size,
+        .hits        = 0,
+        .misses      = 0
+    };
+
+    // Error check
+    if ( p_b_tree_pool->p_frames  == (void *) 0 ) goto no_mem;
+    if ( p_b_tree_pool->p_buckets == (void *) 0 ) goto no_mem;
+    if ( p_b_tree_pool->p_nodes   == (void *) 0 ) goto no_mem;
+
+    // Construct the lock, and the condition that is signaled when a node is read
+    if ( pthread_mutex_init(&p_b_tree_pool->_lock, (void *) 0) != 0 ) goto failed_to_create_lock;
+    if ( pthread_cond_init(&p_b_tree_pool->_loaded, (void *) 0) != 0 ) goto failed_to_create_condition;
 
-        // Update the next node address
-        p_b_tree->_metadata.next_disk_address = p_b_tree->_metadata.node_size;
+    // Every bucket is empty
+    memset(p_b_tree_pool->p_buckets, 0xff, bucket_quantity * sizeof(size_t));
+
+    // Give each frame a node
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        b_tree_node *p_b_tree_node = (b_tree_node *) &p_b_tree_pool->p_nodes[i * frame_size];
+
+        // The properties follow the child pointers
+        p_b_tree_node->properties = (void **) ( (char *) p_b_tree_node + node_size );
+
+        // Store the frame
+        p_b_tree_pool->p_frames[i] = (b_tree_frame)
+        {
+            .p_b_tree_node = p_b_tree_node,
+            .node_pointer  = eight_bytes_of_f,
+            .next          = SIZE_MAX,
+            .pins          = 0,
+            .referenced    = false,
+            .dirty         = false,
+            .loading       = false
+        };
     }
 
-    // Return a pointer to the caller
-    *pp_b_tree_node = p_b_tree_node;
+    // Store the buffer pool
+    p_b_tree->p_pool = p_b_tree_pool;
 
     // Success
     return 1;
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_b_tree_node:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"pp_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-
             no_b_tree:
                 #ifndef NDEBUG
                     log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
@@ -506,7 +1009,6 @@ int b_tree_node_construct ( b_tree_node **const pp_b_tree_node, b_tree *const p_
                 return 0;
         }
 
-
         // Standard library errors
         {
             no_mem:
@@ -514,358 +1016,399 @@ int b_tree_node_construct ( b_tree_node **const pp_b_tree_node, b_tree *const p_
                     printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-        }
-    }
-}
-
-int b_tree_root ( const b_tree *const p_b_tree, b_tree_node **pp_root_node )
-{
+                // Release the buffer pool
+                if ( p_b_tree_pool )
+                {
 
-    // Argument check
-    if ( p_b_tree     == (void *) 0 ) goto no_b_tree;
-    if ( pp_root_node == (void *) 0 ) goto no_return;
-    
-    // Error check
-    if ( p_b_tree->p_root == (void *) 0 ) goto no_root_node;
+                    // Release the frames, the buckets, and the nodes
+                    p_b_tree_pool->p_frames  = TREE_REALLOC(p_b_tree_pool->p_frames, 0);
+                    p_b_tree_pool->p_buckets = TREE_REALLOC(p_b_tree_pool->p_buckets, 0);
+                    p_b_tree_pool->p_nodes   = TREE_REALLOC(p_b_tree_pool->p_nodes, 0);
 
-    // Return a pointer to the caller
-    *pp_root_node = p_b_tree->p_root;
-    
-    // Success
-    return 1;
+                    // Release the buffer pool
+                    p_b_tree_pool = TREE_REALLOC(p_b_tree_pool, 0);
+                }
 
-    // Error handling
-    {
+                // Error
+                return 0;
 
-        // Argument errors
-        {
-            no_b_tree:
+            failed_to_create_lock:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
-                return 0;
+                // Release the frames, the buckets, and the nodes
+                p_b_tree_pool->p_frames  = TREE_REALLOC(p_b_tree_pool->p_frames, 0);
+                p_b_tree_pool->p_buckets = TREE_REALLOC(p_b_tree_pool->p_buckets, 0);
+                p_b_tree_pool->p_nodes   = TREE_REALLOC(p_b_tree_pool->p_nodes, 0);
 
-            no_return:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"pp_root_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                // Release the buffer pool
+                p_b_tree_pool = TREE_REALLOC(p_b_tree_pool, 0);
 
-                // Error 
+                // Error
                 return 0;
-        }
 
-        // Tree errors
-        {
-            no_root_node:
+            failed_to_create_condition:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Parameter \"p_b_tree\" contains no root node in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to create condition variable in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Release the mutex
+                pthread_mutex_destroy(&p_b_tree_pool->_lock);
+
+                // Release the frames, the buckets, and the nodes
+                p_b_tree_pool->p_frames  = TREE_REALLOC(p_b_tree_pool->p_frames, 0);
+                p_b_tree_pool->p_buckets = TREE_REALLOC(p_b_tree_pool->p_buckets, 0);
+                p_b_tree_pool->p_nodes   = TREE_REALLOC(p_b_tree_pool->p_nodes, 0);
+
+                // Release the buffer pool
+                p_b_tree_pool = TREE_REALLOC(p_b_tree_pool, 0);
+
+                // Error
                 return 0;
         }
     }
 }
 
-int b_tree_split_root ( b_tree *const p_b_tree )
+int b_tree_pool_claim ( const b_tree *const p_b_tree, unsigned long long node_pointer, bool read, bool wait, size_t *const p_frame_index )
 {
 
-    // Argument check
-    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+    // NOTE: This function has undefined behavior if p_b_tree has no buffer
+    //       pool. Check your parameters before you call.
 
     // Initialized data
-    b_tree_node *p_new_root_node = (void *) 0;
+    b_tree_pool  *p_b_tree_pool = p_b_tree->p_pool;
+    b_tree_frame *p_frame       = (void *) 0;
+    size_t       *p_link        = &p_b_tree_pool->p_buckets[node_pointer & p_b_tree_pool->bucket_mask],
+                  i             = SIZE_MAX;
 
-    // Allocate a node
-    if ( b_tree_node_allocate(p_b_tree, &p_new_root_node) == 0 ) goto failed_to_allocate_node;
+    // Lock
+    pthread_mutex_lock(&p_b_tree_pool->_lock);
 
-    // Populate the new root
-    *p_new_root_node = (b_tree_node)
+    search:
+
+    // Look for the node in its bucket
+    for (i = *p_link; i != SIZE_MAX; i = p_frame->next)
     {
-        .leaf = false,
-        .key_quantity = 0,        
-    };
 
-    // Store the pointer to the old root
-    p_new_root_node->_child_pointers[0] = p_b_tree->p_root->node_pointer;
+        // Store the frame
+        p_frame = &p_b_tree_pool->p_frames[i];
 
-    // Update the root node
-    p_b_tree->p_root = p_new_root_node;
+        // Skip other nodes
+        if ( p_frame->node_pointer != node_pointer ) continue;
 
-    // Split the new root node
-    //b_tree_split_child(p_b_tree->p_root, 0);
+        // Another thread is reading the node
+        if ( p_frame->loading )
+        {
 
-    // Update the height
-    p_b_tree->_metadata.height++;
+            // Don't wait
+            if ( wait == false ) goto in_flight;
 
-    // Success
-    return 1;
+            // Wait, and search again in case the read failed
+            pthread_cond_wait(&p_b_tree_pool->_loaded, &p_b_tree_pool->_lock);
 
-    // Error handling
+            // Search again
+            goto search;
+        }
+
+        // Buffer pool hit
+        goto hit;
+    }
+
+    // Use a fresh frame while there are some
+    if ( p_b_tree_pool->used < p_b_tree_pool->quantity )
     {
 
-        // Argument errors
-        {
-            no_b_tree:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+        // Store the frame
+        i = p_b_tree_pool->used++;
+        p_frame = &p_b_tree_pool->p_frames[i];
+    }
 
-                // Error
-                return 0;
-        }
+    // Evict a node
+    else
+    {
 
-        // Tree errors
+        // Initialized data
+        size_t *p_victim_link = (void *) 0;
+
+        // Advance the clock hand past pinned frames, and past recently used
+        // frames, clearing their reference bits as it goes. Two turns of the
+        // clock are enough to find any frame that is not pinned
+        for (size_t j = 0; ; j++)
         {
-            failed_to_allocate_node:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
-                #endif
 
-                // Error
-                return 0;
-        }
-    }
-}
+            // Error check
+            if ( j == 2 * p_b_tree_pool->quantity ) goto pool_exhausted;
 
-int b_tree_split_child ( b_tree *const p_b_tree, b_tree_node *p_b_tree_node, size_t i )
-{
-    
-    // Argument check
-    if ( p_b_tree      == (void *) 0 ) goto no_b_tree;
-    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
+            // Store the frame
+            i       = p_b_tree_pool->hand;
+            p_frame = &p_b_tree_pool->p_frames[i];
 
-    // Initialized data
-    b_tree_node *p_left_node  = (void *) 0,
-                *p_right_node = (void *) 0;
+            // Advance the clock hand
+            p_b_tree_pool->hand = ( i + 1 < p_b_tree_pool->quantity ) ? i + 1 : 0;
 
-    // Read the left node
-    if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_left_node) == 0 ) goto failed_to_read_node; 
+            // Skip pinned frames
+            if ( p_frame->pins ) continue;
 
-    // Construct the right node
-    if ( b_tree_node_allocate(p_b_tree, &p_right_node) == 0 ) goto failed_to_allocate_node;
+            // Found a frame that has not been used since the last pass
+            if ( p_frame->referenced == false ) break;
 
-    // Set the leaf flag
-    p_right_node->leaf = p_left_node->leaf;
+            // Give the frame a second chance
+            p_frame->referenced = false;
+        }
 
-    // Update the quantity of keys
-    p_right_node->key_quantity = p_b_tree->_metadata.degree - 1;
+        // Write the victim back to the random access file. The lock is held,
+        // so no thread reads the victim's page before it is written
+        if ( p_frame->dirty )
+        {
 
-    // Construct the right node
-    for (size_t j = 0; j < p_b_tree->_metadata.degree - 1; j++)
+            // Write the node
+            if ( b_tree_page_write(p_b_tree, p_frame->p_b_tree_node) == 0 ) goto failed_to_write_node;
 
-        // Transfer elements from left node to right node
-        p_right_node->properties[j] = p_left_node->properties[j + p_b_tree->_metadata.degree];
-    
-    // Update pointers
-    if ( p_left_node->leaf == false )
+            // The node is clean
+            p_frame->dirty = false;
+        }
 
-        // Shift pointers
-        for (size_t j = 0; j < p_b_tree->_metadata.degree; j++)
+        // Unlink the frame from its bucket
+        for (p_victim_link = &p_b_tree_pool->p_buckets[p_frame->node_pointer & p_b_tree_pool->bucket_mask]; *p_victim_link != SIZE_MAX; p_victim_link = &p_b_tree_pool->p_frames[*p_victim_link].next)
+        {
 
-            // Move pointers from the left node to the right node
-            p_right_node->_child_pointers[j] = p_left_node->_child_pointers[j + p_b_tree->_metadata.degree];
-    
-    // Update the quantity of keys
-    p_left_node->key_quantity = p_b_tree->_metadata.degree - 1;
-        
-    // Make room for the right node in the parent node
-    for (size_t j = p_left_node->key_quantity; j > i; j--)
+            // Skip other frames
+            if ( *p_victim_link != i ) continue;
 
-        // Shift pointers
-        p_b_tree_node->_child_pointers[j + 1] = p_b_tree_node->_child_pointers[j];
+            // Unlink
+            *p_victim_link = p_frame->next;
 
-    // Insert the right node into the parent node
-    p_b_tree_node->_child_pointers[i + 1] = p_right_node->node_pointer;
+            // Done
+            break;
+        }
+    }
 
-    // Shift keys in the right node
-    for (size_t j = p_b_tree_node->key_quantity; j >= i; j--)
+    // Link the frame into its bucket, pinned. Other threads that look for the
+    // node wait until it is read. A new node must be written
+    p_frame->node_pointer = node_pointer;
+    p_frame->next         = *p_link;
+    p_frame->pins         = 1;
+    p_frame->referenced   = true;
+    p_frame->dirty        = !read;
+    p_frame->loading      = true;
+    *p_link               = i;
 
-        // Shift keys
-        p_b_tree_node->properties[j + 1] = p_b_tree_node->properties[j];
+    // Buffer pool miss
+    if ( read ) p_b_tree_pool->misses++;
 
-    // Insert the median of the left node
-    p_b_tree_node->properties[i] = p_left_node->properties[p_b_tree->_metadata.degree - 1];
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_pool->_lock);
 
-    // Increment the quantity of keys in the parent node
-    p_b_tree_node->key_quantity++;
+    // Return the frame to the caller
+    *p_frame_index = i;
 
-    // Increment the quantity of nodes in the b tree
-    p_b_tree->_metadata.node_quantity++;
+    // The caller fills the frame
+    return 2;
 
-    // Disk write left
-    //
+    hit:
 
-    // Disk write right
-    //
+    // Buffer pool hit
+    p_b_tree_pool->hits++;
 
-    // Disk write parent
-    //
+    // Pin the frame, and mark it as recently used
+    p_frame->pins++;
+    p_frame->referenced = true;
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_pool->_lock);
+
+    // Return the frame to the caller
+    *p_frame_index = i;
 
     // Success
     return 1;
-    
-    // Error handling
-    {
-        
-        // Argument errors
-        {
-            no_b_tree:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
 
-                // Error
-                return 0;
+    in_flight:
 
-            no_b_tree_node:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_pool->_lock);
 
-                // Error
-                return 0;
-        }
+    // The node is being read
+    return 3;
+
+    // Error handling
+    {
 
         // Tree errors
         {
-            failed_to_read_node:
+            pool_exhausted:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Every node in the buffer pool is pinned in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Unlock
+                pthread_mutex_unlock(&p_b_tree_pool->_lock);
+
                 // Error
                 return 0;
-                
-            failed_to_allocate_node:
+
+            failed_to_write_node:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Failed to write b tree node in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Unlock
+                pthread_mutex_unlock(&p_b_tree_pool->_lock);
+
                 // Error
                 return 0;
         }
     }
 }
 
-int b_tree_insert_not_full ( b_tree *p_b_tree, b_tree_node *const p_b_tree_node, const void *const p_property )
+int b_tree_pool_loaded ( const b_tree *const p_b_tree, size_t frame_index, bool loaded, bool unpin )
 {
 
-    // Argument check
-    if ( p_b_tree      == (void *) 0 ) goto no_b_tree;
-    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
-    if ( p_property    == (void *) 0 ) goto no_property;
+    // NOTE: This function has undefined behavior if p_b_tree has no buffer
+    //       pool. Check your parameters before you call.
 
     // Initialized data
-    signed i = p_b_tree_node->key_quantity - 1;
+    b_tree_pool  *p_b_tree_pool = p_b_tree->p_pool;
+    b_tree_frame *p_frame       = &p_b_tree_pool->p_frames[frame_index];
 
-    // Insert into a leaf node
-    if ( p_b_tree_node->leaf )
+    // Lock
+    pthread_mutex_lock(&p_b_tree_pool->_lock);
+
+    // The node is ready
+    if ( loaded )
     {
 
-        // Check for duplicates
-        //
+        // The node is ready
+        p_frame->loading = false;
 
-        // Search for existing key
-        while (i >= 0 && p_b_tree->functions.pfn_is_equal(p_property, p_b_tree_node->properties[i]) > 0 )
+        // Drop the reader's pin
+        if ( unpin ) p_frame->pins--;
+    }
+
+    // Release the frame
+    else
+    {
+
+        // Unlink the frame from its bucket
+        for (size_t *p_link = &p_b_tree_pool->p_buckets[p_frame->node_pointer & p_b_tree_pool->bucket_mask]; *p_link != SIZE_MAX; p_link = &p_b_tree_pool->p_frames[*p_link].next)
         {
-            
-            // Shift properties
-            p_b_tree_node->properties[i + 1] = p_b_tree_node->properties[i];
-            
-            // Decrement i
-            i--;
-        }
 
-        // Store the property
-        p_b_tree_node->properties[i + 1] = p_property;
-        
-        // Increment the quantity of keys
-        p_b_tree_node->key_quantity++;
+            // Skip other frames
+            if ( *p_link != frame_index ) continue;
 
-        // Increment the quantity of properties
-        p_b_tree->_metadata.node_quantity++;
+            // Unlink
+            *p_link = p_frame->next;
 
-        //b_tree_disk_write(p_b_tree, p_b_tree_node);
+            // Done
+            break;
+        }
+
+        // Release the frame
+        p_frame->node_pointer = eight_bytes_of_f;
+        p_frame->pins         = 0;
+        p_frame->referenced   = false;
+        p_frame->dirty        = false;
+        p_frame->loading      = false;
     }
 
-    // Find the child pointer
-    else
+    // Wake threads waiting for the node
+    pthread_cond_broadcast(&p_b_tree_pool->_loaded);
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_pool->_lock);
+
+    // Success
+    return 1;
+}
+
+int b_tree_pool_pin ( const b_tree *const p_b_tree, unsigned long long node_pointer, bool read, b_tree_node **pp_b_tree_node )
+{
+
+    // NOTE: This function has undefined behavior if p_b_tree has no buffer
+    //       pool. Check your parameters before you call.
+
+    // Initialized data
+    b_tree_pool *p_b_tree_pool = p_b_tree->p_pool;
+    b_tree_node *p_b_tree_node = (void *) 0;
+    size_t       i             = SIZE_MAX;
+    bool         wait          = false;
+    int          claimed       = 0;
+
+    // Claim the frame of the node. IF the node is being read, wait for it 
+    // only when no async read could be filling the frame
+    for (;;)
     {
-        
-        // Initialized data
-        b_tree_node *p_child_node = (void *) 0;
 
-        // Check for duplicates
-        //
+        // Claim the frame
+        claimed = b_tree_pool_claim(p_b_tree, node_pointer, read, wait, &i);
 
-        // Shift keys up
-        while (i >= 0 && p_b_tree->functions.pfn_is_equal(p_property, p_b_tree_node->properties[i]) ) i--;
+        // The node is in the buffer pool, or the frame is claimed
+        if ( claimed != 3 ) break;
 
-        b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node);
+        // Finish the async reads
+        b_tree_async_help(p_b_tree, &wait);
+    }
 
-        // Check for duplicates
-        //
+    // Error check
+    if ( claimed == 0 ) goto failed_to_claim_frame;
 
-        // Split?
-        if ( p_child_node->key_quantity == ( (2 * p_b_tree->_metadata.degree) - 1) )
-        {
-            
-            // Split the child node
-            //
+    // Store the node
+    p_b_tree_node = p_b_tree_pool->p_frames[i].p_b_tree_node;
 
-            // Store the child node
-            //
+    // Fill the frame
+    if ( claimed == 2 )
+    {
 
-            // Read the new child
-            // TODO: '>' or '<' ?
-            if ( p_b_tree->functions.pfn_is_equal(p_property, p_b_tree_node->properties[i]) < 0 )
-            {
+        // Read the node. Other threads use the buffer pool while the page is read
+        if ( read )
+        {
 
-                // Increment i
-                i++;
+            // Read the node
+            if ( b_tree_page_read(p_b_tree, node_pointer, p_b_tree_node) == 0 ) goto failed_to_read_node;
+        }
 
-                // Store the new child node
-                //b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node);
-            }
+        // Clear a new node
+        else
+        {
+
+            // A new node is an empty leaf, with no sibling
+            p_b_tree_node->leaf            = true;
+            p_b_tree_node->key_quantity    = 0;
+            p_b_tree_node->node_pointer    = node_pointer;
+            p_b_tree_node->sibling_pointer = 0;
         }
 
-        // Insert the property
-        b_tree_insert_not_full(p_b_tree, p_child_node, p_property);
+        // The node is ready. The caller keeps the pin
+        b_tree_pool_loaded(p_b_tree, i, true, false);
     }
 
+    // Return a pointer to the caller
+    *pp_b_tree_node = p_b_tree_node;
+
     // Success
     return 1;
 
     // Error handling
     {
 
-        // Argument errors
+        // Tree errors
         {
-            no_b_tree:
+            failed_to_claim_frame:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Failed to claim a frame in the buffer pool in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
-            no_b_tree_node:
+            failed_to_read_node:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-
-            no_property:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_property\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                // Release the frame
+                b_tree_pool_loaded(p_b_tree, i, false, false);
 
                 // Error
                 return 0;
@@ -873,42 +1416,35 @@ int b_tree_insert_not_full ( b_tree *p_b_tree, b_tree_node *const p_b_tree_node,
     }
 }
 
-int b_tree_write_meta_data ( const b_tree *const p_b_tree )
+int b_tree_node_unpin ( const b_tree *const p_b_tree, b_tree_node *const p_b_tree_node )
 {
 
     // Argument check
-    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
-
-    // Error check
-    if ( p_b_tree->p_random_access == NULL ) goto no_random_access;
-
-    // Seek start 
-    fseek(p_b_tree->p_random_access, 0, SEEK_SET);
-
-    // Write the quantity of keys
-    fwrite(&p_b_tree->_metadata.key_quantity, sizeof(unsigned long long), 1, p_b_tree->p_random_access);
+    if ( p_b_tree      == (void *) 0 ) goto no_b_tree;
+    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
 
-    // Write the address of the root node
-    fwrite(&p_b_tree->_metadata.root_address, sizeof(unsigned long long), 1, p_b_tree->p_random_access);
+    // Initialized data
+    b_tree_pool  *p_b_tree_pool = p_b_tree->p_pool;
+    b_tree_frame *p_frame       = &p_b_tree_pool->p_frames[(size_t) ( (char *) p_b_tree_node - p_b_tree_pool->p_nodes ) / p_b_tree_pool->frame_size];
 
-    // Write the degree of the B tree
-    fwrite(&p_b_tree->_metadata.degree, sizeof(int), 1, p_b_tree->p_random_access);
+    // Lock
+    pthread_mutex_lock(&p_b_tree_pool->_lock);
 
-    // Write the quantity of nodes in the B tree
-    fwrite(&p_b_tree->_metadata.node_quantity, sizeof(int), 1, p_b_tree->p_random_access);
+    // Error check
+    if ( p_frame->pins == 0 ) goto not_pinned;
 
-    // Write the height of the B tree
-    fwrite(&p_b_tree->_metadata.height, sizeof(int), 1, p_b_tree->p_random_access);
+    // Unpin the frame
+    p_frame->pins--;
 
-    // Flush the stream
-    fflush(p_b_tree->p_random_access);
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_pool->_lock);
 
     // Success
     return 1;
 
     // Error handling
     {
-        
+
         // Argument errors
         {
             no_b_tree:
@@ -916,134 +1452,158 @@ int b_tree_write_meta_data ( const b_tree *const p_b_tree )
                     log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
+                return 0;
+
+            no_b_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
                 return 0;
         }
 
         // Tree errors
         {
-
-            no_random_access:
+            not_pinned:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have a random access file in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Node %llu is not pinned in call to function \"%s\"\n", p_b_tree_node->node_pointer, __FUNCTION__);
                 #endif
 
-                // Error 
+                // Unlock
+                pthread_mutex_unlock(&p_b_tree_pool->_lock);
+
+                // Error
                 return 0;
         }
     }
 }
 
-int b_tree_read_meta_data ( b_tree *const p_b_tree )
+int b_tree_pool_destroy ( b_tree_pool *p_b_tree_pool )
 {
 
     // Argument check
-    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
-
-    // Error check
-    if ( p_b_tree->p_random_access == NULL ) goto no_random_access;
-
-    // Seek start 
-    fseek(p_b_tree->p_random_access, 0, SEEK_SET);
-
-    // Read the quantity of keys
-    fread(&p_b_tree->_metadata.key_quantity, sizeof(unsigned long long), 1, p_b_tree->p_random_access);
-
-    // Read the address of the root node
-    fread(&p_b_tree->_metadata.root_address, sizeof(unsigned long long), 1, p_b_tree->p_random_access);
+    if ( p_b_tree_pool == (void *) 0 ) goto no_b_tree_pool;
 
-    // Read the degree of the B tree
-    fread(&p_b_tree->_metadata.degree, sizeof(int), 1, p_b_tree->p_random_access);
+    // Release the lock, and the condition
+    pthread_mutex_destroy(&p_b_tree_pool->_lock);
+    pthread_cond_destroy(&p_b_tree_pool->_loaded);
 
-    // Read the quantity of nodes in the B tree
-    fread(&p_b_tree->_metadata.node_quantity, sizeof(int), 1, p_b_tree->p_random_access);
+    // Release the frames, the buckets, and the nodes
+    p_b_tree_pool->p_frames  = TREE_REALLOC(p_b_tree_pool->p_frames, 0);
+    p_b_tree_pool->p_buckets = TREE_REALLOC(p_b_tree_pool->p_buckets, 0);
+    p_b_tree_pool->p_nodes   = TREE_REALLOC(p_b_tree_pool->p_nodes, 0);
 
-    // Read the height of the B tree
-    fread(&p_b_tree->_metadata.height, sizeof(int), 1, p_b_tree->p_random_access);
+    // Release the buffer pool
+    p_b_tree_pool = TREE_REALLOC(p_b_tree_pool, 0);
 
     // Success
     return 1;
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_b_tree:
+            no_b_tree_pool:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
         }
+    }
+}
 
-        // Tree errors
-        {
+char *b_tree_page_allocate ( const b_tree *const p_b_tree )
+{
 
-            no_random_access:
+    // Initialized data
+    void *p_page = (void *) 0;
+
+    // Allocate an aligned page
+    if ( posix_memalign(&p_page, B_TREE_PAGE_ALIGNMENT, (size_t) p_b_tree->_metadata.node_size) != 0 ) goto no_mem;
+
+    // Clear the page
+    memset(p_page, 0, (size_t) p_b_tree->_metadata.node_size);
+
+    // Success
+    return p_page;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have a random access file in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
-                return 0;
+                // Error
+                return (void *) 0;
         }
     }
 }
 
-int b_tree_disk_read ( b_tree *p_b_tree, unsigned long long disk_address, b_tree_node **pp_b_tree_node )
+int b_tree_page_read ( const b_tree *const p_b_tree, unsigned long long node_pointer, b_tree_node *const p_b_tree_node )
 {
-    
-    
-    // Success
-    return 0;
-}
 
-size_t load_file ( const char *path, void *buffer, bool binary_mode )
-{
+    // Initialized data
+    size_t  node_size = (size_t) p_b_tree->_metadata.node_size;
+    char   *p_page    = b_tree_page_allocate(p_b_tree);
 
-    // Argument checking 
-    if ( path == 0 ) goto no_path;
+    // Error check
+    if ( p_page == (void *) 0 ) goto no_mem;
 
-    // Initialized data
-    size_t  ret = 0;
-    FILE   *f   = fopen(path, (binary_mode) ? "rb" : "r");
-    
-    // Check if file is valid
-    if ( f == NULL ) goto invalid_file;
+    // Read the page at its offset
+    if ( pread(p_b_tree->random_access, p_page, node_size, (off_t) ( node_pointer * node_size )) != (ssize_t) node_size ) goto failed_to_read_page;
 
-    // Find file size and prep for read
-    fseek(f, 0, SEEK_END);
-    ret = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    
-    // Read to data
-    if ( buffer ) ret = fread(buffer, 1, ret, f);
+    // Parse the page
+    if ( b_tree_page_parse(p_b_tree, node_pointer, p_page, p_b_tree_node) == 0 ) goto failed_to_parse_page;
+
+    // Release the page
+    free(p_page);
 
-    // The file is no longer needed
-    fclose(f);
-    
     // Success
-    return ret;
+    return 1;
 
     // Error handling
     {
 
-        // Argument errors
+        // Tree errors
         {
-            no_path:
+            failed_to_parse_page:
                 #ifndef NDEBUG
-                    log_error("Null pointer provided for parameter \"path\" in call to function \"%s\n", __FUNCTION__);
+                    log_error("[tree] [b] Failed to parse page %llu in call to function \"%s\"\n", node_pointer, __FUNCTION__);
                 #endif
 
+                // Release the page
+                free(p_page);
+
                 // Error
                 return 0;
         }
 
-        // File errors
+        // Standard library errors
         {
-            invalid_file:
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_page:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to read page %llu in call to function \"%s\"\n", node_pointer, __FUNCTION__);
+                #endif
+
+                // Release the page
+                free(p_page);
 
                 // Error
                 return 0;
@@ -1051,58 +1611,45 @@ size_t load_file ( const char *path, void *buffer, bool binary_mode )
     }
 }
 
-int b_tree_flush ( b_tree *const p_b_tree )
+int b_tree_page_parse ( const b_tree *const p_b_tree, unsigned long long node_pointer, const char *const p_page, b_tree_node *const p_b_tree_node )
 {
 
-    // Argument check
-    // 
-
     // Initialized data
-    //
+    size_t                    degree           = (size_t) p_b_tree->_metadata.degree;
+    const unsigned long long *p_properties     = (const unsigned long long *) ( p_page + ( 2 * sizeof(int) ) ),
+                             *p_child_pointers = p_properties + ( ( 2 * degree ) - 1 );
+    int                       leaf             = 0,
+                              key_quantity     = 0;
 
-    // Disk write the root node
-    //
+    // Read the header
+    memcpy(&leaf, p_page, sizeof(int));
+    memcpy(&key_quantity, p_page + sizeof(int), sizeof(int));
 
-    // Update metadata root address to root node location
-    //
+    // Error check
+    if ( key_quantity < 0 || (size_t) key_quantity > ( 2 * degree ) - 1 ) goto corrupt_page;
 
-    // Write the metadata
-    //
-    
-    // Success
-    return 1;
-}
+    // Populate the node
+    p_b_tree_node->leaf         = (bool) leaf;
+    p_b_tree_node->key_quantity = key_quantity;
+    p_b_tree_node->node_pointer = node_pointer;
 
-int b_tree_search ( const b_tree *const p_b_tree, const void *const p_key, const void **const pp_value )
-{
-    
-    // Success
-    return 0;
-}
+    // Read the properties
+    for (int i = 0; i < key_quantity; i++)
 
-int b_tree_insert ( b_tree *const p_b_tree, const void *const p_property )
-{
+        // Read a property
+        p_b_tree_node->properties[i] = (void *) (uintptr_t) p_properties[i];
 
-    // Argument check
-    if ( p_b_tree   == (void *) 0 ) goto no_b_tree;
-    if ( p_property == (void *) 0 ) goto no_property;
-    
-    // Is the root full?
-    if ( p_b_tree->p_root->key_quantity == ( ( 2 * p_b_tree->_metadata.degree ) - 1 ) )
-    {
+    // Read the child pointers
+    if ( leaf == false )
 
-        // Edge case
-        if ( p_b_tree->p_root->leaf )
-            
-            // Increment the quantity of nodes
-            p_b_tree->_metadata.node_quantity++;
-        
-        // Split the root before inserting 
-        b_tree_split_root(p_b_tree);
-    }
+        // Read each child pointer
+        for (int i = 0; i <= key_quantity; i++)
 
-    // Insert the key
-    b_tree_insert_not_full(p_b_tree, p_b_tree->p_root, p_property);
+            // Read a child pointer
+            p_b_tree_node->_child_pointers[i] = p_child_pointers[i];
+
+    // A leaf has no children. Its first child pointer is its sibling
+    p_b_tree_node->sibling_pointer = ( leaf ) ? p_child_pointers[0] : 0;
 
     // Success
     return 1;
@@ -1110,19 +1657,11 @@ int b_tree_insert ( b_tree *const p_b_tree, const void *const p_property )
     // Error handling
     {
 
-        // Argument errors
+        // Tree errors
         {
-            no_b_tree:
-                #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-
-            no_property:
+            corrupt_page:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_property\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Page %llu of the random access file is corrupt in call to function \"%s\"\n", node_pointer, __FUNCTION__);
                 #endif
 
                 // Error
@@ -1131,23 +1670,3202 @@ int b_tree_insert ( b_tree *const p_b_tree, const void *const p_property )
     }
 }
 
-int b_tree_remove ( b_tree *const p_b_tree, const void *const p_key, const void **const p_value )
+int b_tree_page_write ( const b_tree *const p_b_tree, const b_tree_node *const p_b_tree_node )
 {
-    
-    // Success
-    return 0;
-}
 
-int b_tree_traverse_inorder_node ( b_tree_node *p_b_tree_node, fn_b_tree_traverse *pfn_traverse )
-{
+    // Initialized data
+    size_t              node_size        = (size_t) p_b_tree->_metadata.node_size,
+                        degree           = (size_t) p_b_tree->_metadata.degree;
+    char               *p_page           = b_tree_page_allocate(p_b_tree);
+    unsigned long long *p_properties     = (unsigned long long *) ( p_page + ( 2 * sizeof(int) ) ),
+                       *p_child_pointers = p_properties + ( ( 2 * degree ) - 1 );
+    int                 leaf             = p_b_tree_node->leaf;
 
-    // Argument check
-    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
-    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+    // Error check
+    if ( p_page == (void *) 0 ) goto no_mem;
+
+    // Write the header
+    memcpy(p_page, &leaf, sizeof(int));
+    memcpy(p_page + sizeof(int), &p_b_tree_node->key_quantity, sizeof(int));
+
+    // Write the properties
+    for (int i = 0; i < p_b_tree_node->key_quantity; i++)
+
+        // Write a property
+        p_properties[i] = (unsigned long long) (uintptr_t) p_b_tree_node->properties[i];
+
+    // Write the child pointers
+    if ( leaf == false )
+
+        // Write each child pointer
+        for (int i = 0; i <= p_b_tree_node->key_quantity; i++)
+
+            // Write a child pointer
+            p_child_pointers[i] = p_b_tree_node->_child_pointers[i];
+
+    // Write the sibling of a leaf in place of its first child pointer
+    else p_child_pointers[0] = p_b_tree_node->sibling_pointer;
+
+    // Write the page at its offset
+    if ( pwrite(p_b_tree->random_access, p_page, node_size, (off_t) ( p_b_tree_node->node_pointer * node_size )) != (ssize_t) node_size ) goto failed_to_write_page;
+
+    // Release the page
+    free(p_page);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_write_page:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to write page %llu in call to function \"%s\"\n", p_b_tree_node->node_pointer, __FUNCTION__);
+                #endif
+
+                // Release the page
+                free(p_page);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_root ( const b_tree *const p_b_tree, b_tree_node **pp_root_node )
+{
+
+    // Argument check
+    if ( p_b_tree     == (void *) 0 ) goto no_b_tree;
+    if ( pp_root_node == (void *) 0 ) goto no_return;
+    
+    // Error check
+    if ( p_b_tree->p_root == (void *) 0 ) goto no_root_node;
+
+    // Return a pointer to the caller
+    *pp_root_node = p_b_tree->p_root;
+    
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+
+            no_return:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"pp_root_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Tree errors
+        {
+            no_root_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" contains no root node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int b_tree_split_root ( b_tree *const p_b_tree )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Initialized data
+    b_tree_node *p_new_root_node = (void *) 0;
+
+    // Allocate a node
+    if ( b_tree_node_allocate(p_b_tree, &p_new_root_node) == 0 ) goto failed_to_allocate_node;
+
+    // The new root is not a leaf
+    p_new_root_node->leaf = false;
+
+    // Store the pointer to the old root
+    p_new_root_node->_child_pointers[0] = p_b_tree->p_root->node_pointer;
+
+    // Split the old root
+    if ( b_tree_split_child(p_b_tree, p_new_root_node, 0) == 0 ) goto failed_to_split_node;
+
+    // The old root may be evicted
+    b_tree_node_unpin(p_b_tree, p_b_tree->p_root);
+
+    // Update the root node. The new root stays pinned
+    p_b_tree->p_root                 = p_new_root_node;
+    p_b_tree->_metadata.root_address = p_new_root_node->node_pointer;
+
+    // Update the height
+    p_b_tree->_metadata.height++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_split_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to split b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unpin the new root
+                b_tree_node_unpin(p_b_tree, p_new_root_node);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_split_child ( b_tree *const p_b_tree, b_tree_node *p_b_tree_node, size_t i )
+{
+
+    // Argument check
+    if ( p_b_tree      == (void *) 0 ) goto no_b_tree;
+    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
+
+    // Initialized data
+    b_tree_node *p_left_node  = (void *) 0,
+                *p_right_node = (void *) 0;
+    int          degree       = p_b_tree->_metadata.degree,
+                 copied       = 0;
+
+    // Read the left node
+    if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_left_node) == 0 ) goto failed_to_read_node;
+
+    // Construct the right node
+    if ( b_tree_node_allocate(p_b_tree, &p_right_node) == 0 ) goto failed_to_allocate_node;
+
+    // Set the leaf flag
+    p_right_node->leaf = p_left_node->leaf;
+
+    // A leaf of a B+ tree keeps its median, and a copy of it goes up
+    if ( p_left_node->leaf && ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) )
+    {
+
+        // The median is copied to the right node
+        copied = 1;
+
+        // Link the right node after the left node
+        p_right_node->sibling_pointer = p_left_node->sibling_pointer;
+        p_left_node->sibling_pointer  = p_right_node->node_pointer;
+    }
+
+    // Update the quantity of keys
+    p_right_node->key_quantity = degree - 1 + copied;
+
+    // Construct the right node
+    for (int j = 0; j < degree - 1 + copied; j++)
+
+        // Transfer elements from left node to right node
+        p_right_node->properties[j] = p_left_node->properties[j + degree - copied];
+
+    // Update pointers
+    if ( p_left_node->leaf == false )
+
+        // Shift pointers
+        for (int j = 0; j < degree; j++)
+
+            // Move pointers from the left node to the right node
+            p_right_node->_child_pointers[j] = p_left_node->_child_pointers[j + degree];
+
+    // Update the quantity of keys
+    p_left_node->key_quantity = degree - 1;
+
+    // Make room for the right node in the parent node
+    for (int j = p_b_tree_node->key_quantity; j > (int) i; j--)
+
+        // Shift pointers
+        p_b_tree_node->_child_pointers[j + 1] = p_b_tree_node->_child_pointers[j];
+
+    // Insert the right node into the parent node
+    p_b_tree_node->_child_pointers[i + 1] = p_right_node->node_pointer;
+
+    // Shift keys in the parent node
+    for (int j = p_b_tree_node->key_quantity - 1; j >= (int) i; j--)
+
+        // Shift keys
+        p_b_tree_node->properties[j + 1] = p_b_tree_node->properties[j];
+
+    // Insert the median of the left node
+    p_b_tree_node->properties[i] = p_left_node->properties[degree - 1];
+
+    // Increment the quantity of keys in the parent node
+    p_b_tree_node->key_quantity++;
+
+    // Disk write left
+    b_tree_disk_write(p_b_tree, p_left_node);
+
+    // Disk write right
+    b_tree_disk_write(p_b_tree, p_right_node);
+
+    // Disk write parent
+    b_tree_disk_write(p_b_tree, p_b_tree_node);
+
+    // Unpin the children
+    b_tree_node_unpin(p_b_tree, p_left_node);
+    b_tree_node_unpin(p_b_tree, p_right_node);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unpin the left node
+                b_tree_node_unpin(p_b_tree, p_left_node);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_insert_not_full ( b_tree *p_b_tree, b_tree_node *const p_b_tree_node, const void *const p_property )
+{
+
+    // Argument check
+    if ( p_b_tree      == (void *) 0 ) goto no_b_tree;
+    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
+    if ( p_property    == (void *) 0 ) goto no_property;
+
+    // Initialized data
+    signed       i            = p_b_tree_node->key_quantity - 1;
+    b_tree_node *p_child_node = (void *) 0;
+
+    // Insert into a leaf node
+    if ( p_b_tree_node->leaf )
+    {
+
+        // Check for duplicates
+        //
+
+        // Search for existing key
+        while (i >= 0 && p_b_tree->functions.pfn_is_equal(p_property, p_b_tree_node->properties[i]) > 0 )
+        {
+
+            // Shift properties
+            p_b_tree_node->properties[i + 1] = p_b_tree_node->properties[i];
+
+            // Decrement i
+            i--;
+        }
+
+        // Store the property
+        p_b_tree_node->properties[i + 1] = (void *) p_property;
+
+        // Increment the quantity of keys
+        p_b_tree_node->key_quantity++;
+
+        // Disk write the node
+        b_tree_disk_write(p_b_tree, p_b_tree_node);
+
+        // Unpin the node. The root stays pinned
+        if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+    }
+
+    // Find the child pointer
+    else
+    {
+
+        // Initialized data
+        int comparison = 0;
+
+        // Find the child that the property belongs in
+        while (i >= 0 && p_b_tree->functions.pfn_is_equal(p_property, p_b_tree_node->properties[i]) > 0 ) i--;
+
+        // The child is to the right of the last smaller property
+        i++;
+
+        // Read the child
+        if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node) == 0 ) goto failed_to_read_node;
+
+        // Split?
+        if ( p_child_node->key_quantity == ( (2 * p_b_tree->_metadata.degree) - 1) )
+        {
+
+            // Split the child node
+            if ( b_tree_split_child(p_b_tree, p_b_tree_node, (size_t) i) == 0 ) goto failed_to_split_node;
+
+            // Compare the property to the new separator
+            comparison = p_b_tree->functions.pfn_is_equal(p_property, p_b_tree_node->properties[i]);
+
+            // The property belongs in the new right node. The separator of a B+ tree is in the right node
+            if ( comparison < 0 || ( comparison == 0 && ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) ) )
+            {
+
+                // Unpin the left node
+                b_tree_node_unpin(p_b_tree, p_child_node);
+
+                // Increment i
+                i++;
+
+                // Read the new child
+                if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node) == 0 ) goto failed_to_read_node;
+            }
+        }
+
+        // Unpin the node before descending, so an insert pins a bounded 
+        // quantity of nodes. The root stays pinned
+        if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+        // Insert the property. The child is unpinned by the call
+        if ( b_tree_insert_not_full(p_b_tree, p_child_node, p_property) == 0 ) goto failed_to_insert;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_property:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_property\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unpin the node. The root stays pinned
+                if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+                // Error
+                return 0;
+
+            failed_to_split_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to split b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unpin the child, and the node. The root stays pinned
+                b_tree_node_unpin(p_b_tree, p_child_node);
+                if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+                // Error
+                return 0;
+
+            failed_to_insert:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to insert property in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_write_meta_data ( const b_tree *const p_b_tree )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Error check
+    if ( p_b_tree->random_access == -1 ) goto no_random_access;
+
+    // Initialized data
+    char   *p_page = b_tree_page_allocate(p_b_tree);
+    size_t  offset = 0;
+
+    // Error check
+    if ( p_page == (void *) 0 ) goto no_mem;
+
+    // Write the quantity of keys
+    memcpy(p_page + offset, &p_b_tree->_metadata.key_quantity, sizeof(unsigned long long)), offset += sizeof(unsigned long long);
+
+    // Write the address of the root node
+    memcpy(p_page + offset, &p_b_tree->_metadata.root_address, sizeof(unsigned long long)), offset += sizeof(unsigned long long);
+
+    // Write the degree of the B tree
+    memcpy(p_page + offset, &p_b_tree->_metadata.degree, sizeof(int)), offset += sizeof(int);
+
+    // Write the quantity of nodes in the B tree
+    memcpy(p_page + offset, &p_b_tree->_metadata.node_quantity, sizeof(unsigned long long)), offset += sizeof(unsigned long long);
+
+    // Write the height of the B tree
+    memcpy(p_page + offset, &p_b_tree->_metadata.height, sizeof(int)), offset += sizeof(int);
+
+    // Write the flags of the B tree
+    memcpy(p_page + offset, &p_b_tree->_metadata.flags, sizeof(int));
+
+    // Write the first page
+    if ( pwrite(p_b_tree->random_access, p_page, (size_t) p_b_tree->_metadata.node_size, 0) != (ssize_t) p_b_tree->_metadata.node_size ) goto failed_to_write_page;
+
+    // Release the page
+    free(p_page);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Tree errors
+        {
+
+            no_random_access:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have a random access file in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_write_page:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to write metadata in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the page
+                free(p_page);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_read_meta_data ( b_tree *const p_b_tree )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Error check
+    if ( p_b_tree->random_access == -1 ) goto no_random_access;
+
+    // Initialized data
+    char   *p_page = b_tree_page_allocate(p_b_tree);
+    size_t  offset = 0;
+
+    // Error check
+    if ( p_page == (void *) 0 ) goto no_mem;
+
+    // Read the first page
+    if ( pread(p_b_tree->random_access, p_page, (size_t) p_b_tree->_metadata.node_size, 0) != (ssize_t) p_b_tree->_metadata.node_size ) goto failed_to_read_page;
+
+    // Read the quantity of keys
+    memcpy(&p_b_tree->_metadata.key_quantity, p_page + offset, sizeof(unsigned long long)), offset += sizeof(unsigned long long);
+
+    // Read the address of the root node
+    memcpy(&p_b_tree->_metadata.root_address, p_page + offset, sizeof(unsigned long long)), offset += sizeof(unsigned long long);
+
+    // Read the degree of the B tree
+    memcpy(&p_b_tree->_metadata.degree, p_page + offset, sizeof(int)), offset += sizeof(int);
+
+    // Read the quantity of nodes in the B tree
+    memcpy(&p_b_tree->_metadata.node_quantity, p_page + offset, sizeof(unsigned long long)), offset += sizeof(unsigned long long);
+
+    // Read the height of the B tree
+    memcpy(&p_b_tree->_metadata.height, p_page + offset, sizeof(int)), offset += sizeof(int);
+
+    // Read the flags of the B tree. Files written before flags were added read 0
+    memcpy(&p_b_tree->_metadata.flags, p_page + offset, sizeof(int));
+
+    // Release the page
+    free(p_page);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Tree errors
+        {
+
+            no_random_access:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have a random access file in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_page:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to read metadata in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the page
+                free(p_page);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_disk_read ( const b_tree *const p_b_tree, unsigned long long disk_address, b_tree_node **pp_b_tree_node )
+{
+
+    // Argument check
+    if ( p_b_tree       == (void *) 0 ) goto no_b_tree;
+    if ( pp_b_tree_node == (void *) 0 ) goto no_b_tree_node;
+
+    // Error check
+    if ( p_b_tree->p_pool == (void *) 0 ) goto no_pool;
+
+    // Pin the node, reading it from the random access file IF it is not in the buffer pool
+    if ( b_tree_pool_pin(p_b_tree, disk_address, true, pp_b_tree_node) == 0 ) goto failed_to_read_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"pp_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            no_pool:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have a buffer pool in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read node %llu in call to function \"%s\"\n", disk_address, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_disk_write ( const b_tree *const p_b_tree, b_tree_node *const p_b_tree_node )
+{
+
+    // Argument check
+    if ( p_b_tree      == (void *) 0 ) goto no_b_tree;
+    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
+
+    // Initialized data
+    b_tree_pool *p_b_tree_pool = p_b_tree->p_pool;
+
+    // Mark the node's frame as changed
+    p_b_tree_pool->p_frames[(size_t) ( (char *) p_b_tree_node - p_b_tree_pool->p_nodes ) / p_b_tree_pool->frame_size].dirty = true;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t load_file ( const char *path, void *buffer, bool binary_mode )
+{
+
+    // Argument checking 
+    if ( path == 0 ) goto no_path;
+
+    // Initialized data
+    size_t  ret = 0;
+    FILE   *f   = fopen(path, (binary_mode) ? "rb" : "r");
+    
+    // Check if file is valid
+    if ( f == NULL ) goto invalid_file;
+
+    // Find file size and prep for read
+    fseek(f, 0, SEEK_END);
+    ret = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    
+    // Read to data
+    if ( buffer ) ret = fread(buffer, 1, ret, f);
+
+    // The file is no longer needed
+    fclose(f);
+    
+    // Success
+    return ret;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_path:
+                #ifndef NDEBUG
+                    log_error("Null pointer provided for parameter \"path\" in call to function \"%s\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // File errors
+        {
+            invalid_file:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_flush ( b_tree *const p_b_tree )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Initialized data
+    b_tree_pool *p_b_tree_pool = p_b_tree->p_pool;
+
+    // Lock
+    pthread_rwlock_wrlock(&p_b_tree->_rwlock);
+
+    // Disk write each changed node
+    for (size_t i = 0; p_b_tree_pool && i < p_b_tree_pool->used; i++)
+    {
+
+        // Initialized data
+        b_tree_frame *p_frame = &p_b_tree_pool->p_frames[i];
+
+        // Skip unchanged nodes
+        if ( p_frame->dirty == false ) continue;
+
+        // Write the node
+        if ( b_tree_page_write(p_b_tree, p_frame->p_b_tree_node) == 0 ) goto failed_to_write_node;
+
+        // The node is clean
+        p_frame->dirty = false;
+    }
+
+    // Write the metadata
+    if ( b_tree_write_meta_data(p_b_tree) == 0 ) goto failed_to_write_meta_data;
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_write_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to write b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+
+            failed_to_write_meta_data:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to write metadata in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_search ( const b_tree *const p_b_tree, const void *const p_key, const void **const pp_value )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+    if ( pp_value == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    b_tree_node *p_b_tree_node = p_b_tree->p_root,
+                *p_child_node  = (void *) 0;
+
+    // Error check
+    if ( p_b_tree_node == (void *) 0 ) goto no_root;
+
+    // Shared lock. Other searches read pages at the same time
+    pthread_rwlock_rdlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+    // Descend the b tree
+    for (;;)
+    {
+
+        // Initialized data
+        int i          = 0,
+            comparison = -1;
+
+        // Find the first property that is not less than the key
+        while ( i < p_b_tree_node->key_quantity && ( comparison = p_b_tree->functions.pfn_is_equal(p_key, p_b_tree_node->properties[i]) ) < 0 ) i++;
+
+        // Found the key. The properties above the leaves of a B+ tree only separate their children
+        if ( i < p_b_tree_node->key_quantity && comparison == 0 && ( p_b_tree_node->leaf || ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) == 0 ) )
+        {
+
+            // Return the property to the caller
+            *pp_value = p_b_tree_node->properties[i];
+
+            // Unpin the node. The root stays pinned
+            if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+            // Unlock
+            pthread_rwlock_unlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+            // Success
+            return 1;
+        }
+
+        // The key is not in the b tree
+        if ( p_b_tree_node->leaf ) break;
+
+        // A separator that is equal to the key is the first key of the right child
+        if ( i < p_b_tree_node->key_quantity && comparison == 0 ) i++;
+
+        // Read the child
+        if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node) == 0 ) goto failed_to_read_node;
+
+        // Unpin the node. The root stays pinned
+        if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+        // Descend
+        p_b_tree_node = p_child_node;
+    }
+
+    // Unpin the node. The root stays pinned
+    if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+    // Unlock
+    pthread_rwlock_unlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+    // Not found
+    return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            no_root:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" contains no root node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unpin the node. The root stays pinned
+                if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+                // Unlock
+                pthread_rwlock_unlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_pool_stats ( const b_tree *const p_b_tree, unsigned long long *p_hits, unsigned long long *p_misses )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Initialized data
+    const b_tree_pool *p_b_tree_pool = p_b_tree->p_pool;
+
+    // Error check
+    if ( p_b_tree_pool == (void *) 0 ) goto no_pool;
+
+    // Lock
+    pthread_mutex_lock((pthread_mutex_t *) &p_b_tree_pool->_lock);
+
+    // Return the counters to the caller
+    if ( p_hits   ) *p_hits   = p_b_tree_pool->hits;
+    if ( p_misses ) *p_misses = p_b_tree_pool->misses;
+
+    // Unlock
+    pthread_mutex_unlock((pthread_mutex_t *) &p_b_tree_pool->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            no_pool:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have a buffer pool in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_insert ( b_tree *const p_b_tree, const void *const p_property )
+{
+
+    // Argument check
+    if ( p_b_tree   == (void *) 0 ) goto no_b_tree;
+    if ( p_property == (void *) 0 ) goto no_property;
+
+    // Lock
+    pthread_rwlock_wrlock(&p_b_tree->_rwlock);
+    
+    // Is the root full?
+    if ( p_b_tree->p_root->key_quantity == ( ( 2 * p_b_tree->_metadata.degree ) - 1 ) )
+
+        // Split the root before inserting 
+        if ( b_tree_split_root(p_b_tree) == 0 ) goto failed_to_split_root;
+
+    // Insert the key
+    if ( b_tree_insert_not_full(p_b_tree, p_b_tree->p_root, p_property) == 0 ) goto failed_to_insert;
+
+    // Increment the quantity of keys
+    p_b_tree->_metadata.key_quantity++;
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_property:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_property\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_split_root:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to split root in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+
+            failed_to_insert:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to insert property in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_async_construct ( b_tree *const p_b_tree )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Initialized data
+    b_tree_async *p_b_tree_async = TREE_REALLOC(0, sizeof(b_tree_async));
+
+    // Error check
+    if ( p_b_tree_async == (void *) 0 ) goto no_mem;
+
+    // Zero set the struct
+    memset(p_b_tree_async, 0, sizeof(b_tree_async));
+
+    // Use the poll fallback until a ring is constructed
+    p_b_tree_async->ring = -1;
+
+    // Construct the lock
+    if ( pthread_mutex_init(&p_b_tree_async->_lock, (void *) 0) != 0 ) goto failed_to_create_lock;
+
+    #ifdef B_TREE_IO_URING
+
+        // Construct an io_uring. IF the kernel does not have io_uring, or does
+        // not allow it, pages are read with the poll fallback
+        b_tree_async_ring_construct(p_b_tree_async);
+    #endif
+
+    // Store the async state
+    p_b_tree->p_async = p_b_tree_async;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_create_lock:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the async state
+                p_b_tree_async = TREE_REALLOC(p_b_tree_async, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+#ifdef B_TREE_IO_URING
+int b_tree_async_ring_construct ( b_tree_async *const p_b_tree_async )
+{
+
+    // Initialized data
+    struct io_uring_params  params       = { 0 };
+    int                     ring         = (int) syscall(__NR_io_uring_setup, B_TREE_ASYNC_QUEUE_DEPTH, &params);
+    char                   *p_sq_ring    = MAP_FAILED,
+                           *p_cq_ring    = MAP_FAILED;
+    void                   *p_sqes       = MAP_FAILED;
+    size_t                  sq_ring_size = 0,
+                            cq_ring_size = 0,
+                            sqes_size    = 0;
+
+    // Error check
+    if ( ring == -1 ) goto failed_to_setup_ring;
+
+    // The kernel fills in the ring offsets
+    sq_ring_size = params.sq_off.array + ( params.sq_entries * sizeof(unsigned) );
+    cq_ring_size = params.cq_off.cqes + ( params.cq_entries * sizeof(struct io_uring_cqe) );
+    sqes_size    = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    // Newer kernels map both rings at once
+    if ( params.features & IORING_FEAT_SINGLE_MMAP )
+    {
+
+        // Map the larger ring
+        if ( cq_ring_size > sq_ring_size ) sq_ring_size = cq_ring_size;
+
+        // The rings are the same size
+        cq_ring_size = sq_ring_size;
+    }
+
+    // Map the submission ring
+    p_sq_ring = mmap((void *) 0, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+
+    // Error check
+    if ( p_sq_ring == MAP_FAILED ) goto failed_to_map_ring;
+
+    // Map the completion ring
+    p_cq_ring = ( params.features & IORING_FEAT_SINGLE_MMAP ) ? p_sq_ring : mmap((void *) 0, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+
+    // Error check
+    if ( p_cq_ring == MAP_FAILED ) goto failed_to_map_ring;
+
+    // Map the submission entries
+    p_sqes = mmap((void *) 0, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+
+    // Error check
+    if ( p_sqes == MAP_FAILED ) goto failed_to_map_ring;
+
+    // Store the ring
+    p_b_tree_async->ring         = ring;
+    p_b_tree_async->entries      = params.sq_entries;
+    p_b_tree_async->p_sq_ring    = p_sq_ring;
+    p_b_tree_async->p_cq_ring    = p_cq_ring;
+    p_b_tree_async->p_sqes       = p_sqes;
+    p_b_tree_async->sq_ring_size = sq_ring_size;
+    p_b_tree_async->cq_ring_size = cq_ring_size;
+    p_b_tree_async->sqes_size    = sqes_size;
+    p_b_tree_async->p_sq_head    = (unsigned *) ( p_sq_ring + params.sq_off.head );
+    p_b_tree_async->p_sq_tail    = (unsigned *) ( p_sq_ring + params.sq_off.tail );
+    p_b_tree_async->p_sq_mask    = (unsigned *) ( p_sq_ring + params.sq_off.ring_mask );
+    p_b_tree_async->p_sq_array   = (unsigned *) ( p_sq_ring + params.sq_off.array );
+    p_b_tree_async->p_cq_head    = (unsigned *) ( p_cq_ring + params.cq_off.head );
+    p_b_tree_async->p_cq_tail    = (unsigned *) ( p_cq_ring + params.cq_off.tail );
+    p_b_tree_async->p_cq_mask    = (unsigned *) ( p_cq_ring + params.cq_off.ring_mask );
+    p_b_tree_async->p_cqes       = p_cq_ring + params.cq_off.cqes;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            failed_to_setup_ring:
+                #ifndef NDEBUG
+                    printf("[Standard Library] io_uring is not available. Using poll in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_map_ring:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to map io_uring. Using poll in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unmap the rings
+                if ( p_sqes    != MAP_FAILED ) munmap(p_sqes, sqes_size);
+                if ( p_cq_ring != MAP_FAILED && p_cq_ring != p_sq_ring ) munmap(p_cq_ring, cq_ring_size);
+                if ( p_sq_ring != MAP_FAILED ) munmap(p_sq_ring, sq_ring_size);
+
+                // Close the ring
+                close(ring);
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+int b_tree_async_read_queue ( const b_tree *const p_b_tree, b_tree_async_read *const p_read )
+{
+
+    // NOTE: This function is called with the async lock held
+
+    // Initialized data
+    b_tree_async *p_b_tree_async = p_b_tree->p_async;
+
+    #ifdef B_TREE_IO_URING
+
+        // Submit the read to the ring IF it has room
+        if ( p_b_tree_async->ring != -1 && p_b_tree_async->in_flight < p_b_tree_async->entries )
+        {
+
+            // Initialized data
+            size_t               node_size = (size_t) p_b_tree->_metadata.node_size;
+            unsigned             tail      = *p_b_tree_async->p_sq_tail,
+                                 index     = tail & *p_b_tree_async->p_sq_mask;
+            struct io_uring_sqe *p_sqe     = &((struct io_uring_sqe *) p_b_tree_async->p_sqes)[index];
+
+            // Prepare a read of the page at its offset
+            memset(p_sqe, 0, sizeof(struct io_uring_sqe));
+            p_sqe->opcode    = IORING_OP_READ;
+            p_sqe->fd        = p_b_tree->random_access;
+            p_sqe->addr      = (unsigned long long) (uintptr_t) p_read->p_page;
+            p_sqe->len       = (unsigned) node_size;
+            p_sqe->off       = p_read->node_pointer * node_size;
+            p_sqe->user_data = (unsigned long long) (uintptr_t) p_read;
+
+            // Publish the entry. The kernel sees it at the next b_tree_poll
+            p_b_tree_async->p_sq_array[index] = index;
+            __atomic_store_n(p_b_tree_async->p_sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+            // Count the read
+            p_b_tree_async->in_flight++;
+            p_b_tree_async->unsubmitted++;
+
+            // Success
+            return 1;
+        }
+    #endif
+
+    // Queue the read until the ring has room, or until the poll fallback reads it
+    p_read->p_next           = p_b_tree_async->p_queued;
+    p_b_tree_async->p_queued = p_read;
+
+    // Success
+    return 1;
+}
+
+int b_tree_async_read_finish ( const b_tree *const p_b_tree, b_tree_async_read *p_read )
+{
+
+    // NOTE: This function is called with the async lock held
+
+    // Initialized data
+    b_tree_async           *p_b_tree_async = p_b_tree->p_async;
+    b_tree_pool            *p_b_tree_pool  = p_b_tree->p_pool;
+    b_tree_async_operation *p_operation    = (void *) 0;
+    size_t                  node_size      = (size_t) p_b_tree->_metadata.node_size;
+    bool                    loaded         = false;
+
+    // Read the page again IF the ring read was short, or the kernel does not support it
+    if ( p_read->result != (ssize_t) node_size ) p_read->result = pread(p_b_tree->random_access, p_read->p_page, node_size, (off_t) ( p_read->node_pointer * node_size ));
+
+    // Parse the page into its frame
+    loaded = ( p_read->result == (ssize_t) node_size ) && b_tree_page_parse(p_b_tree, p_read->node_pointer, p_read->p_page, p_b_tree_pool->p_frames[p_read->frame_index].p_b_tree_node);
+
+    // The node is ready, or its frame is released. Drop the read's pin
+    b_tree_pool_loaded(p_b_tree, p_read->frame_index, loaded, true);
+
+    // Resume each operation that waited for the node
+    while ( p_read->p_waiting )
+    {
+
+        // Store the operation
+        p_operation       = p_read->p_waiting;
+        p_read->p_waiting = p_operation->p_next;
+
+        // Resume the operation
+        if ( loaded )
+        {
+
+            // Run it again
+            p_operation->p_next     = p_b_tree_async->p_ready;
+            p_b_tree_async->p_ready = p_operation;
+        }
+
+        // Fail the operation
+        else
+        {
+
+            // Complete it
+            p_operation->result    = 0;
+            p_operation->p_next    = p_b_tree_async->p_done;
+            p_b_tree_async->p_done = p_operation;
+        }
+    }
+
+    // One less read
+    p_b_tree_async->reads--;
+
+    // Release the page
+    free(p_read->p_page);
+
+    // Release the read
+    p_read = TREE_REALLOC(p_read, 0);
+
+    // Success
+    return 1;
+}
+
+int b_tree_async_reap ( const b_tree *const p_b_tree, bool wait )
+{
+
+    // NOTE: This function is called with the async lock held
+
+    // Initialized data
+    b_tree_async      *p_b_tree_async = p_b_tree->p_async;
+    b_tree_async_read *p_reads        = (void *) 0,
+                      *p_read         = (void *) 0;
+
+    #ifdef B_TREE_IO_URING
+    if ( p_b_tree_async->ring != -1 )
+    {
+
+        // Initialized data
+        unsigned head = 0;
+
+        // Move queued reads into the ring while it has room
+        while ( p_b_tree_async->p_queued && p_b_tree_async->in_flight < p_b_tree_async->entries )
+        {
+
+            // Store the read
+            p_read                   = p_b_tree_async->p_queued;
+            p_b_tree_async->p_queued = p_read->p_next;
+
+            // Submit the read to the ring
+            b_tree_async_read_queue(p_b_tree, p_read);
+        }
+
+        // Wait for a read to complete IF none has
+        if ( wait && p_b_tree_async->in_flight && *p_b_tree_async->p_cq_head == __atomic_load_n(p_b_tree_async->p_cq_tail, __ATOMIC_ACQUIRE) )
+        {
+
+            // Initialized data
+            unsigned unsubmitted = p_b_tree_async->unsubmitted;
+            int      submitted   = 0;
+
+            // Unlock, so other threads submit operations while this one waits
+            pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+            // Start the reads that are not started, and wait
+            submitted = (int) syscall(__NR_io_uring_enter, p_b_tree_async->ring, unsubmitted, 1, IORING_ENTER_GETEVENTS, (void *) 0, 0);
+
+            // Lock
+            pthread_mutex_lock(&p_b_tree_async->_lock);
+
+            // The rest are submitted below
+            if ( submitted > 0 ) p_b_tree_async->unsubmitted -= (unsigned) submitted;
+        }
+
+        // Start every prepared read with one system call
+        if ( p_b_tree_async->unsubmitted )
+        {
+
+            // Initialized data
+            int submitted = (int) syscall(__NR_io_uring_enter, p_b_tree_async->ring, p_b_tree_async->unsubmitted, 0, 0, (void *) 0, 0);
+
+            // The rest are submitted at the next poll
+            if ( submitted > 0 ) p_b_tree_async->unsubmitted -= (unsigned) submitted;
+        }
+
+        // Start at the oldest completion that no thread reaped
+        head = *p_b_tree_async->p_cq_head;
+
+        // Reap each completed read
+        while ( head != __atomic_load_n(p_b_tree_async->p_cq_tail, __ATOMIC_ACQUIRE) )
+        {
+
+            // Initialized data
+            struct io_uring_cqe *p_cqe = &((struct io_uring_cqe *) p_b_tree_async->p_cqes)[head & *p_b_tree_async->p_cq_mask];
+
+            // Store the read, and its result
+            p_read         = (b_tree_async_read *) (uintptr_t) p_cqe->user_data;
+            p_read->result = p_cqe->res;
+
+            // Consume the entry
+            head++;
+
+            // One less read in flight
+            p_b_tree_async->in_flight--;
+
+            // Fill the frame, and resume the operations that waited for it
+            b_tree_async_read_finish(p_b_tree, p_read);
+        }
+
+        // Release the entries to the kernel
+        __atomic_store_n(p_b_tree_async->p_cq_head, head, __ATOMIC_RELEASE);
+    }
+    else
+    #endif
+
+    // Poll fallback. Regular files are always ready, so each queued page is
+    // read now. The reads run one at a time
+    if ( p_b_tree_async->p_queued )
+    {
+
+        // Take the queued reads
+        p_reads                  = p_b_tree_async->p_queued;
+        p_b_tree_async->p_queued = (void *) 0;
+
+        // Unlock, so other threads submit operations while the pages are read
+        pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+        // Read each page at its offset
+        for (p_read = p_reads; p_read; p_read = p_read->p_next)
+
+            // Read the page
+            p_read->result = pread(p_b_tree->random_access, p_read->p_page, (size_t) p_b_tree->_metadata.node_size, (off_t) ( p_read->node_pointer * (unsigned long long) p_b_tree->_metadata.node_size ));
+
+        // Lock
+        pthread_mutex_lock(&p_b_tree_async->_lock);
+
+        // Fill each frame, and resume the operations that waited for it
+        while ( p_reads )
+        {
+
+            // Store the read
+            p_read  = p_reads;
+            p_reads = p_read->p_next;
+
+            // Finish the read
+            b_tree_async_read_finish(p_b_tree, p_read);
+        }
+    }
+
+    // The poll fallback reads the pages before it returns, so it never waits
+    (void) wait;
+
+    // Success
+    return 1;
+}
+
+int b_tree_async_help ( const b_tree *const p_b_tree, bool *const p_wait )
+{
+
+    // Initialized data
+    b_tree_async *p_b_tree_async = p_b_tree->p_async;
+
+    // Without async state, another thread reads the page with pread
+    if ( p_b_tree_async == (void *) 0 ) goto no_reads;
+
+    // Lock
+    pthread_mutex_lock(&p_b_tree_async->_lock);
+
+    // IF no page reads are outstanding, another thread reads the page with pread
+    *p_wait = ( p_b_tree_async->in_flight == 0 && p_b_tree_async->p_queued == (void *) 0 );
+
+    // Finish the reads that completed, waiting for one IF none did
+    if ( *p_wait == false ) b_tree_async_reap(p_b_tree, true);
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+    // Success
+    return 1;
+
+    no_reads:
+
+    // Wait for the frame
+    *p_wait = true;
+
+    // Success
+    return 1;
+}
+
+int b_tree_async_step ( b_tree *const p_b_tree, b_tree_async_operation *const p_operation )
+{
+
+    // NOTE: This function is called with the async lock held
+
+    // Initialized data
+    b_tree_async       *p_b_tree_async = p_b_tree->p_async;
+    b_tree_pool        *p_b_tree_pool  = p_b_tree->p_pool;
+    b_tree_node        *p_b_tree_node  = (void *) 0;
+    b_tree_async_read  *p_read         = (void *) 0;
+    size_t              frame_index    = SIZE_MAX;
+    unsigned long long  node_pointer   = 0;
+
+    // Shared lock. The operation starts from the root each time it runs, so it
+    // sees the splits of inserts that ran while it waited for a page. IF an 
+    // insert has the b tree, run the operation again later, because the insert
+    // may be waiting for a page that this thread reads
+    if ( pthread_rwlock_tryrdlock(&p_b_tree->_rwlock) != 0 ) goto busy;
+
+    // Start at the root. The root stays pinned
+    p_b_tree_node = p_b_tree->p_root;
+
+    // Descend the b tree through the buffer pool
+    for (;;)
+    {
+
+        // Initialized data
+        int i          = 0,
+            comparison = -1,
+            claimed    = 0;
+
+        // Find the first property that is not less than the key
+        while ( i < p_b_tree_node->key_quantity && ( comparison = p_b_tree->functions.pfn_is_equal(p_operation->p_key, p_b_tree_node->properties[i]) ) < 0 ) i++;
+
+        // Found the key. The properties above the leaves of a B+ tree only separate their children
+        if ( p_operation->insert == false && i < p_b_tree_node->key_quantity && comparison == 0 && ( p_b_tree_node->leaf || ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) == 0 ) )
+        {
+
+            // Store the result
+            p_operation->result  = 1;
+            p_operation->p_value = p_b_tree_node->properties[i];
+
+            // Done
+            goto done;
+        }
+
+        // Reached a leaf
+        if ( p_b_tree_node->leaf )
+        {
+
+            // The path of the insert is in the buffer pool
+            if ( p_operation->insert ) goto insert;
+
+            // The key is not in the b tree
+            p_operation->result = 0;
+
+            // Done
+            goto done;
+        }
+
+        // A separator that is equal to the key is the first key of the right child
+        if ( i < p_b_tree_node->key_quantity && comparison == 0 ) i++;
+
+        // Store the child pointer
+        node_pointer = p_b_tree_node->_child_pointers[i];
+
+        // Leave half of the buffer pool for nodes that are not being read
+        if ( p_b_tree_async->reads >= p_b_tree_pool->quantity / 2 ) goto blocked;
+
+        // Start no reads for other operations while an insert waits for the
+        // reads to finish
+        if ( p_b_tree_async->inserts && p_operation->waiting == false ) goto blocked;
+
+        // Find the child in the buffer pool, without waiting for other readers
+        claimed = b_tree_pool_claim(p_b_tree, node_pointer, true, false, &frame_index);
+
+        // Error check
+        if ( claimed == 0 ) goto failed_to_claim_frame;
+
+        // Another thread is reading the child
+        if ( claimed == 3 ) goto blocked;
+
+        // Read the child
+        if ( claimed == 2 ) break;
+
+        // Unpin the node. The root stays pinned
+        if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+        // Descend
+        p_b_tree_node = p_b_tree_pool->p_frames[frame_index].p_b_tree_node;
+    }
+
+    // Allocate a read
+    p_read = TREE_REALLOC(0, sizeof(b_tree_async_read));
+
+    // Error check
+    if ( p_read == (void *) 0 ) goto no_mem;
+
+    // Populate the read. The operation waits for it
+    *p_read = (b_tree_async_read)
+    {
+        .p_next       = (void *) 0,
+        .p_waiting    = p_operation,
+        .p_page       = b_tree_page_allocate(p_b_tree),
+        .node_pointer = node_pointer,
+        .frame_index  = frame_index,
+        .result       = 0
+    };
+
+    // Error check
+    if ( p_read->p_page == (void *) 0 ) goto no_mem;
+
+    // The operation is the only one waiting
+    p_operation->p_next = (void *) 0;
+
+    // One more read
+    p_b_tree_async->reads++;
+
+    // Queue the read
+    b_tree_async_read_queue(p_b_tree, p_read);
+
+    // Unpin the node. The root stays pinned
+    if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    // Success
+    return 1;
+
+    blocked:
+
+    // Unpin the node. The root stays pinned
+    if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    busy:
+
+    // Run the operation again at the next poll
+    p_operation->p_next       = p_b_tree_async->p_blocked;
+    p_b_tree_async->p_blocked = p_operation;
+
+    // Success
+    return 1;
+
+    insert:
+
+    // Unpin the node. The root stays pinned
+    if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    // The insert blocks searches, and they may wait for a page that this 
+    // thread reads. Wait for each read to finish first
+    if ( p_b_tree_async->reads )
+    {
+
+        // Count the insert once
+        if ( p_operation->waiting == false ) p_b_tree_async->inserts++;
+
+        // The insert is waiting
+        p_operation->waiting = true;
+
+        // Run the operation again at the next poll
+        goto busy;
+    }
+
+    // The insert is not waiting
+    if ( p_operation->waiting ) p_b_tree_async->inserts--;
+
+    // Unlock, so threads that hold the shared lock finish the reads they need
+    // while the insert waits for the exclusive lock
+    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+    // Insert the property. The nodes it reads are in the buffer pool
+    p_operation->result  = b_tree_insert(p_b_tree, p_operation->p_key);
+    p_operation->p_value = p_operation->p_key;
+
+    // Lock
+    pthread_mutex_lock(&p_b_tree_async->_lock);
+
+    // Complete the operation
+    p_operation->p_next    = p_b_tree_async->p_done;
+    p_b_tree_async->p_done = p_operation;
+
+    // Success
+    return 1;
+
+    done:
+
+    // Unpin the node. The root stays pinned
+    if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    // Complete the operation
+    p_operation->p_next    = p_b_tree_async->p_done;
+    p_b_tree_async->p_done = p_operation;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_claim_frame:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to claim a frame in the buffer pool in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Fail the operation
+                goto failed;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the read
+                if ( p_read ) p_read = TREE_REALLOC(p_read, 0);
+
+                // Release the frame
+                b_tree_pool_loaded(p_b_tree, frame_index, false, false);
+
+                // Fail the operation
+                goto failed;
+        }
+
+        failed:
+
+            // Unpin the node. The root stays pinned
+            if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+            // Unlock
+            pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+            // Complete the operation
+            p_operation->result    = 0;
+            p_operation->p_next    = p_b_tree_async->p_done;
+            p_b_tree_async->p_done = p_operation;
+
+            // Error
+            return 0;
+    }
+}
+
+int b_tree_async_submit ( b_tree *const p_b_tree, const void *const p_key, fn_b_tree_complete *pfn_complete, void *p_context, bool insert )
+{
+
+    // Initialized data
+    b_tree_async           *p_b_tree_async = p_b_tree->p_async;
+    b_tree_async_operation *p_operation    = (void *) 0;
+
+    // Error check
+    if ( p_b_tree_async == (void *) 0 ) goto no_async;
+
+    // Allocate an operation
+    p_operation = TREE_REALLOC(0, sizeof(b_tree_async_operation));
+
+    // Error check
+    if ( p_operation == (void *) 0 ) goto no_mem;
+
+    // Populate the operation
+    *p_operation = (b_tree_async_operation)
+    {
+        .p_next       = (void *) 0,
+        .p_key        = p_key,
+        .p_value      = (void *) 0,
+        .pfn_complete = pfn_complete,
+        .p_context    = p_context,
+        .result       = 0,
+        .insert       = insert,
+        .waiting      = false
+    };
+
+    // Lock
+    pthread_mutex_lock(&p_b_tree_async->_lock);
+
+    // One more operation
+    p_b_tree_async->operations++;
+
+    // Descend as far as the buffer pool allows, and queue the first read
+    b_tree_async_step(p_b_tree, p_operation);
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            no_async:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have async state in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_search_async ( b_tree *const p_b_tree, const void *const p_key, fn_b_tree_complete *pfn_complete, void *p_context )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Submit the search
+    if ( b_tree_async_submit(p_b_tree, p_key, pfn_complete, p_context, false) == 0 ) goto failed_to_submit;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_submit:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to submit search in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_insert_async ( b_tree *const p_b_tree, const void *const p_property, fn_b_tree_complete *pfn_complete, void *p_context )
+{
+
+    // Argument check
+    if ( p_b_tree   == (void *) 0 ) goto no_b_tree;
+    if ( p_property == (void *) 0 ) goto no_property;
+
+    // Submit the insert
+    if ( b_tree_async_submit(p_b_tree, p_property, pfn_complete, p_context, true) == 0 ) goto failed_to_submit;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_property:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_property\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_submit:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to submit insert in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_poll ( b_tree *const p_b_tree, bool wait, size_t *const p_pending )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Initialized data
+    b_tree_async           *p_b_tree_async = p_b_tree->p_async;
+    b_tree_pool            *p_b_tree_pool  = p_b_tree->p_pool;
+    b_tree_async_operation *p_done         = (void *) 0,
+                           *p_operation    = (void *) 0;
+
+    // Error check
+    if ( p_b_tree_async == (void *) 0 ) goto no_async;
+
+    // Lock
+    pthread_mutex_lock(&p_b_tree_async->_lock);
+
+    // Run operations until one completes, or until there is nothing to wait for
+    for (;;)
+    {
+
+        // Run blocked operations again
+        while ( p_b_tree_async->p_blocked )
+        {
+
+            // Store the operation
+            p_operation               = p_b_tree_async->p_blocked;
+            p_b_tree_async->p_blocked = p_operation->p_next;
+
+            // Make it ready
+            p_operation->p_next     = p_b_tree_async->p_ready;
+            p_b_tree_async->p_ready = p_operation;
+        }
+
+        // Start the queued reads, and finish the reads that completed
+        b_tree_async_reap(p_b_tree, false);
+
+        // Run each ready operation as far as the buffer pool allows
+        while ( p_b_tree_async->p_ready )
+        {
+
+            // Store the operation
+            p_operation             = p_b_tree_async->p_ready;
+            p_b_tree_async->p_ready = p_operation->p_next;
+
+            // Run the operation
+            b_tree_async_step(p_b_tree, p_operation);
+        }
+
+        // Done
+        if ( p_b_tree_async->p_done || wait == false || p_b_tree_async->operations == 0 ) break;
+
+        #ifdef B_TREE_IO_URING
+
+            // Wait for a read to complete
+            if ( p_b_tree_async->in_flight )
+            {
+
+                // Initialized data
+                unsigned unsubmitted = p_b_tree_async->unsubmitted;
+                int      submitted   = 0;
+
+                // Unlock, so other threads submit operations while this one waits
+                pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+                // Start the reads that are not started, and wait
+                submitted = (int) syscall(__NR_io_uring_enter, p_b_tree_async->ring, unsubmitted, 1, IORING_ENTER_GETEVENTS, (void *) 0, 0);
+
+                // Lock
+                pthread_mutex_lock(&p_b_tree_async->_lock);
+
+                // The rest are submitted at the next poll
+                if ( submitted > 0 ) p_b_tree_async->unsubmitted -= (unsigned) submitted;
+
+                // Reap
+                continue;
+            }
+        #endif
+
+        // Read the queued pages
+        if ( p_b_tree_async->p_queued ) continue;
+
+        // Wait for another thread to read the node that blocked an operation,
+        // or to finish an insert
+        {
+
+            // Initialized data
+            struct timespec deadline = { 0 };
+
+            // Wait one millisecond at most, in case the signal came before the wait
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += 1000000;
+
+            // Carry into seconds
+            if ( deadline.tv_nsec >= 1000000000 )
+            {
+
+                // Carry
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000;
+            }
+
+            // Unlock
+            pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+            // Wait
+            pthread_mutex_lock(&p_b_tree_pool->_lock);
+            pthread_cond_timedwait(&p_b_tree_pool->_loaded, &p_b_tree_pool->_lock, &deadline);
+            pthread_mutex_unlock(&p_b_tree_pool->_lock);
+
+            // Lock
+            pthread_mutex_lock(&p_b_tree_async->_lock);
+        }
+    }
+
+    // Take the completed operations
+    p_done                 = p_b_tree_async->p_done;
+    p_b_tree_async->p_done = (void *) 0;
+
+    // Count the completed operations
+    for (p_operation = p_done; p_operation; p_operation = p_operation->p_next) p_b_tree_async->operations--;
+
+    // Return the quantity of outstanding operations to the caller
+    if ( p_pending ) *p_pending = p_b_tree_async->operations;
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+    // Call each completion function without the lock, so it may submit more operations
+    while ( p_done )
+    {
+
+        // Store the operation
+        p_operation = p_done;
+        p_done      = p_operation->p_next;
+
+        // Complete the operation
+        if ( p_operation->pfn_complete ) p_operation->pfn_complete(p_operation->p_context, p_operation->result, p_operation->p_value);
+
+        // Release the operation
+        p_operation = TREE_REALLOC(p_operation, 0);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            no_async:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" does not have async state in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_async_destroy ( b_tree *const p_b_tree )
+{
+
+    // Argument check
+    if ( p_b_tree == (void *) 0 ) goto no_b_tree;
+
+    // Initialized data
+    b_tree_async *p_b_tree_async = p_b_tree->p_async;
+    size_t        pending        = 0;
+
+    // Complete each outstanding operation
+    do
+    {
+
+        // Poll
+        if ( b_tree_poll(p_b_tree, true, &pending) == 0 ) break;
+
+    } while ( pending );
+
+    // Lock
+    pthread_mutex_lock(&p_b_tree_async->_lock);
+
+    // Finish the reads that no operation waits for, so their frames and pages are released
+    while ( p_b_tree_async->reads && ( p_b_tree_async->in_flight || p_b_tree_async->p_queued ) ) b_tree_async_reap(p_b_tree, true);
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+    #ifdef B_TREE_IO_URING
+
+        // Release the ring
+        if ( p_b_tree_async->ring != -1 )
+        {
+
+            // Unmap the rings
+            munmap(p_b_tree_async->p_sqes, p_b_tree_async->sqes_size);
+            if ( p_b_tree_async->p_cq_ring != p_b_tree_async->p_sq_ring ) munmap(p_b_tree_async->p_cq_ring, p_b_tree_async->cq_ring_size);
+            munmap(p_b_tree_async->p_sq_ring, p_b_tree_async->sq_ring_size);
+
+            // Close the ring
+            close(p_b_tree_async->ring);
+        }
+    #endif
+
+    // Release the lock
+    pthread_mutex_destroy(&p_b_tree_async->_lock);
+
+    // Release the async state
+    p_b_tree->p_async = TREE_REALLOC(p_b_tree_async, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+b_tree_node *b_tree_bulk_node_allocate ( const b_tree *const p_b_tree, bool leaf )
+{
+
+    // Initialized data
+    size_t       degree        = (size_t) p_b_tree->_metadata.degree,
+                 node_size     = sizeof(b_tree_node) + ( 2 * degree * sizeof(unsigned long long) );
+    b_tree_node *p_b_tree_node = TREE_REALLOC(0, node_size + ( ( ( 2 * degree ) - 1 ) * sizeof(void *) ));
+
+    // Error check
+    if ( p_b_tree_node == (void *) 0 ) goto no_mem;
+
+    // An empty node, with no page and no sibling. The properties follow the child pointers
+    p_b_tree_node->leaf            = leaf;
+    p_b_tree_node->key_quantity    = 0;
+    p_b_tree_node->node_pointer    = eight_bytes_of_f;
+    p_b_tree_node->sibling_pointer = 0;
+    p_b_tree_node->properties      = (void **) ( (char *) p_b_tree_node + node_size );
+
+    // Success
+    return p_b_tree_node;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+int b_tree_bulk_level_add ( const b_tree *const p_b_tree, b_tree_bulk *const p_bulk )
+{
+
+    // Initialized data
+    b_tree_bulk_level *p_levels = TREE_REALLOC(p_bulk->p_levels, ( p_bulk->level_quantity + 1 ) * sizeof(b_tree_bulk_level));
+
+    // Error check
+    if ( p_levels == (void *) 0 ) goto no_mem;
+
+    // Store the levels
+    p_bulk->p_levels = p_levels;
+
+    // Populate the level. The first level is the leaves
+    p_levels[p_bulk->level_quantity] = (b_tree_bulk_level)
+    {
+        .p_current      = b_tree_bulk_node_allocate(p_b_tree, p_bulk->level_quantity == 0),
+        .p_pending      = (void *) 0,
+        .p_pending_slot = (void *) 0,
+        .children       = 0
+    };
+
+    // Error check
+    if ( p_levels[p_bulk->level_quantity].p_current == (void *) 0 ) goto failed_to_allocate_node;
+
+    // One more level
+    p_bulk->level_quantity++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_bulk_node_write ( const b_tree *const p_b_tree, b_tree_bulk *const p_bulk, b_tree_node *p_b_tree_node, unsigned long long *const p_slot )
+{
+
+    // The node gets the next page, unless a page was reserved for it
+    if ( p_b_tree_node->node_pointer == eight_bytes_of_f ) p_b_tree_node->node_pointer = p_bulk->node_pointer++;
+
+    // Write the node
+    if ( b_tree_page_write(p_b_tree, p_b_tree_node) == 0 ) goto failed_to_write_node;
+
+    // Store the node pointer in the parent
+    *p_slot = p_b_tree_node->node_pointer;
+
+    // Release the node
+    p_b_tree_node = TREE_REALLOC(p_b_tree_node, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_write_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to write b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the node
+                p_b_tree_node = TREE_REALLOC(p_b_tree_node, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_bulk_add ( const b_tree *const p_b_tree, b_tree_bulk *const p_bulk, const void *const p_property )
+{
+
+    // Add the property to the leaves. Each time a node is full, the property
+    // separates it from the next node, and goes to the level above
+    for (size_t l = 0; ; l++)
+    {
+
+        // Initialized data
+        b_tree_bulk_level *p_level       = &p_bulk->p_levels[l];
+        b_tree_node       *p_b_tree_node = p_level->p_current;
+
+        // The node has room
+        if ( p_b_tree_node->key_quantity < p_bulk->fill )
+        {
+
+            // Store the property
+            p_b_tree_node->properties[p_b_tree_node->key_quantity++] = (void *) p_property;
+
+            // Success
+            return 1;
+        }
+
+        // The node before the full node no longer borders the right edge, so
+        // its page is final
+        if ( p_level->p_pending )
+        {
+
+            // In a B+ tree, the full leaf's page is reserved, so the leaf before it points to it
+            if ( p_b_tree_node->leaf && ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) ) p_level->p_pending->sibling_pointer = p_b_tree_node->node_pointer = p_bulk->node_pointer++;
+
+            // Write the node
+            if ( b_tree_bulk_node_write(p_b_tree, p_bulk, p_level->p_pending, p_level->p_pending_slot) == 0 ) goto failed_to_write_node;
+        }
+
+        // The full node waits, in case the last node of the level borrows from it
+        p_level->p_pending = p_b_tree_node;
+        p_level->children  = 0;
+        p_level->p_current = b_tree_bulk_node_allocate(p_b_tree, p_b_tree_node->leaf);
+
+        // Error check
+        if ( p_level->p_current == (void *) 0 ) goto failed_to_allocate_node;
+
+        // In a B+ tree, the property also starts the next leaf
+        if ( p_b_tree_node->leaf && ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) ) p_level->p_current->properties[p_level->p_current->key_quantity++] = (void *) p_property;
+
+        // Add a level above the top
+        if ( l + 1 == p_bulk->level_quantity )
+        {
+
+            // Add a level
+            if ( b_tree_bulk_level_add(p_b_tree, p_bulk) == 0 ) goto failed_to_allocate_node;
+
+            // The levels moved
+            p_level = &p_bulk->p_levels[l];
+        }
+
+        // The full node is the next child of the node above. Its node pointer 
+        // is stored when it is written
+        p_level->p_pending_slot = &p_bulk->p_levels[l + 1].p_current->_child_pointers[p_bulk->p_levels[l + 1].children++];
+    }
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_write_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to write b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to allocate b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_bulk_rebalance ( const b_tree *const p_b_tree, b_tree_bulk *const p_bulk, size_t l )
+{
+
+    // Initialized data
+    b_tree_bulk_level *p_level      = &p_bulk->p_levels[l];
+    b_tree_node       *p_left_node  = p_level->p_pending,
+                      *p_right_node = p_level->p_current,
+                      *p_separators = (void *) 0;
+    int                degree       = p_b_tree->_metadata.degree,
+                       left         = p_left_node->key_quantity,
+                       right        = p_right_node->key_quantity;
+    void              *p_separator  = (void *) 0;
+
+    // The property that separates the nodes was the last to go up. It is the
+    // last property of the lowest node above that has one
+    for (size_t m = l + 1; m < p_bulk->level_quantity; m++)
+    {
+
+        // Store the node
+        p_separators = p_bulk->p_levels[m].p_current;
+
+        // Found the separator
+        if ( p_separators && p_separators->key_quantity ) break;
+    }
+
+    // Error check
+    if ( p_separators == (void *) 0 || p_separators->key_quantity == 0 ) goto no_separator;
+
+    // Store the separator
+    p_separator = p_separators->properties[p_separators->key_quantity - 1];
+
+    // The separator of two leaves of a B+ tree is a copy of the first property
+    // of the right leaf, so it does not come down
+    if ( p_left_node->leaf && ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) )
+    {
+
+        // Split the properties evenly IF they do not fit in one leaf
+        if ( left + right > ( 2 * degree ) - 1 )
+        {
+
+            // Initialized data
+            int keep  = ( left + right ) / 2,
+                moved = left - keep;
+
+            // Make room in the right leaf
+            for (int j = right - 1; j >= 0; j--)
+
+                // Shift a property
+                p_right_node->properties[j + moved] = p_right_node->properties[j];
+
+            // Move the last properties of the left leaf
+            for (int j = 0; j < moved; j++)
+
+                // Move a property
+                p_right_node->properties[j] = p_left_node->properties[keep + j];
+
+            // A copy of the first property of the right leaf goes up
+            p_separators->properties[p_separators->key_quantity - 1] = p_right_node->properties[0];
+
+            // Update the quantity of keys
+            p_left_node->key_quantity  = keep;
+            p_right_node->key_quantity = right + moved;
+        }
+
+        // Merge the right leaf into the left leaf
+        else
+        {
+
+            // Move the properties of the right leaf
+            for (int j = 0; j < right; j++)
+
+                // Move a property
+                p_left_node->properties[left + j] = p_right_node->properties[j];
+
+            // Update the quantity of keys
+            p_left_node->key_quantity = left + right;
+
+            // The separator is gone
+            p_separators->key_quantity--;
+
+            // The right leaf is gone
+            p_level->p_current = TREE_REALLOC(p_right_node, 0);
+        }
+
+        // Success
+        return 1;
+    }
+
+    // Split the properties evenly
+    if ( left + right >= ( 2 * degree ) - 2 )
+    {
+
+        // Initialized data
+        int keep  = ( left + right ) / 2,
+            moved = left - keep;
+
+        // Make room in the right node
+        for (int j = right - 1; j >= 0; j--)
+
+            // Shift a property
+            p_right_node->properties[j + moved] = p_right_node->properties[j];
+
+        // The separator comes down
+        p_right_node->properties[moved - 1] = p_separator;
+
+        // Move the last properties of the left node
+        for (int j = 0; j < moved - 1; j++)
+
+            // Move a property
+            p_right_node->properties[j] = p_left_node->properties[keep + 1 + j];
+
+        // Move the child pointers
+        if ( p_right_node->leaf == false )
+        {
+
+            // Make room in the right node
+            for (int j = right; j >= 0; j--)
+
+                // Shift a child pointer
+                p_right_node->_child_pointers[j + moved] = p_right_node->_child_pointers[j];
+
+            // Move the last child pointers of the left node
+            for (int j = 0; j < moved; j++)
+
+                // Move a child pointer
+                p_right_node->_child_pointers[j] = p_left_node->_child_pointers[keep + 1 + j];
+        }
+
+        // A new separator goes up
+        p_separators->properties[p_separators->key_quantity - 1] = p_left_node->properties[keep];
+
+        // Update the quantity of keys
+        p_left_node->key_quantity  = keep;
+        p_right_node->key_quantity = right + moved;
+    }
+
+    // Merge the right node into the left node
+    else
+    {
+
+        // The separator comes down
+        p_left_node->properties[left] = p_separator;
+
+        // Move the properties of the right node
+        for (int j = 0; j < right; j++)
+
+            // Move a property
+            p_left_node->properties[left + 1 + j] = p_right_node->properties[j];
+
+        // Move the child pointers of the right node
+        if ( p_left_node->leaf == false )
+
+            // Move each child pointer
+            for (int j = 0; j <= right; j++)
+
+                // Move a child pointer
+                p_left_node->_child_pointers[left + 1 + j] = p_right_node->_child_pointers[j];
+
+        // Update the quantity of keys
+        p_left_node->key_quantity = left + 1 + right;
+
+        // The separator is gone
+        p_separators->key_quantity--;
+
+        // The right node is gone
+        p_level->p_current = TREE_REALLOC(p_right_node, 0);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            no_separator:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] No separator above the level in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_bulk_finish ( const b_tree *const p_b_tree, b_tree_bulk *const p_bulk )
+{
+
+    // Initialized data
+    int degree = p_b_tree->_metadata.degree;
+
+    // Close each level, from the leaves to the top
+    for (size_t l = 0; l < p_bulk->level_quantity; l++)
+    {
+
+        // Initialized data
+        b_tree_bulk_level *p_level = &p_bulk->p_levels[l];
+        bool               top     = ( l + 1 == p_bulk->level_quantity );
+
+        // The level below merged its last node, so this node has no children
+        if ( l && p_level->children == 0 ) p_level->p_current = TREE_REALLOC(p_level->p_current, 0);
+
+        // The last node of the level is short. Move properties into it from the node before it
+        else if ( p_level->p_pending && p_level->p_current->key_quantity < degree - 1 && b_tree_bulk_rebalance(p_b_tree, p_bulk, l) == 0 ) goto failed_to_rebalance;
+
+        // Write the node before the last node
+        if ( p_level->p_pending )
+        {
+
+            // In a B+ tree, the last leaf's page is reserved, so the leaf before it points to it
+            if ( p_level->p_current && p_level->p_current->leaf && ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) ) p_level->p_pending->sibling_pointer = p_level->p_current->node_pointer = p_bulk->node_pointer++;
+
+            // Write the node
+            if ( b_tree_bulk_node_write(p_b_tree, p_bulk, p_level->p_pending, p_level->p_pending_slot) == 0 ) goto failed_to_write_node;
+
+            // The node is written
+            p_level->p_pending = (void *) 0;
+        }
+
+        // Skip a level with no last node
+        if ( p_level->p_current == (void *) 0 ) continue;
+
+        // Below the top, the last node is the last child of the node above
+        if ( top == false )
+        {
+
+            // Initialized data
+            b_tree_bulk_level *p_parent_level = &p_bulk->p_levels[l + 1];
+
+            // Write the node
+            if ( b_tree_bulk_node_write(p_b_tree, p_bulk, p_level->p_current, &p_parent_level->p_current->_child_pointers[p_parent_level->children++]) == 0 ) goto failed_to_write_node;
+        }
+
+        // The top node lost its last property to a merge. Its only child is the root
+        else if ( p_level->p_current->leaf == false && p_level->p_current->key_quantity == 0 )
+        {
+
+            // Store the root
+            p_bulk->root_address = p_level->p_current->_child_pointers[0];
+            p_bulk->height       = (int) l - 1;
+
+            // Release the node
+            p_level->p_current = TREE_REALLOC(p_level->p_current, 0);
+
+            // Done
+            continue;
+        }
+
+        // The top node is the root
+        else
+        {
+
+            // Store the height
+            p_bulk->height = (int) l;
+
+            // Write the root
+            if ( b_tree_bulk_node_write(p_b_tree, p_bulk, p_level->p_current, &p_bulk->root_address) == 0 ) goto failed_to_write_node;
+        }
+
+        // The node is written
+        p_level->p_current = (void *) 0;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_write_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to write b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_rebalance:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to rebalance the last b tree node of a level in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_bulk_load ( b_tree *const p_b_tree, fn_b_tree_next *pfn_next, void *p_context, double fill_factor )
+{
+
+    // Argument check
+    if ( p_b_tree    == (void *) 0 ) goto no_b_tree;
+    if ( pfn_next    == (void *) 0 ) goto no_next;
+    if ( fill_factor >         1.0 ) goto no_fill_factor;
+
+    // Initialized data
+    b_tree_pool        *p_b_tree_pool = p_b_tree->p_pool;
+    b_tree_bulk         _bulk         = { 0 };
+    int                 degree        = p_b_tree->_metadata.degree;
+    const void         *p_property    = (void *) 0,
+                       *p_previous    = (void *) 0;
+    unsigned long long  key_quantity  = 0;
+
+    // Pack each node to the fill factor, but at least half full
+    _bulk.fill = (int) ( ( ( fill_factor > 0.0 ) ? fill_factor : B_TREE_FILL_FACTOR ) * ( ( 2 * degree ) - 1 ) );
+    if ( _bulk.fill < degree - 1 ) _bulk.fill = degree - 1;
+
+    // Lock
+    pthread_rwlock_wrlock(&p_b_tree->_rwlock);
+
+    // Error check
+    if ( p_b_tree->_metadata.key_quantity ) goto not_empty;
+
+    // The empty root is released, and its page is the first page of the load
+    _bulk.node_pointer = p_b_tree->p_root->node_pointer;
+
+    // Release the empty root's frame, without writing it
+    b_tree_pool_loaded(p_b_tree, (size_t) ( (char *) p_b_tree->p_root - p_b_tree_pool->p_nodes ) / p_b_tree_pool->frame_size, false, false);
+
+    // No root
+    p_b_tree->p_root = (void *) 0;
+
+    // Start the leaves
+    if ( b_tree_bulk_level_add(p_b_tree, &_bulk) == 0 ) goto failed_to_load;
+
+    // Add each property
+    while ( pfn_next(p_context, &p_property) )
+    {
+
+        // Error check
+        if ( p_previous && p_b_tree->functions.pfn_is_equal(p_previous, p_property) < 0 ) goto not_sorted;
+
+        // Add the property
+        if ( b_tree_bulk_add(p_b_tree, &_bulk, p_property) == 0 ) goto failed_to_load;
+
+        // Store the property
+        p_previous = p_property;
+
+        // Increment the quantity of keys
+        key_quantity++;
+    }
+
+    // Close the last node of each level, and write the root
+    if ( b_tree_bulk_finish(p_b_tree, &_bulk) == 0 ) goto failed_to_load;
+
+    // Release the levels
+    _bulk.p_levels = TREE_REALLOC(_bulk.p_levels, 0);
+
+    // Update the metadata
+    p_b_tree->_metadata.root_address  = _bulk.root_address;
+    p_b_tree->_metadata.height        = _bulk.height;
+    p_b_tree->_metadata.node_quantity = _bulk.node_pointer;
+    p_b_tree->_metadata.key_quantity  = key_quantity;
+
+    // Write the metadata after every node
+    if ( b_tree_write_meta_data(p_b_tree) == 0 ) goto failed_to_write_meta_data;
+
+    // Load the root. The root stays pinned
+    if ( b_tree_disk_read(p_b_tree, p_b_tree->_metadata.root_address, &p_b_tree->p_root) == 0 ) goto failed_to_read_node;
+
+    // Unlock
+    pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_next:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"pfn_next\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_fill_factor:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"fill_factor\" must be less than or equal to 1 in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            not_empty:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" must be empty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+
+            not_sorted:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Properties are not sorted in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Restore an empty b tree
+                goto failed_to_load;
+
+            failed_to_load:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to load properties in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release each node that is not written
+                for (size_t l = 0; l < _bulk.level_quantity; l++)
+                {
+
+                    // Release the nodes
+                    if ( _bulk.p_levels[l].p_current ) _bulk.p_levels[l].p_current = TREE_REALLOC(_bulk.p_levels[l].p_current, 0);
+                    if ( _bulk.p_levels[l].p_pending ) _bulk.p_levels[l].p_pending = TREE_REALLOC(_bulk.p_levels[l].p_pending, 0);
+                }
+
+                // Release the levels
+                if ( _bulk.p_levels ) _bulk.p_levels = TREE_REALLOC(_bulk.p_levels, 0);
+
+                // The pages that were written are abandoned
+                p_b_tree->_metadata.node_quantity = _bulk.node_pointer;
+                p_b_tree->_metadata.height        = 0;
+
+                // Allocate an empty root. The root stays pinned
+                if ( b_tree_node_allocate(p_b_tree, &p_b_tree->p_root) ) p_b_tree->_metadata.root_address = p_b_tree->p_root->node_pointer;
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+
+            failed_to_write_meta_data:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to write metadata in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_remove ( b_tree *const p_b_tree, const void *const p_key, const void **const p_value )
+{
+    
+    // Success
+    return 0;
+}
+
+int b_tree_traverse_inorder_node ( const b_tree *const p_b_tree, b_tree_node *p_b_tree_node, fn_b_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_b_tree_node == (void *) 0 ) goto no_b_tree_node;
+    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+
+    // Visit each property, after the child before it
+    for (int i = 0; i <= p_b_tree_node->key_quantity; i++)
+    {
+
+        // Traverse the child before the property
+        if ( p_b_tree_node->leaf == false )
+        {
+
+            // Initialized data
+            b_tree_node *p_child_node = (void *) 0;
+            int          result       = 0;
+
+            // Read the child
+            if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node) == 0 ) goto failed_to_read_node;
+
+            // Traverse the child
+            result = b_tree_traverse_inorder_node(p_b_tree, p_child_node, pfn_traverse);
+
+            // Unpin the child
+            b_tree_node_unpin(p_b_tree, p_child_node);
+
+            // Error check
+            if ( result == 0 ) return 0;
+        }
+
+        // Visit the property
+        if ( i < p_b_tree_node->key_quantity ) pfn_traverse(p_b_tree_node->properties[i], p_b_tree_node->properties[i]);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_traverse_inorder ( b_tree *p_b_tree, fn_b_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_b_tree     == (void *) 0 ) goto no_b_tree;
+    if ( pfn_traverse == (void *) 0 ) goto no_traverse_function;
+
+    // The properties of a B+ tree are in its leaves
+    if ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS )
+    {
+
+        // Initialized data
+        b_tree_cursor *p_b_tree_cursor = (void *) 0;
+        const void    *p_value         = (void *) 0;
+
+        // Scan every leaf
+        if ( b_tree_scan(p_b_tree, (void *) 0, (void *) 0, &p_b_tree_cursor) == 0 ) goto failed_to_traverse_b_tree;
+
+        // Visit each property
+        while ( b_tree_cursor_next(p_b_tree_cursor, &p_value) ) pfn_traverse((void *) p_value, (void *) p_value);
+
+        // Release the cursor
+        b_tree_cursor_destroy(&p_b_tree_cursor);
+    }
+
+    // Traverse the tree
+    else
+    {
+
+        // Initialized data
+        int result = 0;
+
+        // Shared lock
+        pthread_rwlock_rdlock(&p_b_tree->_rwlock);
+
+        // Traverse the tree from the root
+        result = b_tree_traverse_inorder_node(p_b_tree, p_b_tree->p_root, pfn_traverse);
+
+        // Unlock
+        pthread_rwlock_unlock(&p_b_tree->_rwlock);
+
+        // Error check
+        if ( result == 0 ) goto failed_to_traverse_b_tree;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_traverse_b_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to traverse b tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_scan ( const b_tree *const p_b_tree, const void *const p_lo, const void *const p_hi, b_tree_cursor **const pp_b_tree_cursor )
+{
+
+    // Argument check
+    if ( p_b_tree         == (void *) 0 ) goto no_b_tree;
+    if ( pp_b_tree_cursor == (void *) 0 ) goto no_b_tree_cursor;
+
+    // Initialized data
+    b_tree_cursor *p_b_tree_cursor = (void *) 0;
+    b_tree_node   *p_b_tree_node   = p_b_tree->p_root,
+                  *p_child_node    = (void *) 0;
+    int            i               = 0;
+
+    // Error check
+    if ( ( p_b_tree->_metadata.flags & B_TREE_FLAG_PLUS ) == 0 ) goto not_b_plus_tree;
+    if ( p_b_tree_node == (void *) 0 ) goto no_root;
+
+    // Allocate a cursor
+    p_b_tree_cursor = TREE_REALLOC(0, sizeof(b_tree_cursor));
+
+    // Error check
+    if ( p_b_tree_cursor == (void *) 0 ) goto no_mem;
+
+    // Shared lock, until the cursor is destroyed
+    pthread_rwlock_rdlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+    // Descend to the leaf of the lower bound
+    for (;;)
+    {
+
+        // Initialized data
+        int comparison = -1;
+
+        // Find the first property that is not less than the lower bound. 
+        // Without a lower bound, the first child is taken
+        for (i = 0; p_lo && i < p_b_tree_node->key_quantity && ( comparison = p_b_tree->functions.pfn_is_equal(p_lo, p_b_tree_node->properties[i]) ) < 0; i++);
+
+        // Reached the leaf
+        if ( p_b_tree_node->leaf ) break;
+
+        // A separator that is equal to the lower bound is the first key of the right child
+        if ( i < p_b_tree_node->key_quantity && comparison == 0 ) i++;
+
+        // Read the child
+        if ( b_tree_disk_read(p_b_tree, p_b_tree_node->_child_pointers[i], &p_child_node) == 0 ) goto failed_to_read_node;
+
+        // Unpin the node. The root stays pinned
+        if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+        // Descend
+        p_b_tree_node = p_child_node;
+    }
+
+    // Populate the cursor. It is on the first property that is not less than 
+    // the lower bound, which may be in the next leaf
+    *p_b_tree_cursor = (b_tree_cursor)
+    {
+        .p_b_tree      = p_b_tree,
+        .p_leaf        = p_b_tree_node,
+        .p_hi          = p_hi,
+        .index         = i,
+        .ahead         = 0,
+        .ahead_pointer = 0
+    };
+
+    // Read the leaves after the first leaf
+    b_tree_cursor_read_ahead(p_b_tree_cursor);
+
+    // Return a pointer to the caller
+    *pp_b_tree_cursor = p_b_tree_cursor;
 
-    for (size_t i = 0; i < p_b_tree_node->key_quantity; i++)
-        printf("%d\n",p_b_tree_node->properties[i]);
-    
     // Success
     return 1;
 
@@ -1156,17 +4874,64 @@ int b_tree_traverse_inorder_node ( b_tree_node *p_b_tree_node, fn_b_tree_travers
 
         // Argument errors
         {
-            no_b_tree_node:
+            no_b_tree:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
-            no_traverse_function:
+            no_b_tree_cursor:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Null pointer provided for parameter \"pp_b_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            not_b_plus_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" is not a B+ tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_root:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Parameter \"p_b_tree\" contains no root node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unpin the node. The root stays pinned
+                if ( p_b_tree_node != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+                // Unlock
+                pthread_rwlock_unlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+                // Release the cursor
+                p_b_tree_cursor = TREE_REALLOC(p_b_tree_cursor, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -1175,15 +4940,327 @@ int b_tree_traverse_inorder_node ( b_tree_node *p_b_tree_node, fn_b_tree_travers
     }
 }
 
-int b_tree_traverse_inorder ( b_tree *p_b_tree, fn_b_tree_traverse *pfn_traverse )
+int b_tree_cursor_leaf ( b_tree_cursor *const p_b_tree_cursor, unsigned long long node_pointer )
+{
+
+    // Initialized data
+    const b_tree *p_b_tree       = p_b_tree_cursor->p_b_tree;
+    b_tree_pool  *p_b_tree_pool  = p_b_tree->p_pool;
+    b_tree_node  *p_b_tree_node  = (void *) 0;
+    size_t        frame_index    = SIZE_MAX;
+    bool          wait           = false;
+    int           claimed        = 0;
+
+    // Find the leaf in the buffer pool. IF it is being read, finish the reads 
+    // of the ring, which is where a leaf that was read ahead comes from
+    for (;;)
+    {
+
+        // Find the leaf
+        claimed = b_tree_pool_claim(p_b_tree, node_pointer, true, wait, &frame_index);
+
+        // The leaf is in the buffer pool, or the frame is claimed
+        if ( claimed != 3 ) break;
+
+        // Finish the async reads
+        b_tree_async_help(p_b_tree, &wait);
+    }
+
+    // Error check
+    if ( claimed == 0 ) goto failed_to_claim_frame;
+
+    // Store the leaf
+    p_b_tree_node = p_b_tree_pool->p_frames[frame_index].p_b_tree_node;
+
+    // The leaf was not read ahead, or it was evicted before the cursor reached it
+    if ( claimed == 2 )
+    {
+
+        // Read the leaf
+        if ( b_tree_page_read(p_b_tree, node_pointer, p_b_tree_node) == 0 ) goto failed_to_read_node;
+
+        // The leaf is ready. The cursor keeps the pin
+        b_tree_pool_loaded(p_b_tree, frame_index, true, false);
+    }
+
+    // One less leaf ahead of the cursor
+    if ( p_b_tree_cursor->ahead ) p_b_tree_cursor->ahead--;
+
+    // Start at the first property of the leaf
+    p_b_tree_cursor->p_leaf = p_b_tree_node;
+    p_b_tree_cursor->index  = 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_claim_frame:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to claim a frame in the buffer pool in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_read_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the frame
+                b_tree_pool_loaded(p_b_tree, frame_index, false, false);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int b_tree_cursor_read_ahead ( b_tree_cursor *const p_b_tree_cursor )
+{
+
+    // Initialized data
+    const b_tree *p_b_tree      = p_b_tree_cursor->p_b_tree;
+    b_tree_node  *p_b_tree_node = p_b_tree_cursor->p_leaf;
+
+    // The cursor is past the end
+    if ( p_b_tree_node == (void *) 0 ) return 1;
+
+    #ifdef B_TREE_IO_URING
+    if ( ((b_tree_async *) p_b_tree->p_async)->ring != -1 )
+    {
+
+        // Initialized data
+        b_tree_async       *p_b_tree_async = p_b_tree->p_async;
+        b_tree_pool        *p_b_tree_pool  = p_b_tree->p_pool;
+        b_tree_async_read  *p_read         = (void *) 0;
+        size_t              frame_index    = SIZE_MAX;
+        unsigned long long  node_pointer   = 0;
+        int                 claimed        = 0;
+
+        // Lock
+        pthread_mutex_lock(&p_b_tree_async->_lock);
+
+        // Finish the reads that completed, so the cursor follows their sibling pointers
+        b_tree_async_reap(p_b_tree, false);
+
+        // Keep B_TREE_READ_AHEAD leaves ahead of the cursor
+        while ( p_b_tree_cursor->ahead < B_TREE_READ_AHEAD )
+        {
+
+            // Start from the last leaf that is ahead of the cursor
+            if ( p_b_tree_cursor->ahead )
+            {
+
+                // Find the leaf in the buffer pool, without waiting for its read
+                claimed = b_tree_pool_claim(p_b_tree, p_b_tree_cursor->ahead_pointer, true, false, &frame_index);
+
+                // The leaf is still being read
+                if ( claimed == 3 || claimed == 0 ) break;
+
+                // The leaf was evicted before the cursor reached it. Read it again
+                if ( claimed == 2 )
+                {
+
+                    // Read the leaf
+                    node_pointer = p_b_tree_cursor->ahead_pointer;
+
+                    // Queue the read
+                    goto read;
+                }
+
+                // Store the leaf
+                p_b_tree_node = p_b_tree_pool->p_frames[frame_index].p_b_tree_node;
+            }
+
+            // Store the sibling. The last leaf, and a leaf that ends past the
+            // upper bound, have no leaves after them in the range
+            node_pointer = ( p_b_tree_cursor->p_hi && p_b_tree_node->key_quantity && p_b_tree->functions.pfn_is_equal(p_b_tree_cursor->p_hi, p_b_tree_node->properties[p_b_tree_node->key_quantity - 1]) > 0 ) ? 0 : p_b_tree_node->sibling_pointer;
+
+            // Unpin the last leaf that is ahead of the cursor
+            if ( p_b_tree_cursor->ahead ) b_tree_node_unpin(p_b_tree, p_b_tree_node);
+
+            // Done
+            if ( node_pointer == 0 ) break;
+
+            // Leave half of the buffer pool for nodes that are not being read
+            if ( p_b_tree_async->reads >= p_b_tree_pool->quantity / 2 ) break;
+
+            // Find the sibling in the buffer pool, without waiting for other readers
+            claimed = b_tree_pool_claim(p_b_tree, node_pointer, true, false, &frame_index);
+
+            // Error check
+            if ( claimed == 0 ) break;
+
+            // The sibling is ahead of the cursor
+            p_b_tree_cursor->ahead++;
+            p_b_tree_cursor->ahead_pointer = node_pointer;
+
+            // The sibling is in the buffer pool
+            if ( claimed == 1 ) b_tree_node_unpin(p_b_tree, p_b_tree_pool->p_frames[frame_index].p_b_tree_node);
+
+            // Read the sibling
+            if ( claimed == 2 ) goto read;
+
+            // Next leaf
+            continue;
+
+            read:
+
+            // Allocate a read. No operation waits for it
+            p_read = TREE_REALLOC(0, sizeof(b_tree_async_read));
+
+            // Error check
+            if ( p_read == (void *) 0 ) goto no_mem;
+
+            // Populate the read
+            *p_read = (b_tree_async_read)
+            {
+                .p_next       = (void *) 0,
+                .p_waiting    = (void *) 0,
+                .p_page       = b_tree_page_allocate(p_b_tree),
+                .node_pointer = node_pointer,
+                .frame_index  = frame_index,
+                .result       = 0
+            };
+
+            // Error check
+            if ( p_read->p_page == (void *) 0 ) goto no_mem;
+
+            // One more read
+            p_b_tree_async->reads++;
+
+            // Queue the read
+            b_tree_async_read_queue(p_b_tree, p_read);
+
+            // The sibling pointer of the leaf is known when the read completes
+            break;
+        }
+
+        // Start the reads
+        b_tree_async_reap(p_b_tree, false);
+
+        // Unlock
+        pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+        // Success
+        return 1;
+
+        // Error handling
+        {
+
+            // Standard library errors
+            {
+                no_mem:
+                    #ifndef NDEBUG
+                        printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Release the read
+                    if ( p_read ) p_read = TREE_REALLOC(p_read, 0);
+
+                    // Release the frame. The cursor reads the leaf when it reaches it
+                    b_tree_pool_loaded(p_b_tree, frame_index, false, false);
+
+                    // Start the reads
+                    b_tree_async_reap(p_b_tree, false);
+
+                    // Unlock
+                    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+                    // Error
+                    return 0;
+            }
+        }
+    }
+    #endif
+
+    // Without io_uring, advise the kernel to read the next leaf while the 
+    // caller consumes this one
+    if ( p_b_tree_cursor->ahead == 0 && p_b_tree_node->sibling_pointer )
+    {
+
+        // Initialized data
+        off_t node_size = (off_t) p_b_tree->_metadata.node_size;
+
+        // Advise the kernel
+        posix_fadvise(p_b_tree->random_access, (off_t) p_b_tree_node->sibling_pointer * node_size, node_size, POSIX_FADV_WILLNEED);
+
+        // The sibling is ahead of the cursor
+        p_b_tree_cursor->ahead         = 1;
+        p_b_tree_cursor->ahead_pointer = p_b_tree_node->sibling_pointer;
+    }
+
+    // Success
+    return 1;
+}
+
+int b_tree_cursor_next ( b_tree_cursor *const p_b_tree_cursor, const void **const pp_value )
 {
 
     // Argument check
-    if ( p_b_tree     == (void *) 0 ) goto no_b_tree;
-    if ( pfn_traverse == (void *) 0 ) goto no_traverse_function;
+    if ( p_b_tree_cursor == (void *) 0 ) goto no_b_tree_cursor;
 
-    // Traverse the tree
-    if ( b_tree_traverse_inorder_node(p_b_tree->p_root, pfn_traverse) == 0 ) goto failed_to_traverse_b_tree;    
+    // State check
+    if ( p_b_tree_cursor->p_leaf == (void *) 0 ) return 0;
+
+    // Initialized data
+    const b_tree *p_b_tree   = p_b_tree_cursor->p_b_tree;
+    b_tree_node  *p_leaf     = p_b_tree_cursor->p_leaf;
+    void         *p_property = (void *) 0;
+
+    // Follow the sibling pointers past the leaves that are consumed
+    while ( p_b_tree_cursor->index == p_leaf->key_quantity )
+    {
+
+        // Initialized data
+        unsigned long long sibling_pointer = p_leaf->sibling_pointer;
+
+        // Unpin the leaf. The root stays pinned
+        if ( p_leaf != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_leaf);
+
+        // The cursor has no leaf
+        p_b_tree_cursor->p_leaf = (void *) 0;
+
+        // Past the last leaf
+        if ( sibling_pointer == 0 ) return 0;
+
+        // Pin the next leaf. It was read ahead
+        if ( b_tree_cursor_leaf(p_b_tree_cursor, sibling_pointer) == 0 ) goto failed_to_read_node;
+
+        // Store the leaf
+        p_leaf = p_b_tree_cursor->p_leaf;
+
+        // Read more leaves ahead, while the caller consumes this one
+        b_tree_cursor_read_ahead(p_b_tree_cursor);
+    }
+
+    // Store the property
+    p_property = p_leaf->properties[p_b_tree_cursor->index];
+
+    // Past the upper bound
+    if ( p_b_tree_cursor->p_hi && p_b_tree->functions.pfn_is_equal(p_b_tree_cursor->p_hi, p_property) > 0 )
+    {
+
+        // Unpin the leaf. The root stays pinned
+        if ( p_leaf != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_leaf);
+
+        // The cursor has no leaf
+        p_b_tree_cursor->p_leaf = (void *) 0;
+
+        // Done
+        return 0;
+    }
+
+    // Advance the cursor
+    p_b_tree_cursor->index++;
+
+    // Return a pointer to the caller
+    if ( pp_value ) *pp_value = p_property;
 
     // Success
     return 1;
@@ -1193,30 +5270,79 @@ int b_tree_traverse_inorder ( b_tree *p_b_tree, fn_b_tree_traverse *pfn_traverse
 
         // Argument errors
         {
-            no_b_tree:
+            no_b_tree_cursor:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Null pointer provided for parameter \"p_b_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+        }
 
-            no_traverse_function:
+        // Tree errors
+        {
+            failed_to_read_node:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Failed to read b tree node in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
+    }
+}
 
-        // Tree errors
+int b_tree_cursor_destroy ( b_tree_cursor **const pp_b_tree_cursor )
+{
+
+    // Argument check
+    if ( pp_b_tree_cursor == (void *) 0 ) goto no_b_tree_cursor;
+
+    // Initialized data
+    b_tree_cursor *p_b_tree_cursor = *pp_b_tree_cursor;
+
+    // Fast exit
+    if ( p_b_tree_cursor == (void *) 0 ) return 1;
+
+    // Initialized data
+    const b_tree *p_b_tree       = p_b_tree_cursor->p_b_tree;
+    b_tree_async *p_b_tree_async = p_b_tree->p_async;
+
+    // No more pointer for caller
+    *pp_b_tree_cursor = (void *) 0;
+
+    // Unpin the leaf. The root stays pinned
+    if ( p_b_tree_cursor->p_leaf && p_b_tree_cursor->p_leaf != p_b_tree->p_root ) b_tree_node_unpin(p_b_tree, p_b_tree_cursor->p_leaf);
+
+    // Lock
+    pthread_mutex_lock(&p_b_tree_async->_lock);
+
+    // Finish the reads ahead of the cursor, so other threads do not wait for 
+    // their frames until the b tree is polled
+    while ( p_b_tree_cursor->ahead && ( p_b_tree_async->in_flight || p_b_tree_async->p_queued ) ) b_tree_async_reap(p_b_tree, true);
+
+    // Unlock
+    pthread_mutex_unlock(&p_b_tree_async->_lock);
+
+    // Unlock
+    pthread_rwlock_unlock((pthread_rwlock_t *) &p_b_tree->_rwlock);
+
+    // Release the cursor
+    p_b_tree_cursor = TREE_REALLOC(p_b_tree_cursor, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
         {
-            failed_to_traverse_b_tree:
+            no_b_tree_cursor:
                 #ifndef NDEBUG
-                    log_error("[tree] [b] Failed to traverse b tree in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[tree] [b] Null pointer provided for parameter \"pp_b_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
                 // Error
                 return 0;
         }
@@ -1245,6 +5371,7 @@ int b_tree_destroy ( b_tree **const pp_b_tree )
 
     // Initialized data
     b_tree *p_b_tree = *pp_b_tree;
+    bool    flushed  = false;
 
     // Lock
     //
@@ -1254,8 +5381,27 @@ int b_tree_destroy ( b_tree **const pp_b_tree )
 
     // Unlock
     //
-    
-    // TODO: Deallocate
+
+    // Complete outstanding asynchronous operations
+    if ( p_b_tree->p_async ) b_tree_async_destroy(p_b_tree);
+
+    // Write changed nodes and the metadata
+    flushed = b_tree_flush(p_b_tree);
+
+    // Release the buffer pool
+    if ( p_b_tree->p_pool ) b_tree_pool_destroy(p_b_tree->p_pool);
+
+    // Close the random access file
+    if ( p_b_tree->random_access != -1 ) close(p_b_tree->random_access);
+
+    // Release the lock
+    pthread_rwlock_destroy(&p_b_tree->_rwlock);
+
+    // Release the b tree
+    p_b_tree = TREE_REALLOC(p_b_tree, 0);
+
+    // Error check
+    if ( flushed == false ) goto failed_to_flush;
 
     // Success
     return 1;
@@ -1273,5 +5419,16 @@ int b_tree_destroy ( b_tree **const pp_b_tree )
                 // Error
                 return 0;
         }
+
+        // Tree errors
+        {
+            failed_to_flush:
+                #ifndef NDEBUG
+                    log_error("[tree] [b] Failed to flush b tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
     }
 }
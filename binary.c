@@ -9,8 +9,127 @@
 // Header file
 #include <tree/binary.h>
 
+// Structure definitions
+struct binary_tree_slab_s
+{
+    struct binary_tree_slab_s *p_next,
+                              *p_adopted;
+    size_t                     references;
+};
+
+struct binary_tree_parse_task_s
+{
+    binary_tree           *p_binary_tree;
+    binary_tree_node     **pp_nodes;
+    const char            *p_path;
+    fn_binary_tree_parse  *pfn_parse_node;
+    size_t                 start,
+                           end;
+    bool                   running;
+    int                    result;
+};
+
+struct binary_tree_construct_task_s
+{
+    size_t start,
+           end,
+           offset;
+};
+
+struct binary_tree_construct_job_s
+{
+    binary_tree_node                    **pp_slab_nodes;
+    void                                **pp_values;
+    struct binary_tree_construct_task_s  *p_tasks;
+    size_t                                task_quantity,
+                                          task_capacity,
+                                          next_task;
+};
+
+struct binary_tree_sort_task_s
+{
+    void                 **pp_values,
+                         **pp_scratch;
+    fn_tree_equal         *pfn_is_equal;
+    fn_tree_key_accessor  *pfn_key_accessor;
+    size_t                 start,
+                           middle,
+                           end;
+    bool                   merge,
+                           running;
+};
+
+struct binary_tree_lazy_entry_s
+{
+    unsigned long long  node_pointer,
+                        left_pointer,
+                        right_pointer;
+    char               *p_record;
+    size_t              next;
+    bool                referenced;
+};
+
+struct binary_tree_lazy_cache_s
+{
+    struct binary_tree_lazy_entry_s *p_entries;
+    size_t                          *p_buckets;
+    char                            *p_records;
+    size_t                           quantity,
+                                     used,
+                                     hand,
+                                     bucket_mask;
+    mutex                            _lock;
+};
+
+// Type definitions
+typedef struct binary_tree_slab_s           binary_tree_slab;
+typedef struct binary_tree_parse_task_s     binary_tree_parse_task;
+typedef struct binary_tree_construct_task_s binary_tree_construct_task;
+typedef struct binary_tree_construct_job_s  binary_tree_construct_job;
+typedef struct binary_tree_sort_task_s      binary_tree_sort_task;
+typedef struct binary_tree_lazy_entry_s     binary_tree_lazy_entry;
+typedef struct binary_tree_lazy_cache_s     binary_tree_lazy_cache;
+
+// Preprocessor definitions
+#ifdef BINARY_TREE_STATS
+    #define BINARY_TREE_STATS_COMPARE(comparisons)                          ( (comparisons)++ )
+    #define BINARY_TREE_STATS_COUNT(p_binary_tree, operation, comparisons) binary_tree_stats_count((p_binary_tree), (operation), (comparisons))
+#else
+    #define BINARY_TREE_STATS_COMPARE(comparisons)                          ( (void) 0 )
+    #define BINARY_TREE_STATS_COUNT(p_binary_tree, operation, comparisons) ( (void) (comparisons) )
+#endif
+
+#ifdef BINARY_TREE_ORDER_STATISTICS
+    #define BINARY_TREE_NODE_SIZE(p_node)            ( (p_node)->size )
+    #define BINARY_TREE_NODE_SIZE_SET(p_node, value) ( (p_node)->size = (value) )
+    #define BINARY_TREE_NODE_SIZE_ADD(p_node, delta) ( (p_node)->size += (delta) )
+#else
+    #define BINARY_TREE_NODE_SIZE(p_node)            ( (void) (p_node), 0ULL )
+    #define BINARY_TREE_NODE_SIZE_SET(p_node, value) ( (void) (p_node), (void) (value) )
+    #define BINARY_TREE_NODE_SIZE_ADD(p_node, delta) ( (void) (p_node), (void) (delta) )
+#endif
+
+#ifdef BINARY_TREE_SNAPSHOTS
+    #define BINARY_TREE_NODE_SHARED(p_binary_tree, p_node) ( (p_binary_tree)->snapshots.quantity && (p_node)->generation != (p_binary_tree)->snapshots.generation )
+    #define BINARY_TREE_NODE_STAMP(p_binary_tree, p_node)  ( (p_node)->generation = (p_binary_tree)->snapshots.generation )
+#else
+    #define BINARY_TREE_NODE_SHARED(p_binary_tree, p_node) ( (void) (p_binary_tree), (void) (p_node), 0 )
+    #define BINARY_TREE_NODE_STAMP(p_binary_tree, p_node)  ( (void) (p_binary_tree), (void) (p_node) )
+#endif
+
+#define BINARY_TREE_CONSTRUCT_NODE(p_job, offset) ( (p_job)->pp_slab_nodes[(offset) / BINARY_TREE_SLAB_NODE_QUANTITY] + ( (offset) % BINARY_TREE_SLAB_NODE_QUANTITY ) )
+
 // Static data
 static const unsigned long long eight_bytes_of_f = 0xffffffffffffffff;
+static __thread char           *p_binary_tree_lazy_record        = (void *) 0;
+static __thread size_t          binary_tree_lazy_record_size     = 0;
+static pthread_key_t            binary_tree_lazy_record_key;
+static pthread_once_t           binary_tree_lazy_record_key_once = PTHREAD_ONCE_INIT;
+
+#ifdef BINARY_TREE_STATS
+    static size_t          binary_tree_stats_thread_quantity = 0;
+    static __thread size_t binary_tree_stats_thread_slot     = 0;
+#endif
 
 // Forward declarations
 /** !
@@ -23,13 +142,52 @@ static const unsigned long long eight_bytes_of_f = 0xffffffffffffffff;
 int binary_tree_create ( binary_tree **const pp_binary_tree );
 
 /** !
- * Allocate memory for a binary tree node
+ * Allocate a slab of binary tree nodes, and make it the current slab of the 
+ * binary tree's node allocator. 
+ * 
+ * The first node of each slab is aligned to a cache line. Slabs are chained
+ * together, so they can be released in bulk when the binary tree is destroyed.
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_slab_create ( binary_tree *p_binary_tree );
+
+/** !
+ * Drop a reference to a chain of slabs. 
+ * 
+ * Each slab counts the references to it, from binary trees and from the slab
+ * before it in a chain. A slab is freed with its last reference, and then lets 
+ * go of the slabs it refers to. This lets binary trees split from one another
+ * share the slabs their nodes were carved from.
+ * 
+ * @param p_binary_tree_slab the first slab in the chain, or null
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_slab_release ( binary_tree_slab *p_binary_tree_slab );
+
+/** !
+ * Count the slabs of nodes reachable from a slab
+ * 
+ * @param p_binary_tree_slab the first slab in the chain, or null
+ * 
+ * @return the quantity of slabs
+ */
+size_t binary_tree_slab_count ( const binary_tree_slab *p_binary_tree_slab );
+
+/** !
+ * Allocate memory for a binary tree node from a binary tree's node allocator. 
+ * 
+ * Nodes on the free list are reused before new nodes are carved from the slab.
  * 
+ * @param p_binary_tree       the binary tree
  * @param pp_binary_tree_node return
  * 
  * @return 1 on success, 0 on error
  */
-int binary_tree_node_create ( binary_tree_node **pp_binary_tree_node );
+int binary_tree_node_create ( binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node );
 
 /** !
  * Allocate a node for a specific binary tree, and set the node pointer. 
@@ -44,147 +202,6172 @@ int binary_tree_node_create ( binary_tree_node **pp_binary_tree_node );
  */
 int binary_tree_node_allocate ( binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node );
 
+/** !
+ * Acquire a binary tree's lock for reading. Readers run in parallel IF the 
+ * binary tree was constructed with BINARY_TREE_FLAG_READER_WRITER ELSE 
+ * readers are exclusive. 
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_read_lock ( const binary_tree *const p_binary_tree );
+
+/** !
+ * Acquire a binary tree's lock for writing
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_write_lock ( const binary_tree *const p_binary_tree );
+
+/** !
+ * Release a binary tree's lock
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_unlock ( const binary_tree *const p_binary_tree );
+
+/** !
+ * Recursively measure the height and the depth histogram of a binary tree
+ * 
+ * @param p_binary_tree_node the binary tree node
+ * @param depth              the depth of the binary tree node
+ * @param p_report           the report
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_stats_node ( const binary_tree_node *const p_binary_tree_node, size_t depth, binary_tree_stats_report *const p_report );
+
+/** !
+ * Count the keys of a binary tree that are less than a key, or less than or 
+ * equal to a key, using the subtree size of each node on the search path
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_key         the key
+ * @param inclusive     true to count a key equal to the key, else false
+ * 
+ * @return the quantity of keys
+ */
+size_t binary_tree_order_statistics_rank ( const binary_tree *const p_binary_tree, const void *const p_key, bool inclusive );
+
+/** !
+ * Add a delta to the subtree size of each node on the search path of a key, 
+ * stopping before the node with the key. Used to undo the updates made by an 
+ * insert of a duplicate, or a remove of a missing key
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_key         the key
+ * @param delta         the change in subtree size
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_order_statistics_update ( binary_tree *const p_binary_tree, const void *const p_key, long long delta );
+
+#ifdef BINARY_TREE_STATS
+
+/** !
+ * Get the calling thread's statistics slot of a binary tree. Each thread is 
+ * assigned a slot the first time it counts anything
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return pointer to the slot
+ */
+binary_tree_stats_slot *binary_tree_stats_slot_get ( const binary_tree *const p_binary_tree );
+
+/** !
+ * Count an operation, and the comparisons it made, in the calling thread's slot
+ * 
+ * @param p_binary_tree the binary tree
+ * @param operation     the operation
+ * @param comparisons   the quantity of comparisons
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_stats_count ( const binary_tree *const p_binary_tree, enum binary_tree_stats_operation_e operation, unsigned long long comparisons );
+
+/** !
+ * Get a monotonic timestamp
+ * 
+ * @return the timestamp in nanoseconds
+ */
+unsigned long long binary_tree_stats_time ( void );
+
+#endif
+
+/** !
+ * Push a node onto a binary tree cursor's path, growing the path as needed
+ * 
+ * @param p_binary_tree_cursor the binary tree cursor
+ * @param p_binary_tree_node   the binary tree node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_cursor_push ( binary_tree_cursor *const p_binary_tree_cursor, binary_tree_node *p_binary_tree_node );
+
+/** !
+ * Recursively place the values of a binary tree in a frozen snapshot, in 
+ * Eytzinger order
+ * 
+ * @param p_binary_tree        the binary tree
+ * @param p_binary_tree_cursor a cursor positioned on the next value to place
+ * @param i                    the index of the snapshot slot
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_freeze_node ( binary_tree *p_binary_tree, binary_tree_cursor *p_binary_tree_cursor, size_t i );
+
+/** !
+ * Discard a binary tree's frozen snapshot, if it has one
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_thaw ( binary_tree *p_binary_tree );
+
+/** !
+ * Search a binary tree's frozen snapshot for a key
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_key         the key
+ * @param pp_value      return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_search_frozen ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value );
+
+/** !
+ * Search a memory mapped binary tree for a key
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_key         the key
+ * @param pp_value      return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_search_mapped ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value );
+
+/** !
+ * Traverse a memory mapped binary tree using the pre order technique
+ * 
+ * @param p_binary_tree the binary tree
+ * @param node_pointer  the index of the node's record in the file
+ * @param pfn_traverse  called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_traverse_preorder_mapped ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a memory mapped binary tree using the in order technique
+ * 
+ * @param p_binary_tree the binary tree
+ * @param node_pointer  the index of the node's record in the file
+ * @param pfn_traverse  called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_traverse_inorder_mapped ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a memory mapped binary tree using the post order technique
+ * 
+ * @param p_binary_tree the binary tree
+ * @param node_pointer  the index of the node's record in the file
+ * @param pfn_traverse  called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_traverse_postorder_mapped ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Find a record of a lazy binary tree in its cache, reading the record from 
+ * the file and evicting another record IF it is not in the cache. The record 
+ * is copied out of the cache into the calling thread's record buffer, which 
+ * the thread's next fetch overwrites
+ * 
+ * @param p_binary_tree   the binary tree
+ * @param node_pointer    the index of the node's record in the file
+ * @param p_left_pointer  return
+ * @param p_right_pointer return
+ * 
+ * @return pointer to the copy of the record on success, null on error
+ */
+const char *binary_tree_lazy_fetch ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, unsigned long long *p_left_pointer, unsigned long long *p_right_pointer );
+
+/** !
+ * Search a lazy binary tree for a key
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_key         the key
+ * @param pp_value      return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_search_lazy ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value );
+
+/** !
+ * Traverse a lazy binary tree using the pre order technique
+ * 
+ * @param p_binary_tree the binary tree
+ * @param node_pointer  the index of the node's record in the file
+ * @param pfn_traverse  called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_traverse_preorder_lazy ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a lazy binary tree using the in order technique
+ * 
+ * @param p_binary_tree the binary tree
+ * @param node_pointer  the index of the node's record in the file
+ * @param pfn_traverse  called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_traverse_inorder_lazy ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a lazy binary tree using the post order technique
+ * 
+ * @param p_binary_tree the binary tree
+ * @param node_pointer  the index of the node's record in the file
+ * @param pfn_traverse  called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_traverse_postorder_lazy ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Create the key that releases record buffers when threads exit
+ */
+void binary_tree_lazy_record_key_create ( void );
+
+/** !
+ * Release a thread's record buffer when the thread exits
+ * 
+ * @param p_record the record buffer
+ */
+void binary_tree_lazy_record_release ( void *p_record );
+
+/** !
+ * Release the record cache of a lazy binary tree
+ * 
+ * @param p_binary_tree_lazy_cache the record cache
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_lazy_cache_destroy ( binary_tree_lazy_cache *p_binary_tree_lazy_cache );
+
 /** !
  * Recursively construct a balanced binary search tree from a sorted list of keys and values
  * 
  * @param p_binary_tree the binary tree
  * @param pp_values     the list of values
- * @param start         the starting index 
- * @param end           the ending index
+ * @param start         the index of the first value
+ * @param end           the index after the last value
  * 
- * @return the root node 
+ * @return the root node IF start < end ELSE null
  */
 binary_tree_node *binary_tree_construct_balanced_recursive ( binary_tree *p_binary_tree, void **pp_values, size_t start, size_t end );
 
 /** !
- * Recursively serialize binary tree nodes to a file
+ * Reserve a binary tree's nodes for a parallel balanced construction. Slabs 
+ * are allocated for every node, but the nodes are left for the threads to 
+ * write, and the first node of each slab is stored in the job
  * 
- * @param p_file                    the file
- * @param p_binary_tree             the binary tree
- * @param p_binary_tree_node        the binary tree node
- * @param pfn_binary_tree_serialize the node serializer function
+ * @param p_binary_tree              the binary tree
+ * @param p_binary_tree_construct_job the job
+ * @param quantity                   the quantity of nodes
  * 
- * @return 1 on success, 0 on error 
+ * @return 1 on success, 0 on error
  */
-int binary_tree_serialize_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, fn_binary_tree_serialize *pfn_binary_tree_serialize );
+int binary_tree_construct_balanced_reserve ( binary_tree *p_binary_tree, binary_tree_construct_job *p_binary_tree_construct_job, size_t quantity );
 
 /** !
- * Recursively parse binary tree nodes from a file
+ * Write one node of a parallel balanced construction, and link it to the 
+ * roots of its subtrees
  * 
- * @param p_file                    the file
- * @param p_binary_tree             the binary tree
- * @param pp_binary_tree_node       result
- * @param pfn_binary_tree_serialize the node parser function
+ * @param p_binary_tree_construct_job the job
+ * @param start                       the index of the first value
+ * @param end                         the index after the last value
+ * @param offset                      the position of the node in pre order
  * 
- * @return 1 on success, 0 on error 
+ * @return 1 on success, 0 on error
  */
-int binary_tree_parse_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node, fn_binary_tree_parse *pfn_binary_tree_parse );
+int binary_tree_construct_balanced_link ( binary_tree_construct_job *p_binary_tree_construct_job, size_t start, size_t end, size_t offset );
 
 /** !
- * Traverse a binary tree using the pre order technique
+ * Recursively write every node of a subtree of a parallel balanced construction
  * 
- * @param p_binary_tree_node pointer to binary tree node
- * @param pfn_traverse       called for each node in the binary tree
+ * @param p_binary_tree_construct_job the job
+ * @param start                       the index of the first value
+ * @param end                         the index after the last value
+ * @param offset                      the position of the subtree's root in pre order
  * 
  * @return 1 on success, 0 on error
-*/
-int binary_tree_traverse_preorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse );
+ */
+int binary_tree_construct_balanced_fill ( binary_tree_construct_job *p_binary_tree_construct_job, size_t start, size_t end, size_t offset );
 
 /** !
- * Traverse a binary tree using the in order technique
+ * Recursively write the top of a parallel balanced construction, and add each
+ * subtree of at most BINARY_TREE_CONSTRUCT_PARALLEL_CUTOFF values to the tasks
  * 
- * @param p_binary_tree_node pointer to binary tree node
- * @param pfn_traverse       called for each node in the binary tree
+ * @param p_binary_tree_construct_job the job
+ * @param start                       the index of the first value
+ * @param end                         the index after the last value
+ * @param offset                      the position of the subtree's root in pre order
  * 
  * @return 1 on success, 0 on error
-*/
-int binary_tree_traverse_inorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse );
+ */
+int binary_tree_construct_balanced_plan ( binary_tree_construct_job *p_binary_tree_construct_job, size_t start, size_t end, size_t offset );
 
 /** !
- * Traverse a binary tree using the post order technique
+ * Write subtrees of a parallel balanced construction until no tasks are left. 
+ * This is the entry point of a parallel construction thread
  * 
- * @param p_binary_tree_node pointer to binary tree node
- * @param pfn_traverse       called for each node in the binary tree
+ * @param p_parameter pointer to a binary tree construct job
+ * 
+ * @return null pointer
+ */
+void *binary_tree_construct_balanced_worker ( void *p_parameter );
+
+/** !
+ * Recursively sort a range of values with a stable merge sort. Short ranges 
+ * are sorted by insertion, and two halves already in order are not merged
+ * 
+ * @param p_binary_tree_sort_task the sort task
+ * @param start                   the index of the first value
+ * @param end                     the index after the last value
  * 
  * @return 1 on success, 0 on error
-*/
-int binary_tree_traverse_postorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse );
+ */
+int binary_tree_sort_values ( const binary_tree_sort_task *p_binary_tree_sort_task, size_t start, size_t end );
 
 /** !
- * Deallocate a binary tree node
+ * Merge two adjacent sorted ranges of values. On equal keys, the value from 
+ * the first range is taken first, so the merge is stable
  * 
- * @param pp_binary_tree_node pointer to binary tree node pointer
+ * @param p_binary_tree_sort_task the sort task
+ * @param start                   the index of the first value of the first range
+ * @param middle                  the index of the first value of the second range
+ * @param end                     the index after the last value of the second range
  * 
  * @return 1 on success, 0 on error
  */
-int binary_tree_node_destroy ( binary_tree_node **const pp_binary_tree_node );
+int binary_tree_sort_merge ( const binary_tree_sort_task *p_binary_tree_sort_task, size_t start, size_t middle, size_t end );
 
-// Function definitions
-int binary_tree_create ( binary_tree **pp_binary_tree )
-{
+/** !
+ * Sort, or merge the range of a sort task. This is the entry point of a 
+ * parallel sort thread
+ * 
+ * @param p_parameter pointer to a binary tree sort task
+ * 
+ * @return null pointer
+ */
+void *binary_tree_sort_worker ( void *p_parameter );
 
-    // Argument check
-    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+/** !
+ * Run sort tasks in parallel, one per thread. The first task runs on the 
+ * calling thread, and IF a thread fails to start, its task runs on the calling
+ * thread too
+ * 
+ * @param p_binary_tree_sort_tasks the sort tasks
+ * @param task_quantity            the quantity of sort tasks
+ * @param p_threads                storage for task_quantity threads
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_sort_run ( binary_tree_sort_task *p_binary_tree_sort_tasks, size_t task_quantity, pthread_t *p_threads );
+
+/** !
+ * Store the values of a subtree in order, and release its nodes. 
+ * 
+ * IF adopt is false, the nodes belong to the binary tree, and are destroyed 
+ * ELSE the nodes belong to a binary tree whose slabs the binary tree has 
+ * adopted, and are pushed straight onto the binary tree's free list
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the root of the subtree, or null
+ * @param pp_values          return
+ * @param p_index            the index of the next value. Incremented for each value
+ * @param adopt              true IF the nodes are adopted ELSE false
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_merge_flatten ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, void **pp_values, size_t *p_index, bool adopt );
+
+/** !
+ * Split a subtree into the nodes with keys less than a key, and the nodes with 
+ * keys greater than or equal to the key. No nodes are allocated
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the root of the subtree, or null
+ * @param p_key              the key
+ * @param pp_left            return; the subtree of lesser keys
+ * @param pp_right           return; the subtree of greater or equal keys
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_split_node ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, const void *const p_key, binary_tree_node **pp_left, binary_tree_node **pp_right );
+
+/** !
+ * Count the nodes in a subtree
+ * 
+ * @param p_binary_tree_node the root of the subtree, or null
+ * 
+ * @return the quantity of nodes
+ */
+unsigned long long binary_tree_node_count ( const binary_tree_node *const p_binary_tree_node );
+
+/** !
+ * Take the slabs, and the free list of another binary tree, so the binary tree 
+ * can keep the other binary tree's nodes after the other binary tree is 
+ * destroyed
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_other       the other binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_slab_adopt ( binary_tree *p_binary_tree, binary_tree *p_other );
+
+/** !
+ * Serialize each node of a binary tree snapshot to a file in breadth first 
+ * order. Records are staged in a buffer, and written to the file in large blocks
+ * 
+ * @param p_file                    the file
+ * @param p_binary_tree_snapshot    the binary tree snapshot
+ * @param pfn_binary_tree_serialize the node serializer function
+ * 
+ * @return 1 on success, 0 on error 
+ */
+int binary_tree_serialize_nodes ( FILE *p_file, const binary_tree_snapshot *p_binary_tree_snapshot, fn_binary_tree_serialize *pfn_binary_tree_serialize );
+
+/** !
+ * Recursively parse binary tree nodes from a file
+ * 
+ * @param p_file                    the file
+ * @param p_binary_tree             the binary tree
+ * @param pp_binary_tree_node       result
+ * @param pfn_binary_tree_serialize the node parser function
+ * 
+ * @return 1 on success, 0 on error 
+ */
+int binary_tree_parse_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node, fn_binary_tree_parse *pfn_binary_tree_parse );
+
+/** !
+ * Parse a contiguous range of records from a file, and link each node to its 
+ * children by node pointer. This is the entry point of a parallel parse thread
+ * 
+ * @param p_parameter pointer to a binary tree parse task
+ * 
+ * @return null pointer
+ */
+void *binary_tree_parse_records ( void *p_parameter );
+
+/** !
+ * Traverse a binary tree using the pre order technique
+ * 
+ * @param p_binary_tree_node pointer to binary tree node
+ * @param pfn_traverse       called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+*/
+int binary_tree_traverse_preorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a binary tree using the in order technique
+ * 
+ * @param p_binary_tree_node pointer to binary tree node
+ * @param pfn_traverse       called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+*/
+int binary_tree_traverse_inorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a binary tree using the post order technique
+ * 
+ * @param p_binary_tree_node pointer to binary tree node
+ * @param pfn_traverse       called for each node in the binary tree
+ * 
+ * @return 1 on success, 0 on error
+*/
+int binary_tree_traverse_postorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Make the node at a link safe to change. IF a live snapshot shares the node, 
+ * the node is copied, the link is pointed at the copy, and the original is 
+ * retired until the last snapshot is destroyed. The node that holds the link 
+ * must already be safe to change. 
+ * 
+ * @param p_binary_tree       the binary tree
+ * @param pp_binary_tree_node the link to the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_node_writable ( binary_tree *p_binary_tree, binary_tree_node **const pp_binary_tree_node );
+
+/** !
+ * Hold a binary tree node that a live snapshot may still read, until the last
+ * snapshot is destroyed
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the binary tree node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_node_retire ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node );
+
+/** !
+ * Return a binary tree node to the binary tree's free list, or retire it IF a 
+ * live snapshot shares it. Child nodes are not released. 
+ * 
+ * @param p_binary_tree       the binary tree
+ * @param pp_binary_tree_node pointer to binary tree node pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_node_destroy ( binary_tree *p_binary_tree, binary_tree_node **const pp_binary_tree_node );
+
+/** !
+ * Grow a binary tree's checkpoint slot table and dirty bits to cover a slot. 
+ * On error, the checkpoint state is marked invalid, and the next checkpoint 
+ * rewrites the whole file. 
+ * 
+ * @param p_binary_tree the binary tree
+ * @param slot          the slot
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_reserve ( binary_tree *p_binary_tree, size_t slot );
+
+/** !
+ * Mark the record of a binary tree node as changed since the last checkpoint
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the binary tree node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_mark ( binary_tree *p_binary_tree, const binary_tree_node *const p_binary_tree_node );
+
+/** !
+ * Give a new binary tree node a record, reusing a freed record IF there is one
+ * ELSE a record at the end of the file
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the binary tree node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_slot_acquire ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node );
+
+/** !
+ * Free the record of a removed binary tree node, for reuse by a later insert
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the binary tree node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_slot_release ( binary_tree *p_binary_tree, const binary_tree_node *const p_binary_tree_node );
+
+/** !
+ * Find the parent of a node in a binary tree, by searching for its key
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the binary tree node
+ * 
+ * @return the parent IF the node is not the root ELSE null
+ */
+binary_tree_node *binary_tree_checkpoint_parent ( const binary_tree *const p_binary_tree, const binary_tree_node *const p_binary_tree_node );
+
+/** !
+ * Number every node of a binary tree by its breadth first position, and write 
+ * the whole binary tree to the checkpoint file
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param pfn_serialize_node the node serializer function
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_full ( binary_tree *p_binary_tree, fn_binary_tree_serialize *pfn_serialize_node );
+
+/** !
+ * Compact a binary tree's records, and write the changed records to the 
+ * checkpoint file
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param pfn_serialize_node the node serializer function
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_incremental ( binary_tree *p_binary_tree, fn_binary_tree_serialize *pfn_serialize_node );
+
+/** !
+ * Order two record numbers, for qsort
+ * 
+ * @param p_a pointer to a
+ * @param p_b pointer to b
+ * 
+ * @return less than, equal to, or greater than zero IF a is less than, equal to, or greater than b
+ */
+int binary_tree_checkpoint_slot_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Mark the record of each node of a subtree as changed since the last checkpoint
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the root of the subtree, or null
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint_mark_subtree ( binary_tree *p_binary_tree, const binary_tree_node *const p_binary_tree_node );
+
+/** !
+ * Store a node on a scapegoat binary tree's insert path, growing the path as 
+ * needed
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param depth              the depth of the binary tree node
+ * @param p_binary_tree_node the binary tree node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_scapegoat_push ( binary_tree *p_binary_tree, size_t depth, binary_tree_node *p_binary_tree_node );
+
+/** !
+ * Compute the deepest a node may be in a scapegoat binary tree, the floor of 
+ * log base 1 / BINARY_TREE_SCAPEGOAT_ALPHA of a node quantity
+ * 
+ * @param node_quantity the node quantity
+ * 
+ * @return the greatest allowed depth
+ */
+size_t binary_tree_scapegoat_height ( unsigned long long node_quantity );
+
+/** !
+ * Restore the height of a scapegoat binary tree after an insert. IF the new 
+ * node is too deep, the nearest ancestor on the insert path with a child of 
+ * more than BINARY_TREE_SCAPEGOAT_ALPHA of its nodes is rebuilt balanced
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_binary_tree_node the new node
+ * @param depth              the depth of the new node
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_scapegoat_insert ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, size_t depth );
+
+/** !
+ * Rebuild a scapegoat binary tree balanced after a remove, IF it has shrunk 
+ * below BINARY_TREE_SCAPEGOAT_ALPHA of its largest size since the last full 
+ * rebuild
+ * 
+ * @param p_binary_tree the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_scapegoat_remove ( binary_tree *p_binary_tree );
+
+/** !
+ * Rebuild a subtree balanced, in place. The values are flattened in order, the
+ * nodes are released, and the subtree is constructed again from the free list
+ * 
+ * @param p_binary_tree       the binary tree
+ * @param p_parent            the parent of the subtree, or null IF the subtree is the binary tree
+ * @param pp_binary_tree_node the link to the subtree
+ * @param quantity            the quantity of nodes in the subtree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_scapegoat_rebuild ( binary_tree *p_binary_tree, binary_tree_node *p_parent, binary_tree_node **pp_binary_tree_node, size_t quantity );
+
+// Function definitions
+int binary_tree_create ( binary_tree **pp_binary_tree )
+{
+
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Initialized data
+    binary_tree *p_binary_tree = TREE_REALLOC(0, sizeof(binary_tree));
+
+    // Error checking
+    if ( p_binary_tree == (void *) 0 ) goto no_mem;
+
+    // Zero set the memory
+    memset(p_binary_tree, 0, sizeof(binary_tree));
+
+    // Return a pointer to the caller
+    *pp_binary_tree = p_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_slab_create ( binary_tree *p_binary_tree )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Initialized data
+    binary_tree_slab *p_slab = TREE_REALLOC(0, sizeof(binary_tree_slab) + TREE_CACHE_LINE_SIZE + ( BINARY_TREE_SLAB_NODE_QUANTITY * sizeof(binary_tree_node) ));
+    uintptr_t         first  = 0;
+
+    // Error checking
+    if ( p_slab == (void *) 0 ) goto no_mem;
+
+    // Chain the slab to the previous slab. The new slab takes the tree's 
+    // reference to the previous slab, and the tree holds the new slab
+    *p_slab = (binary_tree_slab)
+    {
+        .p_next     = p_binary_tree->allocator.p_slabs,
+        .p_adopted  = (void *) 0,
+        .references = 1
+    };
+
+    // Align the first node to a cache line
+    first = ( (uintptr_t) p_slab + sizeof(binary_tree_slab) + ( TREE_CACHE_LINE_SIZE - 1 ) ) & ~( (uintptr_t) TREE_CACHE_LINE_SIZE - 1 );
+
+    // Update the allocator
+    p_binary_tree->allocator.p_slabs = p_slab;
+    p_binary_tree->allocator.p_next  = (binary_tree_node *) first;
+    p_binary_tree->allocator.p_end   = p_binary_tree->allocator.p_next + BINARY_TREE_SLAB_NODE_QUANTITY;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_slab_release ( binary_tree_slab *p_binary_tree_slab )
+{
+
+    // Walk the chain
+    while ( p_binary_tree_slab )
+    {
+
+        // Initialized data
+        binary_tree_slab *p_next = p_binary_tree_slab->p_next;
+
+        // Done IF another reference holds the rest of the chain
+        if ( __atomic_sub_fetch(&p_binary_tree_slab->references, 1, __ATOMIC_ACQ_REL) ) break;
+
+        // Release the adopted chain
+        binary_tree_slab_release(p_binary_tree_slab->p_adopted);
+
+        // Free the slab
+        p_binary_tree_slab = TREE_REALLOC(p_binary_tree_slab, 0);
+
+        // Advance to the next slab
+        p_binary_tree_slab = p_next;
+    }
+
+    // Success
+    return 1;
+}
+
+size_t binary_tree_slab_count ( const binary_tree_slab *p_binary_tree_slab )
+{
+
+    // Initialized data
+    size_t slabs = 0;
+
+    // Walk the chain
+    for (; p_binary_tree_slab; p_binary_tree_slab = p_binary_tree_slab->p_next)
+
+        // Count the adopted chain IF the slab only links it ELSE count the slab
+        slabs += ( p_binary_tree_slab->p_adopted ) ? binary_tree_slab_count(p_binary_tree_slab->p_adopted) : 1;
+
+    // Done
+    return slabs;
+}
+
+int binary_tree_slab_adopt ( binary_tree *p_binary_tree, binary_tree *p_other )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or p_other
+    //       is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_tree_node *p_free_list = p_other->allocator.p_free_list;
+
+    // Take the other binary tree's chain IF the binary tree has no slabs
+    if ( p_binary_tree->allocator.p_slabs == (void *) 0 )
+        p_binary_tree->allocator.p_slabs = p_other->allocator.p_slabs;
+
+    // Link both chains to a new slab, which holds no nodes of its own
+    else if ( p_other->allocator.p_slabs )
+    {
+
+        // Initialized data
+        binary_tree_slab *p_slab = TREE_REALLOC(0, sizeof(binary_tree_slab));
+
+        // Error check
+        if ( p_slab == (void *) 0 ) goto no_mem;
+
+        // Take both references
+        *p_slab = (binary_tree_slab)
+        {
+            .p_next     = p_binary_tree->allocator.p_slabs,
+            .p_adopted  = p_other->allocator.p_slabs,
+            .references = 1
+        };
+
+        // Store the slab
+        p_binary_tree->allocator.p_slabs = p_slab;
+    }
+
+    // The other binary tree no longer holds its slabs
+    p_other->allocator.p_slabs = (void *) 0;
+
+    // Append the binary tree's free list to the other binary tree's free list
+    if ( p_free_list )
+    {
+
+        // Find the last free node
+        while ( p_free_list->p_left ) p_free_list = p_free_list->p_left;
+
+        // Append the free list
+        p_free_list->p_left = p_binary_tree->allocator.p_free_list;
+
+        // Store the free list
+        p_binary_tree->allocator.p_free_list = p_other->allocator.p_free_list;
+    }
+
+    // The other binary tree can no longer allocate from its slabs
+    p_other->allocator.p_free_list = (void *) 0;
+    p_other->allocator.p_next      = (void *) 0;
+    p_other->allocator.p_end       = (void *) 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_node_create ( binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node )
+{
+
+    // Argument check
+    if ( p_binary_tree       == (void *) 0 ) goto no_binary_tree;
+    if ( pp_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
+
+    // Initialized data
+    binary_tree_node *p_binary_tree_node = p_binary_tree->allocator.p_free_list;
+
+    // Reuse a node from the free list
+    if ( p_binary_tree_node )
+    {
+
+        // Pop the node from the free list
+        p_binary_tree->allocator.p_free_list = p_binary_tree_node->p_left;
+
+        // Zero set the memory, but keep the node pointer
+        *p_binary_tree_node = (binary_tree_node)
+        {
+            .node_pointer = p_binary_tree_node->node_pointer
+        };
+    }
+
+    // Carve a node from the current slab
+    else
+    {
+
+        // Allocate a new slab if the current slab is exhausted
+        if ( p_binary_tree->allocator.p_next == p_binary_tree->allocator.p_end )
+            if ( binary_tree_slab_create(p_binary_tree) == 0 ) goto failed_to_allocate_slab;
+
+        // Take the next node
+        p_binary_tree_node = p_binary_tree->allocator.p_next++;
+
+        // Zero set the memory, and store the node pointer
+        *p_binary_tree_node = (binary_tree_node)
+        {
+            .node_pointer = p_binary_tree->allocator.next_node_pointer++
+        };
+    }
+
+    // The node belongs to the current generation
+    BINARY_TREE_NODE_STAMP(p_binary_tree, p_binary_tree_node);
+
+    // Return a pointer to the caller
+    *pp_binary_tree_node = p_binary_tree_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_binary_tree_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_slab:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node slab in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_node_allocate ( binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node )
+{
+
+    // Argument check
+    if ( p_binary_tree       == (void *) 0 ) goto no_binary_tree;
+    if ( pp_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
+    
+    // Initialized data
+    binary_tree_node *p_binary_tree_node = (void *) 0;
+
+    // Allocate a node
+    if ( binary_tree_node_create(p_binary_tree, &p_binary_tree_node) == 0 ) goto failed_to_allocate_node;
+
+    // A new node is a leaf
+    BINARY_TREE_NODE_SIZE_SET(p_binary_tree_node, 1);
+
+    // Give the node a record in the checkpoint file
+    if ( p_binary_tree->checkpoint.p_path ) binary_tree_checkpoint_slot_acquire(p_binary_tree, p_binary_tree_node);
+
+    // Increment the node quantity
+    p_binary_tree->metadata.node_quantity++;
+
+    // Return a pointer to the caller
+    *pp_binary_tree_node = p_binary_tree_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            no_binary_tree_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree
+        {
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    printf("[tree] Call to function \"binary_tree_node_create\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_read_lock ( const binary_tree *const p_binary_tree )
+{
+
+    // Initialized data
+    int result = 0;
+
+    #ifdef BINARY_TREE_STATS
+        unsigned long long start = binary_tree_stats_time();
+    #endif
+
+    // Shared lock IF reader writer ELSE exclusive lock
+    if ( p_binary_tree->flags & BINARY_TREE_FLAG_READER_WRITER )
+        result = pthread_rwlock_rdlock((pthread_rwlock_t *) &p_binary_tree->_rwlock) == 0;
+    else
+        result = mutex_lock(&p_binary_tree->_lock);
+
+    #ifdef BINARY_TREE_STATS
+
+        // Count the time spent waiting for the lock
+        __atomic_fetch_add(&binary_tree_stats_slot_get(p_binary_tree)->lock_wait_ns, binary_tree_stats_time() - start, __ATOMIC_RELAXED);
+    #endif
+
+    // Done
+    return result;
+}
+
+int binary_tree_write_lock ( const binary_tree *const p_binary_tree )
+{
+
+    // Initialized data
+    int result = 0;
+
+    #ifdef BINARY_TREE_STATS
+        unsigned long long start = binary_tree_stats_time();
+    #endif
+
+    // Exclusive lock
+    if ( p_binary_tree->flags & BINARY_TREE_FLAG_READER_WRITER )
+        result = pthread_rwlock_wrlock((pthread_rwlock_t *) &p_binary_tree->_rwlock) == 0;
+    else
+        result = mutex_lock(&p_binary_tree->_lock);
+
+    #ifdef BINARY_TREE_STATS
+
+        // Count the time spent waiting for the lock
+        __atomic_fetch_add(&binary_tree_stats_slot_get(p_binary_tree)->lock_wait_ns, binary_tree_stats_time() - start, __ATOMIC_RELAXED);
+    #endif
+
+    // Done
+    return result;
+}
+
+int binary_tree_unlock ( const binary_tree *const p_binary_tree )
+{
+
+    // Release the reader writer lock
+    if ( p_binary_tree->flags & BINARY_TREE_FLAG_READER_WRITER )
+        return pthread_rwlock_unlock((pthread_rwlock_t *) &p_binary_tree->_rwlock) == 0;
+
+    // Release the mutex
+    return mutex_unlock(&p_binary_tree->_lock);
+}
+
+int binary_tree_construct ( binary_tree **const pp_binary_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size )
+{
+
+    // Construct a binary tree with the default flags
+    return binary_tree_construct_with_flags(pp_binary_tree, pfn_is_equal, pfn_key_accessor, node_size, BINARY_TREE_FLAG_NONE);
+}
+
+int binary_tree_construct_with_flags ( binary_tree **const pp_binary_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size, int flags )
+{
+
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Subtree sizes are only stored IF order statistics are built in
+    #ifndef BINARY_TREE_ORDER_STATISTICS
+        if ( flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) goto no_order_statistics;
+    #endif
+
+    // Initialized data
+    binary_tree *p_binary_tree = TREE_REALLOC(0, sizeof(binary_tree));
+
+    // Error checking
+    if ( p_binary_tree == (void *) 0 ) goto failed_to_allocate_binary_tree;
+
+    // Populate the binary tree structure
+    *p_binary_tree = (binary_tree)
+    {
+        .flags     = flags,
+        .p_root    = (void *) 0,
+        .functions =
+        {
+            .pfn_is_equal     = (pfn_is_equal)     ? pfn_is_equal     : tree_compare_function,
+            .pfn_key_accessor = (pfn_key_accessor) ? pfn_key_accessor : tree_key_is_value
+        },
+        .metadata =
+        {
+            .node_quantity = 0,
+            .node_size     = node_size + ( 2 * sizeof(unsigned long long) )
+        }
+    };
+
+    // Construct a reader writer lock
+    if ( flags & BINARY_TREE_FLAG_READER_WRITER )
+    {
+
+        // Error check
+        if ( pthread_rwlock_init(&p_binary_tree->_rwlock, (void *) 0) != 0 ) goto failed_to_create_lock;
+    }
+
+    // Construct a lock
+    else mutex_create(&p_binary_tree->_lock);
+
+    // Return a pointer to the caller
+    *pp_binary_tree = p_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            #ifndef BINARY_TREE_ORDER_STATISTICS
+                no_order_statistics:
+                    #ifndef NDEBUG
+                        printf("[tree] [binary] BINARY_TREE_FLAG_ORDER_STATISTICS requires a build with BINARY_TREE_ORDER_STATISTICS in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Error
+                    return 0;
+            #endif
+        }
+
+        // Sync errors
+        {
+            failed_to_create_lock:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to create reader writer lock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the binary tree
+                p_binary_tree = TREE_REALLOC(p_binary_tree, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+binary_tree_node *binary_tree_construct_balanced_recursive ( binary_tree *p_binary_tree, void **pp_values, size_t start, size_t end )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, pp_keys, 
+    //       and/or pp_values is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_tree_node *p_binary_tree_node = (void *) 0;
+    size_t            median             = start + ( ( end - start ) / 2 );
+
+    // Base case
+    if ( start >= end ) return (void *) 0;
+
+    // Allocate a binary tree node
+    if ( binary_tree_node_allocate(p_binary_tree, &p_binary_tree_node) == 0 ) goto failed_to_allocate_node;
+
+    // Store the value
+    p_binary_tree_node->p_value = pp_values[median];
+
+    // Construct the left
+    p_binary_tree_node->p_left = binary_tree_construct_balanced_recursive(p_binary_tree, pp_values, start, median);
+
+    // Error check
+    if ( median > start && p_binary_tree_node->p_left == (void *) 0 ) return (void *) 0;
+
+    // Construct the right
+    p_binary_tree_node->p_right = binary_tree_construct_balanced_recursive(p_binary_tree, pp_values, median + 1, end);
+
+    // Error check
+    if ( end > median + 1 && p_binary_tree_node->p_right == (void *) 0 ) return (void *) 0;
+
+    // Store the size of the subtree
+    BINARY_TREE_NODE_SIZE_SET(p_binary_tree_node, end - start);
+
+    // Done
+    return p_binary_tree_node;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_construct_balanced ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal,  fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size )
+{
+
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pp_values == (void *) 0 && property_quantity ) goto no_values;
+
+    // Initialized data
+    binary_tree *p_binary_tree = (void *) 0;
+
+    // Construct an empty binary tree
+    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_key_accessor, node_size) == 0 ) goto failed_to_allocate_binary_tree;
+
+    // Recursively construct a binary search tree, and store the root
+    p_binary_tree->p_root = binary_tree_construct_balanced_recursive(p_binary_tree, pp_values, 0, property_quantity);
+
+    // Error check
+    if ( property_quantity && p_binary_tree->p_root == (void *) 0 ) goto failed_to_construct_binary_tree;
+
+    // Return a pointer to the caller
+    *pp_binary_tree = p_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_values:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_values\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct balanced binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the binary tree
+                binary_tree_destroy(&p_binary_tree);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_construct_balanced_parallel ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size, size_t thread_quantity )
+{
+
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pp_values == (void *) 0 && property_quantity ) goto no_values;
+
+    // Initialized data
+    binary_tree               *p_binary_tree = (void *) 0;
+    binary_tree_construct_job  _job          = { .pp_values = pp_values };
+    pthread_t                 *p_threads     = (void *) 0;
+    size_t                     threads       = 0,
+                               started       = 0;
+
+    // Construct an empty binary tree
+    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_key_accessor, node_size) == 0 ) goto failed_to_allocate_binary_tree;
+
+    // Fast exit
+    if ( property_quantity == 0 ) goto done;
+
+    // Reserve every node
+    if ( binary_tree_construct_balanced_reserve(p_binary_tree, &_job, property_quantity) == 0 ) goto failed_to_allocate_node;
+
+    // Link the top of the binary tree, and split the rest into subtrees
+    if ( binary_tree_construct_balanced_plan(&_job, 0, property_quantity, 0) == 0 ) goto failed_to_plan;
+
+    // Use one thread per processor by default
+    if ( thread_quantity == 0 ) thread_quantity = (size_t) sysconf(_SC_NPROCESSORS_ONLN);
+
+    // Clamp the quantity of threads to [ 1, task_quantity ]
+    threads = ( thread_quantity == 0 ) ? 1 : ( thread_quantity > _job.task_quantity ) ? _job.task_quantity : thread_quantity;
+
+    // Allocate memory for the threads
+    p_threads = TREE_REALLOC(0, threads * sizeof(pthread_t));
+
+    // Error check
+    if ( p_threads == (void *) 0 ) goto no_mem;
+
+    // Start the worker threads. IF a thread fails to start, the other threads 
+    // take its subtrees
+    while ( started + 1 < threads && pthread_create(&p_threads[started], (void *) 0, binary_tree_construct_balanced_worker, &_job) == 0 ) started++;
+
+    // Construct subtrees on this thread
+    binary_tree_construct_balanced_worker(&_job);
+
+    // Wait for the worker threads
+    for (size_t i = 0; i < started; i++) pthread_join(p_threads[i], (void *) 0);
+
+    // The root node is the first node in pre order
+    p_binary_tree->p_root = BINARY_TREE_CONSTRUCT_NODE(&_job, 0);
+
+    // Store the quantity of nodes
+    p_binary_tree->metadata.node_quantity = property_quantity;
+
+    // Clean up
+    _job.pp_slab_nodes = TREE_REALLOC(_job.pp_slab_nodes, 0);
+    _job.p_tasks       = TREE_REALLOC(_job.p_tasks, 0);
+    p_threads          = TREE_REALLOC(p_threads, 0);
+
+    done:
+
+    // Return a pointer to the caller
+    *pp_binary_tree = p_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_values:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_values\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree nodes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+
+            failed_to_plan:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to split balanced binary tree into tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        clean_up:
+
+            // Release the slab table, and the tasks
+            if ( _job.pp_slab_nodes ) _job.pp_slab_nodes = TREE_REALLOC(_job.pp_slab_nodes, 0);
+            if ( _job.p_tasks       ) _job.p_tasks       = TREE_REALLOC(_job.p_tasks, 0);
+
+            // Release the binary tree, and every slab with it
+            binary_tree_destroy(&p_binary_tree);
+
+            // Error
+            return 0;
+    }
+}
+
+int binary_tree_construct_balanced_reserve ( binary_tree *p_binary_tree, binary_tree_construct_job *p_binary_tree_construct_job, size_t quantity )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       p_binary_tree_construct_job is null, or if the binary tree has 
+    //       nodes. Check your parameters before you call.
+
+    // Initialized data
+    size_t slabs = ( quantity + BINARY_TREE_SLAB_NODE_QUANTITY - 1 ) / BINARY_TREE_SLAB_NODE_QUANTITY;
+
+    // Allocate memory for the first node of each slab
+    p_binary_tree_construct_job->pp_slab_nodes = TREE_REALLOC(0, slabs * sizeof(binary_tree_node *));
+
+    // Error check
+    if ( p_binary_tree_construct_job->pp_slab_nodes == (void *) 0 ) goto no_mem;
+
+    // Allocate each slab, and store its first node
+    for (size_t i = 0; i < slabs; i++)
+    {
+
+        // Allocate a slab
+        if ( binary_tree_slab_create(p_binary_tree) == 0 ) goto failed_to_allocate_slab;
+
+        // Store the first node
+        p_binary_tree_construct_job->pp_slab_nodes[i] = p_binary_tree->allocator.p_next;
+    }
+
+    // Later inserts carve the nodes after the binary tree in the last slab
+    p_binary_tree->allocator.p_next            = p_binary_tree_construct_job->pp_slab_nodes[slabs - 1] + ( quantity - ( ( slabs - 1 ) * BINARY_TREE_SLAB_NODE_QUANTITY ) );
+    p_binary_tree->allocator.next_node_pointer = quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_allocate_slab:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node slab in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_construct_balanced_link ( binary_tree_construct_job *p_binary_tree_construct_job, size_t start, size_t end, size_t offset )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree_construct_job
+    //       is null, or if start >= end. Check your parameters before you call.
+
+    // Initialized data
+    size_t median = start + ( ( end - start ) / 2 );
+
+    // Write the node. The left subtree's root follows the node in pre order, 
+    // and the right subtree's root follows the left subtree
+    *BINARY_TREE_CONSTRUCT_NODE(p_binary_tree_construct_job, offset) = (binary_tree_node)
+    {
+        .p_value      = p_binary_tree_construct_job->pp_values[median],
+        .p_left       = ( median > start      ) ? BINARY_TREE_CONSTRUCT_NODE(p_binary_tree_construct_job, offset + 1)                      : (void *) 0,
+        .p_right      = ( end    > median + 1 ) ? BINARY_TREE_CONSTRUCT_NODE(p_binary_tree_construct_job, offset + 1 + ( median - start )) : (void *) 0,
+        .node_pointer = offset
+    };
+
+    // Store the size of the subtree
+    BINARY_TREE_NODE_SIZE_SET(BINARY_TREE_CONSTRUCT_NODE(p_binary_tree_construct_job, offset), end - start);
+
+    // Success
+    return 1;
+}
+
+int binary_tree_construct_balanced_fill ( binary_tree_construct_job *p_binary_tree_construct_job, size_t start, size_t end, size_t offset )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree_construct_job
+    //       is null. Check your parameters before you call.
+
+    // Initialized data
+    size_t median = start + ( ( end - start ) / 2 );
+
+    // Base case
+    if ( start >= end ) return 1;
+
+    // Write the node
+    binary_tree_construct_balanced_link(p_binary_tree_construct_job, start, end, offset);
+
+    // Write the left subtree, and the right subtree
+    return binary_tree_construct_balanced_fill(p_binary_tree_construct_job, start, median, offset + 1) &&
+           binary_tree_construct_balanced_fill(p_binary_tree_construct_job, median + 1, end, offset + 1 + ( median - start ));
+}
+
+int binary_tree_construct_balanced_plan ( binary_tree_construct_job *p_binary_tree_construct_job, size_t start, size_t end, size_t offset )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree_construct_job
+    //       is null. Check your parameters before you call.
+
+    // Initialized data
+    size_t median = start + ( ( end - start ) / 2 );
+
+    // Base case
+    if ( start >= end ) return 1;
+
+    // Add a task for a small subtree
+    if ( end - start <= BINARY_TREE_CONSTRUCT_PARALLEL_CUTOFF )
+    {
+
+        // Grow the tasks
+        if ( p_binary_tree_construct_job->task_quantity == p_binary_tree_construct_job->task_capacity )
+        {
+
+            // Initialized data
+            size_t                      capacity = ( p_binary_tree_construct_job->task_capacity ) ? p_binary_tree_construct_job->task_capacity * 2 : 64;
+            binary_tree_construct_task *p_tasks  = TREE_REALLOC(p_binary_tree_construct_job->p_tasks, capacity * sizeof(binary_tree_construct_task));
+
+            // Error check
+            if ( p_tasks == (void *) 0 ) goto no_mem;
+
+            // Update the tasks
+            p_binary_tree_construct_job->p_tasks       = p_tasks;
+            p_binary_tree_construct_job->task_capacity = capacity;
+        }
+
+        // Add the task
+        p_binary_tree_construct_job->p_tasks[p_binary_tree_construct_job->task_quantity++] = (binary_tree_construct_task)
+        {
+            .start  = start,
+            .end    = end,
+            .offset = offset
+        };
+
+        // Success
+        return 1;
+    }
+
+    // Write the node
+    binary_tree_construct_balanced_link(p_binary_tree_construct_job, start, end, offset);
+
+    // Split the left subtree, and the right subtree
+    return binary_tree_construct_balanced_plan(p_binary_tree_construct_job, start, median, offset + 1) &&
+           binary_tree_construct_balanced_plan(p_binary_tree_construct_job, median + 1, end, offset + 1 + ( median - start ));
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void *binary_tree_construct_balanced_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    binary_tree_construct_job *p_job = p_parameter;
+
+    // Take subtrees until none are left
+    for (;;)
+    {
+
+        // Initialized data
+        size_t i = __atomic_fetch_add(&p_job->next_task, 1, __ATOMIC_RELAXED);
+
+        // Done
+        if ( i >= p_job->task_quantity ) break;
+
+        // Write the subtree
+        binary_tree_construct_balanced_fill(p_job, p_job->p_tasks[i].start, p_job->p_tasks[i].end, p_job->p_tasks[i].offset);
+    }
+
+    // Done
+    return (void *) 0;
+}
+
+int binary_tree_construct_from_unsorted ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size, size_t thread_quantity )
+{
+
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pp_values == (void *) 0 && property_quantity ) goto no_values;
+
+    // Initialized data
+    binary_tree_sort_task  *p_tasks        = (void *) 0;
+    pthread_t              *p_threads      = (void *) 0;
+    void                  **pp_sorted      = (void *) 0;
+    size_t                  threads        = 0,
+                            runs           = 0,
+                            value_quantity = 0;
+
+    // Fast exit
+    if ( property_quantity == 0 ) return binary_tree_construct_balanced_parallel(pp_binary_tree, pp_values, 0, pfn_is_equal, pfn_key_accessor, node_size, thread_quantity);
+
+    // Use the default comparator and key accessor, like binary_tree_construct
+    if ( pfn_is_equal     == (void *) 0 ) pfn_is_equal     = tree_compare_function;
+    if ( pfn_key_accessor == (void *) 0 ) pfn_key_accessor = tree_key_is_value;
+
+    // Use one thread per processor by default
+    if ( thread_quantity == 0 ) thread_quantity = (size_t) sysconf(_SC_NPROCESSORS_ONLN);
+
+    // Clamp the quantity of threads to [ 1, property_quantity ]
+    threads = ( thread_quantity == 0 ) ? 1 : ( thread_quantity > property_quantity ) ? property_quantity : thread_quantity;
+
+    // Allocate memory for the sorted values, and the scratch values
+    pp_sorted = TREE_REALLOC(0, 2 * property_quantity * sizeof(void *));
+    p_tasks   = TREE_REALLOC(0, threads * sizeof(binary_tree_sort_task));
+    p_threads = TREE_REALLOC(0, threads * sizeof(pthread_t));
+
+    // Error check
+    if ( pp_sorted == (void *) 0 || p_tasks == (void *) 0 || p_threads == (void *) 0 ) goto no_mem;
+
+    // Copy the values. The caller's list is not changed
+    memcpy(pp_sorted, pp_values, property_quantity * sizeof(void *));
+
+    // Split the values into one contiguous run per thread
+    for (size_t i = 0; i < threads; i++)
+        p_tasks[i] = (binary_tree_sort_task)
+        {
+            .pp_values        = pp_sorted,
+            .pp_scratch       = &pp_sorted[property_quantity],
+            .pfn_is_equal     = pfn_is_equal,
+            .pfn_key_accessor = pfn_key_accessor,
+            .start            = ( property_quantity * i ) / threads,
+            .middle           = ( property_quantity * ( i + 1 ) ) / threads,
+            .end              = ( property_quantity * ( i + 1 ) ) / threads,
+            .merge            = false,
+            .running          = false
+        };
+
+    // Sort each run
+    binary_tree_sort_run(p_tasks, threads, p_threads);
+
+    // Merge adjacent pairs of runs in parallel, halving the runs each round
+    for (runs = threads; runs > 1; runs = ( runs + 1 ) / 2)
+    {
+
+        // Pair up the runs. An odd run is carried into the next round
+        for (size_t i = 0; i < runs / 2; i++)
+            p_tasks[i] = (binary_tree_sort_task)
+            {
+                .pp_values        = pp_sorted,
+                .pp_scratch       = &pp_sorted[property_quantity],
+                .pfn_is_equal     = pfn_is_equal,
+                .pfn_key_accessor = pfn_key_accessor,
+                .start            = p_tasks[2 * i].start,
+                .middle           = p_tasks[2 * i + 1].start,
+                .end              = p_tasks[2 * i + 1].end,
+                .merge            = true,
+                .running          = false
+            };
+
+        // Carry the odd run
+        if ( runs % 2 ) p_tasks[runs / 2] = p_tasks[runs - 1];
+
+        // Merge each pair
+        binary_tree_sort_run(p_tasks, runs / 2, p_threads);
+    }
+
+    // Remove duplicate keys. The sort is stable, so the first value of each 
+    // key in the caller's list is kept, just like binary_tree_insert
+    for (size_t i = 0; i < property_quantity; i++)
+    {
+
+        // Skip a value with the same key as the last value kept
+        if ( value_quantity && pfn_is_equal(pfn_key_accessor(pp_sorted[value_quantity - 1]), pfn_key_accessor(pp_sorted[i])) == 0 ) continue;
+
+        // Keep the value
+        pp_sorted[value_quantity++] = pp_sorted[i];
+    }
+
+    // Construct a balanced binary tree from the sorted values
+    if ( binary_tree_construct_balanced_parallel(pp_binary_tree, pp_sorted, value_quantity, pfn_is_equal, pfn_key_accessor, node_size, thread_quantity) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Clean up
+    pp_sorted = TREE_REALLOC(pp_sorted, 0);
+    p_tasks   = TREE_REALLOC(p_tasks, 0);
+    p_threads = TREE_REALLOC(p_threads, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_values:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_values\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct balanced binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        clean_up:
+
+            // Release the sorted values, the tasks, and the threads
+            if ( pp_sorted ) pp_sorted = TREE_REALLOC(pp_sorted, 0);
+            if ( p_tasks   ) p_tasks   = TREE_REALLOC(p_tasks, 0);
+            if ( p_threads ) p_threads = TREE_REALLOC(p_threads, 0);
+
+            // Error
+            return 0;
+    }
+}
+
+int binary_tree_sort_values ( const binary_tree_sort_task *p_binary_tree_sort_task, size_t start, size_t end )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree_sort_task 
+    //       is null. Check your parameters before you call.
+
+    // Initialized data
+    void                 **pp_values        = p_binary_tree_sort_task->pp_values;
+    fn_tree_equal         *pfn_is_equal     = p_binary_tree_sort_task->pfn_is_equal;
+    fn_tree_key_accessor  *pfn_key_accessor = p_binary_tree_sort_task->pfn_key_accessor;
+    size_t                 middle           = start + ( ( end - start ) / 2 );
+
+    // Sort a short range by insertion
+    if ( end - start <= BINARY_TREE_SORT_INSERTION_QUANTITY )
+    {
+
+        // Insert each value into the sorted values before it
+        for (size_t i = start + 1; i < end; i++)
+        {
+
+            // Initialized data
+            void   *p_value = pp_values[i];
+            size_t  j       = i;
+
+            // Shift each greater value up
+            while ( j > start && pfn_is_equal(pfn_key_accessor(pp_values[j - 1]), pfn_key_accessor(p_value)) < 0 )
+                pp_values[j] = pp_values[j - 1], j--;
+
+            // Store the value
+            pp_values[j] = p_value;
+        }
+
+        // Success
+        return 1;
+    }
+
+    // Sort each half
+    binary_tree_sort_values(p_binary_tree_sort_task, start, middle);
+    binary_tree_sort_values(p_binary_tree_sort_task, middle, end);
+
+    // Merge the halves
+    return binary_tree_sort_merge(p_binary_tree_sort_task, start, middle, end);
+}
+
+int binary_tree_sort_merge ( const binary_tree_sort_task *p_binary_tree_sort_task, size_t start, size_t middle, size_t end )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree_sort_task 
+    //       is null. Check your parameters before you call.
+
+    // Initialized data
+    void                 **pp_values        = p_binary_tree_sort_task->pp_values,
+                         **pp_scratch       = p_binary_tree_sort_task->pp_scratch;
+    fn_tree_equal         *pfn_is_equal     = p_binary_tree_sort_task->pfn_is_equal;
+    fn_tree_key_accessor  *pfn_key_accessor = p_binary_tree_sort_task->pfn_key_accessor;
+    size_t                 i                = start,
+                           j                = middle,
+                           k                = start;
+
+    // Fast exit. The halves are already in order
+    if ( start == middle || middle == end || pfn_is_equal(pfn_key_accessor(pp_values[middle - 1]), pfn_key_accessor(pp_values[middle])) >= 0 ) return 1;
+
+    // Take the lesser value of each half. On equal keys, take the first half's value
+    while ( i < middle && j < end )
+        pp_scratch[k++] = ( pfn_is_equal(pfn_key_accessor(pp_values[i]), pfn_key_accessor(pp_values[j])) >= 0 ) ? pp_values[i++] : pp_values[j++];
+
+    // Take the rest of the first half. The rest of the second half is in place
+    while ( i < middle ) pp_scratch[k++] = pp_values[i++];
+
+    // Copy the merged values back
+    memcpy(&pp_values[start], &pp_scratch[start], ( k - start ) * sizeof(void *));
+
+    // Success
+    return 1;
+}
+
+void *binary_tree_sort_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    binary_tree_sort_task *p_task = p_parameter;
+
+    // Merge the halves of the range
+    if ( p_task->merge ) binary_tree_sort_merge(p_task, p_task->start, p_task->middle, p_task->end);
+
+    // Sort the range
+    else binary_tree_sort_values(p_task, p_task->start, p_task->end);
+
+    // Done
+    return (void *) 0;
+}
+
+int binary_tree_sort_run ( binary_tree_sort_task *p_binary_tree_sort_tasks, size_t task_quantity, pthread_t *p_threads )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree_sort_tasks,
+    //       or p_threads is null. Check your parameters before you call.
+
+    // Start a thread for each task after the first
+    for (size_t i = 1; i < task_quantity; i++)
+        p_binary_tree_sort_tasks[i].running = ( pthread_create(&p_threads[i], (void *) 0, binary_tree_sort_worker, &p_binary_tree_sort_tasks[i]) == 0 );
+
+    // Run the first task
+    if ( task_quantity ) binary_tree_sort_worker(&p_binary_tree_sort_tasks[0]);
+
+    // Wait for the threads, and run the tasks whose threads failed to start
+    for (size_t i = 1; i < task_quantity; i++)
+    {
+
+        // Wait for the thread
+        if ( p_binary_tree_sort_tasks[i].running ) pthread_join(p_threads[i], (void *) 0);
+
+        // Run the task
+        else binary_tree_sort_worker(&p_binary_tree_sort_tasks[i]);
+    }
+
+    // Success
+    return 1;
+}
+
+int binary_tree_search ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Initialized data
+    binary_tree_node *p_node = p_binary_tree->p_root;
+    int comparator_return = 0;
+    unsigned long long comparisons = 0;
+
+    // Search the frozen snapshot
+    if ( p_binary_tree->frozen.p_keys ) goto search_frozen;
+
+    // Search the memory mapped file
+    if ( p_binary_tree->mapped.p_base ) goto search_mapped;
+
+    // Search the file through the record cache
+    if ( p_binary_tree->lazy.p_cache ) goto search_lazy;
+
+    // State check
+    if ( p_node == (void *) 0 ) goto no_root;
+
+    try_again:
+
+    // Count the comparison
+    BINARY_TREE_STATS_COMPARE(comparisons);
+
+    // Which side? 
+    comparator_return = p_binary_tree->functions.pfn_is_equal
+    (
+        p_binary_tree->functions.pfn_key_accessor( p_node->p_value ),
+        p_key
+    );
+
+    // Search the left node
+    if ( comparator_return < 0 )
+    {
+
+        // If the left node exists ...
+        if ( p_node->p_left )
+        {
+
+            // ... update the state ...
+            p_node = p_node->p_left;
+
+            // ... and try again
+            goto try_again;
+        }
+
+        // Count the search
+        BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_SEARCH, comparisons);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+        
+        // Error
+        return 0;
+    }
+
+    // Search the right node
+    else if ( comparator_return > 0 )
+    {
+
+        // If the right node exists ...
+        if ( p_node->p_right )
+        {
+
+            // ... update the state ...
+            p_node = p_node->p_right;
+
+            // ... and try again
+            goto try_again;
+        }
+
+        // Count the search
+        BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_SEARCH, comparisons);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    
+        // Error
+        return 0;
+    }
+
+    // Return a pointer to the caller
+    *pp_value = p_node->p_value;
+
+    // Count the search
+    BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_SEARCH, comparisons);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // This branch runs if there is no root node
+    no_root:
+
+        // Count the search
+        BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_SEARCH, comparisons);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Error
+        return 0;
+
+    // This branch runs if the binary tree is frozen
+    search_frozen:
+    {
+
+        // Initialized data
+        int result = binary_tree_search_frozen(p_binary_tree, p_key, pp_value);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Done
+        return result;
+    }
+
+    // This branch runs if the binary tree is memory mapped
+    search_mapped:
+    {
+
+        // Initialized data
+        int result = binary_tree_search_mapped(p_binary_tree, p_key, pp_value);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Done
+        return result;
+    }
+
+    // This branch runs if the binary tree is lazy
+    search_lazy:
+    {
+
+        // Initialized data
+        int result = binary_tree_search_lazy(p_binary_tree, p_key, pp_value);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Done
+        return result;
+    }
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_insert ( binary_tree *const p_binary_tree, const void *const p_value )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Lock
+    binary_tree_write_lock(p_binary_tree);
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto read_only;
+
+    // Discard the frozen snapshot
+    binary_tree_thaw(p_binary_tree);
+
+    // Initialized data
+    binary_tree_node **pp_node = &p_binary_tree->p_root;
+    binary_tree_node *p_node = p_binary_tree->p_root;
+    int comparator_return = 0;
+    unsigned long long comparisons = 0;
+    bool scapegoat = p_binary_tree->flags & BINARY_TREE_FLAG_SCAPEGOAT;
+    size_t depth = 0;
+
+    // State check
+    if ( p_binary_tree->p_root == (void *) 0 ) goto no_root;
+
+    try_again:
+
+    // Copy the node IF a snapshot shares it
+    if ( binary_tree_node_writable(p_binary_tree, pp_node) == 0 ) goto failed_to_copy_binary_tree_node;
+
+    // Store the node
+    p_node = *pp_node;
+
+    // Count the comparison
+    BINARY_TREE_STATS_COMPARE(comparisons);
+
+    // Which side? 
+    comparator_return = p_binary_tree->functions.pfn_is_equal
+    (
+        p_binary_tree->functions.pfn_key_accessor(p_node->p_value),
+        p_binary_tree->functions.pfn_key_accessor(p_value)
+    );
+
+    // The node will gain a descendant, unless the value is a duplicate
+    if ( comparator_return != 0 && ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) ) BINARY_TREE_NODE_SIZE_ADD(p_node, 1);
+
+    // Store the node on the insert path
+    if ( scapegoat && binary_tree_scapegoat_push(p_binary_tree, depth++, p_node) == 0 ) goto failed_to_allocate_binary_tree_node;
+
+    // Store the node on the left 
+    if ( comparator_return < 0 )
+    {
+
+        // If the left node is occupied ...
+        if ( p_node->p_left )
+        {
+
+            // ... update the state ...
+            pp_node = &p_node->p_left;
+
+            // ... and try again
+            goto try_again;
+        }
+
+        // Construct a binary tree node
+        if ( binary_tree_node_allocate(p_binary_tree, &p_node->p_left) == 0 ) goto failed_to_allocate_binary_tree_node;
+
+        // Store the value
+        p_node->p_left->p_value = (void *) p_value;
+
+        // Mark the changed records
+        binary_tree_checkpoint_mark(p_binary_tree, p_node);
+        binary_tree_checkpoint_mark(p_binary_tree, p_node->p_left);
+
+        // Rebuild the scapegoat IF the new node is too deep
+        if ( scapegoat && binary_tree_scapegoat_insert(p_binary_tree, p_node->p_left, depth) == 0 ) goto failed_to_rebalance;
+    }
+
+    // Store the node on the right
+    else if ( comparator_return > 0 )
+    {
+
+        // If the left node is occupied ...
+        if ( p_node->p_right )
+        {
+
+            // ... update the state ...
+            pp_node = &p_node->p_right;
+
+            // ... and try again
+            goto try_again;
+        }
+
+        // Construct a binary tree node
+        if ( binary_tree_node_allocate(p_binary_tree, &p_node->p_right) == 0 ) goto failed_to_allocate_binary_tree_node;
+
+        // Store the value
+        p_node->p_right->p_value = (void *) p_value;
+
+        // Mark the changed records
+        binary_tree_checkpoint_mark(p_binary_tree, p_node);
+        binary_tree_checkpoint_mark(p_binary_tree, p_node->p_right);
+
+        // Rebuild the scapegoat IF the new node is too deep
+        if ( scapegoat && binary_tree_scapegoat_insert(p_binary_tree, p_node->p_right, depth) == 0 ) goto failed_to_rebalance;
+    }
+
+    // The value is a duplicate. Undo the subtree size updates
+    else if ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS )
+        binary_tree_order_statistics_update(p_binary_tree, p_binary_tree->functions.pfn_key_accessor(p_value), -1);
+
+    // Count the insert
+    BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_INSERT, comparisons);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // This branch runs if there is no root node
+    no_root:
+    {
+
+        // Initialized data
+        p_node = (void *) 0;
+
+        // Construct a binary tree node
+        if ( binary_tree_node_allocate(p_binary_tree, &p_node) == 0 ) goto failed_to_allocate_binary_tree_node;
+
+        // Store the value
+        p_node->p_value = (void *) p_value;
+
+        // Store the node as the root of the tree
+        p_binary_tree->p_root = p_node;
+
+        // Mark the changed record
+        binary_tree_checkpoint_mark(p_binary_tree, p_node);
+
+        // Track the largest size of the binary tree
+        if ( scapegoat ) binary_tree_scapegoat_insert(p_binary_tree, p_node, 0);
+
+        // Count the insert
+        BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_INSERT, comparisons);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+        
+        // Success
+        return 1;
+    }
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            read_only:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+
+            failed_to_copy_binary_tree_node:
+            failed_to_allocate_binary_tree_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Undo the subtree size updates
+                if ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS )
+                    binary_tree_order_statistics_update(p_binary_tree, p_binary_tree->functions.pfn_key_accessor(p_value), -1);
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+                
+                // Error
+                return 0;
+
+            failed_to_rebalance:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to rebuild scapegoat in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_remove ( binary_tree *const p_binary_tree, const void *const p_key, const void **const pp_value )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Lock
+    binary_tree_write_lock(p_binary_tree);
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto read_only;
+
+    // Discard the frozen snapshot
+    binary_tree_thaw(p_binary_tree);
+
+    // Initialized data
+    binary_tree_node   **pp_node           = &p_binary_tree->p_root,
+                        *p_node            = (void *) 0,
+                        *p_parent          = (void *) 0;
+    bool                 order_statistics  = p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS;
+    int                  comparator_return = 0;
+    unsigned long long   comparisons       = 0;
+
+    // Find the link to the node
+    while ( *pp_node )
+    {
+
+        // Copy the node IF a snapshot shares it
+        if ( binary_tree_node_writable(p_binary_tree, pp_node) == 0 ) goto failed_to_copy_binary_tree_node;
+
+        // Count the comparison
+        BINARY_TREE_STATS_COMPARE(comparisons);
+
+        // Which side? 
+        comparator_return = p_binary_tree->functions.pfn_is_equal
+        (
+            p_binary_tree->functions.pfn_key_accessor((*pp_node)->p_value),
+            p_key
+        );
+
+        // Found
+        if ( comparator_return == 0 ) break;
+
+        // The node will lose a descendant, unless the key is not in the tree
+        if ( order_statistics ) BINARY_TREE_NODE_SIZE_ADD(*pp_node, -1ULL);
+
+        // Store the parent
+        p_parent = *pp_node;
+
+        // Left or right
+        pp_node = ( comparator_return < 0 ) ? &(*pp_node)->p_left : &(*pp_node)->p_right;
+    }
+
+    // State check
+    if ( *pp_node == (void *) 0 ) goto not_found;
+
+    // Store the node
+    p_node = *pp_node;
+
+    // Return a pointer to the caller
+    if ( pp_value ) *pp_value = p_node->p_value;
+
+    // Left AND right
+    if ( p_node->p_left && p_node->p_right )
+    {
+
+        // Initialized data
+        binary_tree_node **pp_successor        = &p_node->p_right,
+                          *p_successor         = (void *) 0,
+                          *p_successor_parent  = p_node;
+
+        // Copy the path to the successor IF a snapshot shares it, before any
+        // subtree size changes
+        for (pp_successor = &p_node->p_right; *pp_successor; pp_successor = &(*pp_successor)->p_left)
+            if ( binary_tree_node_writable(p_binary_tree, pp_successor) == 0 ) goto failed_to_copy_binary_tree_node;
+
+        // Find the successor. Each node on the way loses a descendant
+        for (pp_successor = &p_node->p_right; (*pp_successor)->p_left; )
+        {
+
+            // Update the subtree size
+            if ( order_statistics ) BINARY_TREE_NODE_SIZE_ADD(*pp_successor, -1ULL);
+
+            // Store the successor's parent
+            p_successor_parent = *pp_successor;
+
+            // Go left
+            pp_successor = &(*pp_successor)->p_left;
+        }
+
+        // Unlink the successor
+        p_successor   = *pp_successor;
+        *pp_successor = p_successor->p_right;
+
+        // Put the successor in place of the node
+        p_successor->p_left  = p_node->p_left;
+        p_successor->p_right = p_node->p_right;
+        *pp_node             = p_successor;
+
+        // The successor takes over the node's subtree, less the node
+        BINARY_TREE_NODE_SIZE_SET(p_successor, BINARY_TREE_NODE_SIZE(p_node) - 1);
+
+        // Mark the changed records
+        binary_tree_checkpoint_mark(p_binary_tree, p_successor);
+        if ( p_successor_parent != p_node ) binary_tree_checkpoint_mark(p_binary_tree, p_successor_parent);
+    }
+
+    // Left OR right OR leaf
+    else *pp_node = ( p_node->p_left ) ? p_node->p_left : p_node->p_right;
+
+    // Mark the parent's record
+    if ( p_parent ) binary_tree_checkpoint_mark(p_binary_tree, p_parent);
+
+    // Free the node
+    binary_tree_node_destroy(p_binary_tree, &p_node);
+
+    // Rebuild the binary tree IF it has shrunk too far
+    if ( ( p_binary_tree->flags & BINARY_TREE_FLAG_SCAPEGOAT ) && binary_tree_scapegoat_remove(p_binary_tree) == 0 ) goto failed_to_rebalance;
+
+    // Count the remove
+    BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_REMOVE, comparisons);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // This branch runs if the key is not in the tree
+    not_found:
+
+        // Undo the subtree size updates
+        if ( order_statistics ) binary_tree_order_statistics_update(p_binary_tree, p_key, 1);
+
+        // Count the remove
+        BINARY_TREE_STATS_COUNT(p_binary_tree, BINARY_TREE_STATS_REMOVE, comparisons);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            read_only:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+
+            failed_to_copy_binary_tree_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Undo the subtree size updates
+                if ( order_statistics ) binary_tree_order_statistics_update(p_binary_tree, p_key, 1);
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+
+            failed_to_rebalance:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to rebuild binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_merge ( binary_tree *const p_binary_tree, binary_tree **const pp_other )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pp_other      == (void *) 0 ) goto no_other;
+    if ( *pp_other     == (void *) 0 ) goto no_other;
+    if ( *pp_other     == p_binary_tree ) goto same_binary_tree;
+
+    // Initialized data
+    binary_tree  *p_other         = *pp_other;
+    binary_tree  *p_first         = ( (uintptr_t) p_binary_tree < (uintptr_t) p_other ) ? p_binary_tree : p_other,
+                 *p_second        = ( p_first == p_binary_tree ) ? p_other : p_binary_tree;
+    void        **pp_values       = (void *) 0,
+                **pp_merged       = (void *) 0;
+    size_t        value_quantity  = 0,
+                  other_quantity  = 0,
+                  merged_quantity = 0,
+                  i               = 0,
+                  j               = 0;
+
+    // Lock both binary trees, in address order, so concurrent merges can not deadlock
+    binary_tree_write_lock(p_first);
+    binary_tree_write_lock(p_second);
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache || p_other->mapped.p_base || p_other->lazy.p_cache ) goto read_only;
+    if ( p_other->snapshots.quantity ) goto snapshots_in_use;
+    if ( p_binary_tree->metadata.node_size != p_other->metadata.node_size ) goto incompatible;
+    if ( p_binary_tree->functions.pfn_is_equal != p_other->functions.pfn_is_equal ) goto incompatible;
+    if ( p_binary_tree->functions.pfn_key_accessor != p_other->functions.pfn_key_accessor ) goto incompatible;
+
+    // Discard the frozen snapshots
+    binary_tree_thaw(p_binary_tree);
+    binary_tree_thaw(p_other);
+
+    // Store the quantity of values
+    value_quantity = (size_t) p_binary_tree->metadata.node_quantity;
+    other_quantity = (size_t) p_other->metadata.node_quantity;
+
+    // Allocate memory for the values of both binary trees, and the merged values
+    if ( value_quantity + other_quantity )
+    {
+
+        // Allocate memory for the values
+        pp_values = TREE_REALLOC(0, 2 * ( value_quantity + other_quantity ) * sizeof(void *));
+
+        // Error check
+        if ( pp_values == (void *) 0 ) goto no_mem;
+
+        // The merged values follow the values of both binary trees
+        pp_merged = &pp_values[value_quantity + other_quantity];
+    }
+
+    // Take the other binary tree's nodes
+    if ( binary_tree_slab_adopt(p_binary_tree, p_other) == 0 ) goto failed_to_adopt_slabs;
+
+    // Flatten the binary tree, and return its nodes to its free list
+    binary_tree_merge_flatten(p_binary_tree, p_binary_tree->p_root, pp_values, &i, false);
+
+    // Flatten the other binary tree, and push its nodes onto the binary tree's free list
+    binary_tree_merge_flatten(p_binary_tree, p_other->p_root, pp_values, &i, true);
+
+    // The binary tree is empty
+    p_binary_tree->p_root = (void *) 0;
+
+    // The other binary tree is empty
+    p_other->p_root                 = (void *) 0;
+    p_other->metadata.node_quantity = 0;
+
+    // Merge the values
+    for (i = 0, j = value_quantity; i < value_quantity || j < value_quantity + other_quantity; )
+    {
+
+        // Initialized data
+        int comparator_return = 0;
+
+        // Take the rest of the other binary tree's values
+        if ( i == value_quantity ) { pp_merged[merged_quantity++] = pp_values[j++]; continue; }
+
+        // Take the rest of the binary tree's values
+        if ( j == value_quantity + other_quantity ) { pp_merged[merged_quantity++] = pp_values[i++]; continue; }
+
+        // Compare the smallest value of each binary tree
+        comparator_return = p_binary_tree->functions.pfn_is_equal
+        (
+            p_binary_tree->functions.pfn_key_accessor(pp_values[i]),
+            p_binary_tree->functions.pfn_key_accessor(pp_values[j])
+        );
+
+        // Take the lesser value. IF both binary trees have the key, keep the 
+        // binary tree's value, just like binary_tree_insert
+        if ( comparator_return >= 0 ) pp_merged[merged_quantity++] = pp_values[i++];
+        else                          pp_merged[merged_quantity++] = pp_values[j++];
+
+        // Skip the other binary tree's value
+        if ( comparator_return == 0 ) j++;
+    }
+
+    // Construct a balanced binary tree from the free nodes
+    p_binary_tree->p_root = binary_tree_construct_balanced_recursive(p_binary_tree, pp_merged, 0, merged_quantity);
+
+    // Error check
+    if ( merged_quantity && p_binary_tree->p_root == (void *) 0 ) goto failed_to_construct_binary_tree;
+
+    // Rewrite the whole file at the next checkpoint
+    p_binary_tree->checkpoint.invalid = true;
+
+    // Unlock
+    binary_tree_unlock(p_second);
+    binary_tree_unlock(p_first);
+
+    // Release the other binary tree
+    binary_tree_destroy(pp_other);
+
+    // Clean up
+    if ( pp_values ) pp_values = TREE_REALLOC(pp_values, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_other:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_other\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            same_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Can not merge a binary tree with itself in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            read_only:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            snapshots_in_use:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Parameter \"pp_other\" has live snapshots in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            incompatible:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Binary trees have different node sizes or comparators in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            failed_to_adopt_slabs:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to adopt binary tree nodes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( pp_values ) pp_values = TREE_REALLOC(pp_values, 0);
+
+                // Unlock
+                goto unlock;
+
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct balanced binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( pp_values ) pp_values = TREE_REALLOC(pp_values, 0);
+
+                // Unlock
+                goto unlock;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+        }
+
+        unlock:
+
+            // Unlock
+            binary_tree_unlock(p_second);
+            binary_tree_unlock(p_first);
+
+            // Error
+            return 0;
+    }
+}
+
+int binary_tree_split_at ( binary_tree *const p_binary_tree, const void *const p_key, binary_tree **const pp_binary_tree_right )
+{
+
+    // Argument check
+    if ( p_binary_tree        == (void *) 0 ) goto no_binary_tree;
+    if ( pp_binary_tree_right == (void *) 0 ) goto no_binary_tree_right;
+
+    // Initialized data
+    binary_tree *p_binary_tree_right = (void *) 0;
+
+    // Construct an empty binary tree, like the binary tree
+    if ( binary_tree_construct_with_flags(&p_binary_tree_right, p_binary_tree->functions.pfn_is_equal, p_binary_tree->functions.pfn_key_accessor, p_binary_tree->metadata.node_size - ( 2 * sizeof(unsigned long long) ), p_binary_tree->flags) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Lock
+    binary_tree_write_lock(p_binary_tree);
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto read_only;
+    if ( p_binary_tree->snapshots.quantity ) goto snapshots_in_use;
+
+    // Discard the frozen snapshot
+    binary_tree_thaw(p_binary_tree);
+
+    // Split the nodes
+    binary_tree_split_node(p_binary_tree, p_binary_tree->p_root, p_key, &p_binary_tree->p_root, &p_binary_tree_right->p_root);
+
+    // Share the slabs. The nodes of both binary trees were carved from them
+    if ( p_binary_tree->allocator.p_slabs )
+    {
+
+        // Take a reference to the slabs
+        __atomic_add_fetch(&((binary_tree_slab *) p_binary_tree->allocator.p_slabs)->references, 1, __ATOMIC_RELAXED);
+
+        // Store the slabs
+        p_binary_tree_right->allocator.p_slabs = p_binary_tree->allocator.p_slabs;
+    }
+
+    // Count the nodes of the new binary tree
+    p_binary_tree_right->metadata.node_quantity = ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) ? ( ( p_binary_tree_right->p_root ) ? (size_t) BINARY_TREE_NODE_SIZE(p_binary_tree_right->p_root) : 0 )
+                                                                                                              : binary_tree_node_count(p_binary_tree_right->p_root);
+
+    // Update the node quantity
+    p_binary_tree->metadata.node_quantity -= p_binary_tree_right->metadata.node_quantity;
+
+    // Rewrite the whole file at the next checkpoint
+    p_binary_tree->checkpoint.invalid = true;
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Return a pointer to the caller
+    *pp_binary_tree_right = p_binary_tree_right;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_binary_tree_right:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_right\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            read_only:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+
+            snapshots_in_use:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Parameter \"p_binary_tree\" has live snapshots in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        clean_up:
+
+            // Unlock
+            binary_tree_unlock(p_binary_tree);
+
+            // Release the new binary tree
+            binary_tree_destroy(&p_binary_tree_right);
+
+            // Error
+            return 0;
+    }
+}
+
+int binary_tree_join ( binary_tree *const p_binary_tree, binary_tree **const pp_binary_tree_right )
+{
+
+    // Argument check
+    if ( p_binary_tree         == (void *) 0 ) goto no_binary_tree;
+    if ( pp_binary_tree_right  == (void *) 0 ) goto no_binary_tree_right;
+    if ( *pp_binary_tree_right == (void *) 0 ) goto no_binary_tree_right;
+    if ( *pp_binary_tree_right == p_binary_tree ) goto same_binary_tree;
+
+    // Initialized data
+    binary_tree       *p_binary_tree_right = *pp_binary_tree_right;
+    binary_tree       *p_first             = ( (uintptr_t) p_binary_tree < (uintptr_t) p_binary_tree_right ) ? p_binary_tree : p_binary_tree_right,
+                      *p_second            = ( p_first == p_binary_tree ) ? p_binary_tree_right : p_binary_tree;
+    binary_tree_node **pp_max              = &p_binary_tree->p_root,
+                      *p_min               = (void *) 0,
+                      *p_pivot             = (void *) 0;
+    bool               order_statistics    = p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS;
+
+    // Lock both binary trees, in address order, so concurrent joins can not deadlock
+    binary_tree_write_lock(p_first);
+    binary_tree_write_lock(p_second);
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache || p_binary_tree_right->mapped.p_base || p_binary_tree_right->lazy.p_cache ) goto read_only;
+    if ( p_binary_tree->snapshots.quantity || p_binary_tree_right->snapshots.quantity ) goto snapshots_in_use;
+    if ( p_binary_tree->metadata.node_size != p_binary_tree_right->metadata.node_size ) goto incompatible;
+    if ( p_binary_tree->functions.pfn_is_equal != p_binary_tree_right->functions.pfn_is_equal ) goto incompatible;
+    if ( p_binary_tree->functions.pfn_key_accessor != p_binary_tree_right->functions.pfn_key_accessor ) goto incompatible;
+    if ( ( p_binary_tree->flags ^ p_binary_tree_right->flags ) & BINARY_TREE_FLAG_ORDER_STATISTICS ) goto incompatible;
+
+    // Discard the frozen snapshots
+    binary_tree_thaw(p_binary_tree);
+    binary_tree_thaw(p_binary_tree_right);
+
+    // Check the order of the binary trees
+    if ( p_binary_tree->p_root && p_binary_tree_right->p_root )
+    {
+
+        // Find the greatest node of the binary tree
+        while ( (*pp_max)->p_right ) pp_max = &(*pp_max)->p_right;
+
+        // Find the least node of the right binary tree
+        for (p_min = p_binary_tree_right->p_root; p_min->p_left; p_min = p_min->p_left);
+
+        // Error check
+        if ( p_binary_tree->functions.pfn_is_equal
+        (
+            p_binary_tree->functions.pfn_key_accessor((*pp_max)->p_value),
+            p_binary_tree->functions.pfn_key_accessor(p_min->p_value)
+        ) <= 0 ) goto out_of_order;
+    }
+
+    // Take the right binary tree's nodes
+    if ( binary_tree_slab_adopt(p_binary_tree, p_binary_tree_right) == 0 ) goto failed_to_adopt_slabs;
+
+    // Take the right binary tree IF the binary tree is empty
+    if ( p_binary_tree->p_root == (void *) 0 ) p_binary_tree->p_root = p_binary_tree_right->p_root;
+
+    // Join both binary trees under the greatest node of the binary tree
+    else if ( p_binary_tree_right->p_root )
+    {
+
+        // Walk down to the greatest node again, updating the subtree sizes
+        if ( order_statistics )
+            for (binary_tree_node *p_node = p_binary_tree->p_root; p_node != *pp_max; p_node = p_node->p_right)
+                BINARY_TREE_NODE_SIZE_ADD(p_node, -1ULL);
+
+        // Detach the greatest node
+        p_pivot = *pp_max;
+        *pp_max = p_pivot->p_left;
+
+        // Hang both binary trees from the greatest node
+        p_pivot->p_left  = p_binary_tree->p_root;
+        p_pivot->p_right = p_binary_tree_right->p_root;
+
+        // Size the greatest node
+        BINARY_TREE_NODE_SIZE_SET(p_pivot, p_binary_tree->metadata.node_quantity + p_binary_tree_right->metadata.node_quantity);
+
+        // Store the root
+        p_binary_tree->p_root = p_pivot;
+    }
+
+    // Update the node quantity
+    p_binary_tree->metadata.node_quantity += p_binary_tree_right->metadata.node_quantity;
+
+    // The right binary tree is empty
+    p_binary_tree_right->p_root                 = (void *) 0;
+    p_binary_tree_right->metadata.node_quantity = 0;
+
+    // Rewrite the whole file at the next checkpoint
+    p_binary_tree->checkpoint.invalid = true;
+
+    // Unlock
+    binary_tree_unlock(p_second);
+    binary_tree_unlock(p_first);
+
+    // Release the right binary tree
+    binary_tree_destroy(pp_binary_tree_right);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_binary_tree_right:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_right\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            same_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Can not join a binary tree with itself in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            read_only:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            snapshots_in_use:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Binary tree has live snapshots in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            incompatible:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Binary trees have different node sizes, comparators, or flags in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            out_of_order:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Every key of parameter \"pp_binary_tree_right\" must be greater than every key of parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+
+            failed_to_adopt_slabs:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to adopt binary tree nodes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                goto unlock;
+        }
+
+        unlock:
+
+            // Unlock
+            binary_tree_unlock(p_second);
+            binary_tree_unlock(p_first);
+
+            // Error
+            return 0;
+    }
+}
+
+int binary_tree_merge_flatten ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, void **pp_values, size_t *p_index, bool adopt )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, pp_values,
+    //       or p_index is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_tree_node *p_right = (void *) 0;
+
+    // Base case
+    if ( p_binary_tree_node == (void *) 0 ) return 1;
+
+    // Flatten the left subtree
+    binary_tree_merge_flatten(p_binary_tree, p_binary_tree_node->p_left, pp_values, p_index, adopt);
+
+    // Store the value
+    pp_values[(*p_index)++] = p_binary_tree_node->p_value;
+
+    // Store the right subtree. Releasing the node overwrites its links
+    p_right = p_binary_tree_node->p_right;
+
+    // Push the adopted node onto the free list
+    if ( adopt )
+    {
+
+        // Push the node onto the free list
+        p_binary_tree_node->p_left           = p_binary_tree->allocator.p_free_list;
+        p_binary_tree_node->p_right          = (void *) 0;
+        p_binary_tree_node->p_value          = (void *) 0;
+        p_binary_tree->allocator.p_free_list = p_binary_tree_node;
+    }
+
+    // Destroy the node
+    else binary_tree_node_destroy(p_binary_tree, &p_binary_tree_node);
+
+    // Flatten the right subtree
+    return binary_tree_merge_flatten(p_binary_tree, p_right, pp_values, p_index, adopt);
+}
+
+int binary_tree_split_node ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, const void *const p_key, binary_tree_node **pp_left, binary_tree_node **pp_right )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, pp_left, 
+    //       or pp_right is null. Check your parameters before you call.
+
+    // Base case
+    if ( p_binary_tree_node == (void *) 0 )
+    {
+
+        // Both subtrees are empty
+        *pp_left  = (void *) 0;
+        *pp_right = (void *) 0;
+
+        // Success
+        return 1;
+    }
+
+    // The node, and its left subtree are lesser. Split the right subtree
+    if ( p_binary_tree->functions.pfn_is_equal(p_binary_tree->functions.pfn_key_accessor(p_binary_tree_node->p_value), p_key) > 0 )
+    {
+
+        // Split the right subtree
+        binary_tree_split_node(p_binary_tree, p_binary_tree_node->p_right, p_key, &p_binary_tree_node->p_right, pp_right);
+
+        // Store the lesser subtree
+        *pp_left = p_binary_tree_node;
+    }
+
+    // The node, and its right subtree are greater or equal. Split the left subtree
+    else
+    {
+
+        // Split the left subtree
+        binary_tree_split_node(p_binary_tree, p_binary_tree_node->p_left, p_key, pp_left, &p_binary_tree_node->p_left);
+
+        // Store the greater subtree
+        *pp_right = p_binary_tree_node;
+    }
+
+    // Update the subtree size
+    if ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS )
+        BINARY_TREE_NODE_SIZE_SET(p_binary_tree_node, 1 + ( ( p_binary_tree_node->p_left  ) ? BINARY_TREE_NODE_SIZE(p_binary_tree_node->p_left)  : 0 )
+                                                         + ( ( p_binary_tree_node->p_right ) ? BINARY_TREE_NODE_SIZE(p_binary_tree_node->p_right) : 0 ));
+
+    // Success
+    return 1;
+}
+
+unsigned long long binary_tree_node_count ( const binary_tree_node *const p_binary_tree_node )
+{
+
+    // Base case
+    if ( p_binary_tree_node == (void *) 0 ) return 0;
+
+    // Count the node, and its subtrees
+    return 1 + binary_tree_node_count(p_binary_tree_node->p_left) + binary_tree_node_count(p_binary_tree_node->p_right);
+}
+
+int binary_tree_scapegoat_push ( binary_tree *p_binary_tree, size_t depth, binary_tree_node *p_binary_tree_node )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree is null.
+    //       Check your parameters before you call.
+
+    // Grow the path
+    if ( depth == p_binary_tree->scapegoat.path_capacity )
+    {
+
+        // Initialized data
+        size_t             capacity = ( p_binary_tree->scapegoat.path_capacity ) ? p_binary_tree->scapegoat.path_capacity * 2 : 64;
+        binary_tree_node **pp_path  = TREE_REALLOC(p_binary_tree->scapegoat.pp_path, capacity * sizeof(binary_tree_node *));
+
+        // Error check
+        if ( pp_path == (void *) 0 ) goto no_mem;
+
+        // Update the path
+        p_binary_tree->scapegoat.pp_path       = pp_path;
+        p_binary_tree->scapegoat.path_capacity = capacity;
+    }
+
+    // Store the node
+    p_binary_tree->scapegoat.pp_path[depth] = p_binary_tree_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t binary_tree_scapegoat_height ( unsigned long long node_quantity )
+{
+
+    // Initialized data
+    double limit  = 1.0;
+    size_t height = 0;
+
+    // Count the powers of 1 / alpha that do not exceed the node quantity
+    while ( limit / BINARY_TREE_SCAPEGOAT_ALPHA <= (double) node_quantity ) limit /= BINARY_TREE_SCAPEGOAT_ALPHA, height++;
+
+    // Done
+    return height;
+}
+
+int binary_tree_scapegoat_insert ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, size_t depth )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       p_binary_tree_node is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_tree_node   *p_child    = p_binary_tree_node,
+                       *p_node     = (void *) 0,
+                       *p_sibling  = (void *) 0,
+                       *p_parent   = (void *) 0;
+    unsigned long long  child_size = 1,
+                        node_size  = 0;
+
+    // Track the largest size of the binary tree
+    if ( p_binary_tree->metadata.node_quantity > p_binary_tree->scapegoat.max_node_quantity )
+        p_binary_tree->scapegoat.max_node_quantity = p_binary_tree->metadata.node_quantity;
+
+    // Fast exit. The new node is not too deep
+    if ( depth <= binary_tree_scapegoat_height(p_binary_tree->scapegoat.max_node_quantity) ) return 1;
+
+    // Walk up the insert path, sizing each ancestor from its child and its 
+    // child's sibling, so only the subtree of the scapegoat is counted
+    for (size_t i = depth; i-- > 0; p_child = p_node, child_size = node_size)
+    {
+
+        // Store the ancestor, and the child's sibling
+        p_node    = p_binary_tree->scapegoat.pp_path[i];
+        p_sibling = ( p_node->p_left == p_child ) ? p_node->p_right : p_node->p_left;
+
+        // Size the ancestor
+        node_size = child_size + 1 + ( ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) ? ( ( p_sibling ) ? (size_t) BINARY_TREE_NODE_SIZE(p_sibling) : 0 )
+                                                                                                   : binary_tree_node_count(p_sibling) );
+
+        // Continue IF the ancestor is balanced
+        if ( (double) child_size <= BINARY_TREE_SCAPEGOAT_ALPHA * (double) node_size ) continue;
+
+        // Store the scapegoat's parent
+        p_parent = ( i ) ? p_binary_tree->scapegoat.pp_path[i - 1] : (void *) 0;
+
+        // Rebuild the scapegoat
+        return binary_tree_scapegoat_rebuild
+        (
+            p_binary_tree,
+            p_parent,
+            ( p_parent == (void *) 0 ) ? &p_binary_tree->p_root : ( p_parent->p_left == p_node ) ? &p_parent->p_left : &p_parent->p_right,
+            (size_t) node_size
+        );
+    }
+
+    // Success
+    return 1;
+}
+
+int binary_tree_scapegoat_remove ( binary_tree *p_binary_tree )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree is null.
+    //       Check your parameters before you call.
+
+    // Fast exit. The binary tree has not shrunk too far
+    if ( (double) p_binary_tree->metadata.node_quantity >= BINARY_TREE_SCAPEGOAT_ALPHA * (double) p_binary_tree->scapegoat.max_node_quantity ) return 1;
+
+    // Reset the largest size of the binary tree
+    p_binary_tree->scapegoat.max_node_quantity = p_binary_tree->metadata.node_quantity;
+
+    // Rebuild the whole binary tree
+    return binary_tree_scapegoat_rebuild(p_binary_tree, (void *) 0, &p_binary_tree->p_root, (size_t) p_binary_tree->metadata.node_quantity);
+}
+
+int binary_tree_scapegoat_rebuild ( binary_tree *p_binary_tree, binary_tree_node *p_parent, binary_tree_node **pp_binary_tree_node, size_t quantity )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       pp_binary_tree_node is null. Check your parameters before you call.
+
+    // Initialized data
+    size_t i = 0;
+
+    // Fast exit
+    if ( *pp_binary_tree_node == (void *) 0 ) return 1;
+
+    // Grow the value list
+    if ( quantity > p_binary_tree->scapegoat.value_capacity )
+    {
+
+        // Initialized data
+        size_t   capacity  = ( p_binary_tree->scapegoat.value_capacity ) ? p_binary_tree->scapegoat.value_capacity : 64;
+        void   **pp_values = (void *) 0;
+
+        // Double the capacity until the values fit
+        while ( capacity < quantity ) capacity *= 2;
+
+        // Grow the value list
+        pp_values = TREE_REALLOC(p_binary_tree->scapegoat.pp_values, capacity * sizeof(void *));
+
+        // Error check
+        if ( pp_values == (void *) 0 ) goto no_mem;
+
+        // Update the value list
+        p_binary_tree->scapegoat.pp_values      = pp_values;
+        p_binary_tree->scapegoat.value_capacity = capacity;
+    }
+
+    // Flatten the subtree, and return its nodes to the free list
+    binary_tree_merge_flatten(p_binary_tree, *pp_binary_tree_node, p_binary_tree->scapegoat.pp_values, &i, false);
+
+    // Construct a balanced subtree from the free nodes
+    *pp_binary_tree_node = binary_tree_construct_balanced_recursive(p_binary_tree, p_binary_tree->scapegoat.pp_values, 0, i);
+
+    // Error check
+    if ( *pp_binary_tree_node == (void *) 0 ) goto failed_to_construct_binary_tree;
+
+    // Mark the changed records
+    binary_tree_checkpoint_mark_subtree(p_binary_tree, *pp_binary_tree_node);
+    binary_tree_checkpoint_mark(p_binary_tree, p_parent);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct balanced binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Rewrite the whole file at the next checkpoint
+                p_binary_tree->checkpoint.invalid = true;
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_traverse_preorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
+    if ( pfn_traverse       == (void *) 0 ) goto no_traverse_function;
+
+    // Root
+    pfn_traverse(p_binary_tree_node->p_value);
+
+    // Left
+    if ( p_binary_tree_node->p_left ) binary_tree_traverse_preorder_node(p_binary_tree_node->p_left, pfn_traverse);
+
+    // Right
+    if ( p_binary_tree_node->p_right ) binary_tree_traverse_preorder_node(p_binary_tree_node->p_right, pfn_traverse);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_traverse_inorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
+    if ( pfn_traverse       == (void *) 0 ) goto no_traverse_function;
+
+    // Left
+    if ( p_binary_tree_node->p_left ) binary_tree_traverse_inorder_node(p_binary_tree_node->p_left, pfn_traverse);
+
+    // Root
+    pfn_traverse(p_binary_tree_node->p_value);
+
+    // Right
+    if ( p_binary_tree_node->p_right ) binary_tree_traverse_inorder_node(p_binary_tree_node->p_right, pfn_traverse);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_traverse_postorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
+    if ( pfn_traverse       == (void *) 0 ) goto no_traverse_function;
+
+    // Left
+    if ( p_binary_tree_node->p_left ) binary_tree_traverse_postorder_node(p_binary_tree_node->p_left, pfn_traverse);
+
+    // Right
+    if ( p_binary_tree_node->p_right ) binary_tree_traverse_postorder_node(p_binary_tree_node->p_right, pfn_traverse);
+
+    // Root
+    pfn_traverse(p_binary_tree_node->p_value);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_traverse_preorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+
+    // Initialized data
+    binary_tree_snapshot *p_binary_tree_snapshot = (void *) 0;
+    int                   result                 = 0;
+
+    // Traverse the memory mapped file. It never changes, so there is no snapshot
+    if ( p_binary_tree->mapped.p_base )
+    {
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+
+        // Traverse from the root record
+        result = binary_tree_traverse_preorder_mapped(p_binary_tree, 0, pfn_traverse);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    }
+
+    // Traverse the file through the record cache. It never changes either
+    else if ( p_binary_tree->lazy.p_cache )
+    {
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+
+        // Traverse from the root record
+        result = ( p_binary_tree->metadata.node_quantity ) ? binary_tree_traverse_preorder_lazy(p_binary_tree, 0, pfn_traverse) : 1;
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    }
+
+    // Traverse a snapshot of the tree
+    else
+    {
+
+        // Take a snapshot
+        if ( binary_tree_snapshot_construct(p_binary_tree, &p_binary_tree_snapshot) == 0 ) goto failed_to_traverse_binary_tree;
+
+        // Traverse the snapshot
+        result = binary_tree_snapshot_traverse_preorder(p_binary_tree_snapshot, pfn_traverse);
+
+        // Release the snapshot
+        binary_tree_snapshot_destroy(&p_binary_tree_snapshot);
+    }
+
+    // Error check
+    if ( result == 0 ) goto failed_to_traverse_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_traverse_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to traverse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_traverse_inorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+
+    // Initialized data
+    binary_tree_snapshot *p_binary_tree_snapshot = (void *) 0;
+    int                   result                 = 0;
+
+    // Traverse the memory mapped file. It never changes, so there is no snapshot
+    if ( p_binary_tree->mapped.p_base )
+    {
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+
+        // Traverse from the root record
+        result = binary_tree_traverse_inorder_mapped(p_binary_tree, 0, pfn_traverse);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    }
+
+    // Traverse the file through the record cache. It never changes either
+    else if ( p_binary_tree->lazy.p_cache )
+    {
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+
+        // Traverse from the root record
+        result = ( p_binary_tree->metadata.node_quantity ) ? binary_tree_traverse_inorder_lazy(p_binary_tree, 0, pfn_traverse) : 1;
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    }
+
+    // Traverse a snapshot of the tree
+    else
+    {
+
+        // Take a snapshot
+        if ( binary_tree_snapshot_construct(p_binary_tree, &p_binary_tree_snapshot) == 0 ) goto failed_to_traverse_binary_tree;
+
+        // Traverse the snapshot
+        result = binary_tree_snapshot_traverse_inorder(p_binary_tree_snapshot, pfn_traverse);
+
+        // Release the snapshot
+        binary_tree_snapshot_destroy(&p_binary_tree_snapshot);
+    }
+
+    // Error check
+    if ( result == 0 ) goto failed_to_traverse_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_traverse_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to traverse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_traverse_postorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+
+    // Initialized data
+    binary_tree_snapshot *p_binary_tree_snapshot = (void *) 0;
+    int                   result                 = 0;
+
+    // Traverse the memory mapped file. It never changes, so there is no snapshot
+    if ( p_binary_tree->mapped.p_base )
+    {
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+
+        // Traverse from the root record
+        result = binary_tree_traverse_postorder_mapped(p_binary_tree, 0, pfn_traverse);
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    }
+
+    // Traverse the file through the record cache. It never changes either
+    else if ( p_binary_tree->lazy.p_cache )
+    {
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+
+        // Traverse from the root record
+        result = ( p_binary_tree->metadata.node_quantity ) ? binary_tree_traverse_postorder_lazy(p_binary_tree, 0, pfn_traverse) : 1;
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    }
+
+    // Traverse a snapshot of the tree
+    else
+    {
+
+        // Take a snapshot
+        if ( binary_tree_snapshot_construct(p_binary_tree, &p_binary_tree_snapshot) == 0 ) goto failed_to_traverse_binary_tree;
+
+        // Traverse the snapshot
+        result = binary_tree_snapshot_traverse_postorder(p_binary_tree_snapshot, pfn_traverse);
+
+        // Release the snapshot
+        binary_tree_snapshot_destroy(&p_binary_tree_snapshot);
+    }
+
+    // Error check
+    if ( result == 0 ) goto failed_to_traverse_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_traverse_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to traverse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_search_range ( const binary_tree *const p_binary_tree, const void *const p_lo, const void *const p_hi, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto file_backed;
+
+    // Initialized data
+    binary_tree_cursor _cursor = { .p_binary_tree = p_binary_tree };
+    void *p_value = (void *) 0;
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Find the first value in the range
+    if ( binary_tree_cursor_seek(&_cursor, p_lo, &p_value) == 0 ) goto done;
+
+    // Visit each value until the key exceeds the upper bound
+    do
+    {
+
+        // Done?
+        if ( p_binary_tree->functions.pfn_is_equal(p_binary_tree->functions.pfn_key_accessor(p_value), p_hi) < 0 ) break;
+
+        // Visit the value
+        pfn_traverse(p_value);
+    }
+    while ( binary_tree_cursor_next(&_cursor, &p_value) );
+
+    done:
+
+    // Release the path
+    if ( _cursor.pp_path ) _cursor.pp_path = TREE_REALLOC(_cursor.pp_path, 0);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            file_backed:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree has no nodes in memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_search_batch ( const binary_tree *const p_binary_tree, const void *const *pp_keys, size_t key_quantity, void **pp_values )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pp_keys       == (void *) 0 ) goto no_keys;
+    if ( pp_values     == (void *) 0 ) goto no_values;
+
+    // Initialized data
+    fn_tree_equal        *pfn_is_equal     = p_binary_tree->functions.pfn_is_equal;
+    fn_tree_key_accessor *pfn_key_accessor = p_binary_tree->functions.pfn_key_accessor;
+    binary_tree_node     *_lanes[BINARY_TREE_SEARCH_BATCH_WIDTH];
+
+    // State check
+    if ( p_binary_tree->lazy.p_cache ) goto binary_tree_is_lazy;
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Search the frozen snapshot, or the memory mapped file
+    if ( p_binary_tree->frozen.p_keys || p_binary_tree->mapped.p_base ) goto search_each;
+
+    // Iterate over each group of keys
+    for (size_t i = 0; i < key_quantity; i += BINARY_TREE_SEARCH_BATCH_WIDTH)
+    {
+
+        // Initialized data
+        size_t width  = ( key_quantity - i < BINARY_TREE_SEARCH_BATCH_WIDTH ) ? key_quantity - i : BINARY_TREE_SEARCH_BATCH_WIDTH;
+        size_t active = ( p_binary_tree->p_root ) ? width : 0;
+
+        // Start each descent at the root
+        for (size_t j = 0; j < width; j++)
+        {
+            _lanes[j]        = p_binary_tree->p_root;
+            pp_values[i + j] = (void *) 0;
+        }
+
+        // Advance every descent by one level per round
+        while ( active )
+        {
+
+            // Prefetch the value of each node. The nodes were prefetched last round
+            for (size_t j = 0; j < width; j++)
+                if ( _lanes[j] ) TREE_PREFETCH(_lanes[j]->p_value);
+
+            // Compare, and step to the next level
+            for (size_t j = 0; j < width; j++)
+            {
+
+                // Initialized data
+                binary_tree_node *p_node = _lanes[j];
+                int comparator_return = 0;
+
+                // Skip finished descents
+                if ( p_node == (void *) 0 ) continue;
+
+                // Which side?
+                comparator_return = pfn_is_equal(pfn_key_accessor(p_node->p_value), pp_keys[i + j]);
+
+                // Found
+                if ( comparator_return == 0 )
+                {
+                    pp_values[i + j] = p_node->p_value;
+                    p_node           = (void *) 0;
+                }
+
+                // Step left or right
+                else p_node = ( comparator_return < 0 ) ? p_node->p_left : p_node->p_right;
+
+                // Prefetch the next node
+                if ( p_node ) TREE_PREFETCH(p_node);
+
+                // This descent is done
+                else active--;
+
+                // Store the state
+                _lanes[j] = p_node;
+            }
+        }
+    }
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // This branch runs if the binary tree is frozen or memory mapped
+    search_each:
+
+        // Search for each key the way binary_tree_search does
+        for (size_t i = 0; i < key_quantity; i++)
+        {
+
+            // The key is not found yet
+            pp_values[i] = (void *) 0;
+
+            // Search the frozen snapshot
+            if ( p_binary_tree->frozen.p_keys ) binary_tree_search_frozen(p_binary_tree, pp_keys[i], &pp_values[i]);
+
+            // Search the memory mapped file
+            else binary_tree_search_mapped(p_binary_tree, pp_keys[i], &pp_values[i]);
+        }
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Success
+        return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_keys:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pp_keys\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_values:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pp_values\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            binary_tree_is_lazy:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] A lazy binary tree's values are only valid until its next search in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_rank ( const binary_tree *const p_binary_tree, const void *const p_key, size_t *const p_rank )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_rank        == (void *) 0 ) goto no_rank;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto file_backed;
+    if ( ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) == 0 ) goto no_order_statistics;
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Count the keys less than the key
+    *p_rank = binary_tree_order_statistics_rank(p_binary_tree, p_key, false);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_rank:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_rank\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            file_backed:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree has no nodes in memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_order_statistics:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Binary tree was not constructed with BINARY_TREE_FLAG_ORDER_STATISTICS in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_select ( const binary_tree *const p_binary_tree, size_t index, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( pp_value      == (void *) 0 ) goto no_value;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto file_backed;
+    if ( ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) == 0 ) goto no_order_statistics;
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Initialized data
+    const binary_tree_node *p_node = p_binary_tree->p_root;
+
+    // Walk down the tree, steering by the size of each left subtree
+    while ( p_node )
+    {
+
+        // Initialized data
+        size_t left_size = ( p_node->p_left ) ? (size_t) BINARY_TREE_NODE_SIZE(p_node->p_left) : 0;
+
+        // The element is in the left subtree
+        if ( index < left_size ) p_node = p_node->p_left;
+
+        // The element is in the right subtree
+        else if ( index > left_size )
+        {
+
+            // Skip the left subtree and this node
+            index -= left_size + 1;
+
+            // Go right
+            p_node = p_node->p_right;
+        }
+
+        // This node is the element
+        else break;
+    }
+
+    // State check
+    if ( p_node == (void *) 0 ) goto out_of_bounds;
+
+    // Return a pointer to the caller
+    *pp_value = p_node->p_value;
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // This branch runs if the index is not less than the quantity of nodes
+    out_of_bounds:
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            file_backed:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree has no nodes in memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_order_statistics:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Binary tree was not constructed with BINARY_TREE_FLAG_ORDER_STATISTICS in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_count_range ( const binary_tree *const p_binary_tree, const void *const p_lo, const void *const p_hi, size_t *const p_count )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_count       == (void *) 0 ) goto no_count;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto file_backed;
+    if ( ( p_binary_tree->flags & BINARY_TREE_FLAG_ORDER_STATISTICS ) == 0 ) goto no_order_statistics;
+
+    // Initialized data
+    size_t below_lo = 0,
+           upto_hi  = 0;
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Count the keys less than the lower bound
+    below_lo = binary_tree_order_statistics_rank(p_binary_tree, p_lo, false);
+
+    // Count the keys less than or equal to the upper bound
+    upto_hi = binary_tree_order_statistics_rank(p_binary_tree, p_hi, true);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Return the count to the caller. An empty interval has no keys
+    *p_count = ( upto_hi > below_lo ) ? upto_hi - below_lo : 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_count:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            file_backed:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree has no nodes in memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_order_statistics:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Binary tree was not constructed with BINARY_TREE_FLAG_ORDER_STATISTICS in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t binary_tree_order_statistics_rank ( const binary_tree *const p_binary_tree, const void *const p_key, bool inclusive )
+{
+
+    // Initialized data
+    const binary_tree_node *p_node = p_binary_tree->p_root;
+    size_t                  rank   = 0;
+
+    // Walk down the tree
+    while ( p_node )
+    {
+
+        // Initialized data
+        int comparator_return = p_binary_tree->functions.pfn_is_equal
+        (
+            p_binary_tree->functions.pfn_key_accessor(p_node->p_value),
+            p_key
+        );
+
+        // This node's key is greater than the key
+        if ( comparator_return < 0 ) p_node = p_node->p_left;
+
+        // This node's key is less than the key. Count the left subtree and this node
+        else if ( comparator_return > 0 )
+        {
+
+            // Count the left subtree and this node
+            rank += ( ( p_node->p_left ) ? (size_t) BINARY_TREE_NODE_SIZE(p_node->p_left) : 0 ) + 1;
+
+            // Go right
+            p_node = p_node->p_right;
+        }
+
+        // This node's key is the key. Count the left subtree, and this node IF inclusive
+        else
+        {
+
+            // Count the left subtree, and this node IF inclusive
+            rank += ( ( p_node->p_left ) ? (size_t) BINARY_TREE_NODE_SIZE(p_node->p_left) : 0 ) + ( ( inclusive ) ? 1 : 0 );
+
+            // Done
+            break;
+        }
+    }
+
+    // Success
+    return rank;
+}
+
+int binary_tree_order_statistics_update ( binary_tree *const p_binary_tree, const void *const p_key, long long delta )
+{
+
+    // Initialized data
+    binary_tree_node *p_node = p_binary_tree->p_root;
+
+    // Walk down the tree, until the key or the end of the path
+    while ( p_node )
+    {
+
+        // Initialized data
+        int comparator_return = p_binary_tree->functions.pfn_is_equal
+        (
+            p_binary_tree->functions.pfn_key_accessor(p_node->p_value),
+            p_key
+        );
+
+        // Done
+        if ( comparator_return == 0 ) break;
+
+        // Stop at a node that a snapshot shares. It was never updated
+        if ( BINARY_TREE_NODE_SHARED(p_binary_tree, p_node) ) break;
+
+        // Update the subtree size
+        BINARY_TREE_NODE_SIZE_ADD(p_node, (unsigned long long) delta);
+
+        // Left or right
+        p_node = ( comparator_return < 0 ) ? p_node->p_left : p_node->p_right;
+    }
+
+    // Success
+    return 1;
+}
+
+int binary_tree_stats ( const binary_tree *const p_binary_tree, binary_tree_stats_report *const p_report )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_report      == (void *) 0 ) goto no_report;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto file_backed;
+
+    // Initialized data
+    size_t slabs = 0;
+
+    // Zero set the report
+    memset(p_report, 0, sizeof(binary_tree_stats_report));
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Measure the height and the depth histogram
+    if ( p_binary_tree->p_root ) binary_tree_stats_node(p_binary_tree->p_root, 0, p_report);
+
+    // Count the slabs
+    slabs = binary_tree_slab_count(p_binary_tree->allocator.p_slabs);
+
+    // Store the quantity of nodes
+    p_report->node_quantity = p_binary_tree->metadata.node_quantity;
+
+    // Store the bytes used by the tree, its slabs, and its frozen snapshot
+    p_report->bytes = sizeof(binary_tree)
+                    + ( slabs * ( sizeof(binary_tree_slab) + TREE_CACHE_LINE_SIZE + ( BINARY_TREE_SLAB_NODE_QUANTITY * sizeof(binary_tree_node) ) ) )
+                    + ( ( p_binary_tree->frozen.p_keys ) ? ( p_binary_tree->frozen.quantity + 1 ) * ( ( ( p_binary_tree->frozen.key_size ) ? p_binary_tree->frozen.key_size : sizeof(void *) ) + sizeof(void *) ) : 0 );
+
+    #ifdef BINARY_TREE_STATS
+
+        // Sum the slot of each thread
+        for (size_t i = 0; i < BINARY_TREE_STATS_SLOT_QUANTITY; i++)
+        {
+
+            // Initialized data
+            const binary_tree_stats_slot *p_slot = &p_binary_tree->stats[i];
+
+            // Sum the time spent waiting for the lock
+            p_report->lock_wait_ns += __atomic_load_n(&p_slot->lock_wait_ns, __ATOMIC_RELAXED);
+
+            // Sum each operation
+            for (size_t j = 0; j < BINARY_TREE_STATS_QUANTITY; j++)
+            {
+
+                // Initialized data
+                unsigned long long max_comparisons = __atomic_load_n(&p_slot->max_comparisons[j], __ATOMIC_RELAXED);
+
+                // Sum the operations and the comparisons
+                p_report->operations[j].operations  += __atomic_load_n(&p_slot->operations[j], __ATOMIC_RELAXED);
+                p_report->operations[j].comparisons += __atomic_load_n(&p_slot->comparisons[j], __ATOMIC_RELAXED);
+
+                // Find the most comparisons
+                if ( max_comparisons > p_report->operations[j].max_comparisons ) p_report->operations[j].max_comparisons = max_comparisons;
+            }
+        }
+    #endif
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Compute the average comparisons per operation
+    for (size_t j = 0; j < BINARY_TREE_STATS_QUANTITY; j++)
+        if ( p_report->operations[j].operations )
+            p_report->operations[j].average_comparisons = (double) p_report->operations[j].comparisons / (double) p_report->operations[j].operations;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_report:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_report\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            file_backed:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree has no nodes in memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_stats_node ( const binary_tree_node *const p_binary_tree_node, size_t depth, binary_tree_stats_report *const p_report )
+{
+
+    // Count the node in its depth bucket. The last bucket counts every deeper node
+    p_report->depth_histogram[( depth < BINARY_TREE_STATS_DEPTH_QUANTITY - 1 ) ? depth : BINARY_TREE_STATS_DEPTH_QUANTITY - 1]++;
+
+    // Update the height
+    if ( depth + 1 > p_report->height ) p_report->height = depth + 1;
+
+    // Left
+    if ( p_binary_tree_node->p_left ) binary_tree_stats_node(p_binary_tree_node->p_left, depth + 1, p_report);
+
+    // Right
+    if ( p_binary_tree_node->p_right ) binary_tree_stats_node(p_binary_tree_node->p_right, depth + 1, p_report);
+
+    // Success
+    return 1;
+}
+
+#ifdef BINARY_TREE_STATS
+
+binary_tree_stats_slot *binary_tree_stats_slot_get ( const binary_tree *const p_binary_tree )
+{
+
+    // Assign the calling thread a slot, the first time it counts anything
+    if ( binary_tree_stats_thread_slot == 0 )
+        binary_tree_stats_thread_slot = ( __atomic_fetch_add(&binary_tree_stats_thread_quantity, 1, __ATOMIC_RELAXED) % BINARY_TREE_STATS_SLOT_QUANTITY ) + 1;
+
+    // Success
+    return (binary_tree_stats_slot *) &p_binary_tree->stats[binary_tree_stats_thread_slot - 1];
+}
+
+int binary_tree_stats_count ( const binary_tree *const p_binary_tree, enum binary_tree_stats_operation_e operation, unsigned long long comparisons )
+{
+
+    // Initialized data
+    binary_tree_stats_slot *p_slot = binary_tree_stats_slot_get(p_binary_tree);
+
+    // Count the operation
+    __atomic_fetch_add(&p_slot->operations[operation], 1, __ATOMIC_RELAXED);
+
+    // Count the comparisons
+    __atomic_fetch_add(&p_slot->comparisons[operation], comparisons, __ATOMIC_RELAXED);
+
+    // Update the most comparisons
+    if ( comparisons > __atomic_load_n(&p_slot->max_comparisons[operation], __ATOMIC_RELAXED) )
+        __atomic_store_n(&p_slot->max_comparisons[operation], comparisons, __ATOMIC_RELAXED);
+
+    // Success
+    return 1;
+}
+
+unsigned long long binary_tree_stats_time ( void )
+{
+
+    // Initialized data
+    struct timespec _time = { 0 };
+
+    // Read the monotonic clock
+    clock_gettime(CLOCK_MONOTONIC, &_time);
+
+    // Success
+    return ( (unsigned long long) _time.tv_sec * 1000000000ULL ) + (unsigned long long) _time.tv_nsec;
+}
+
+#endif
+
+int binary_tree_freeze_node ( binary_tree *p_binary_tree, binary_tree_cursor *p_binary_tree_cursor, size_t i )
+{
+
+    // Initialized data
+    void *p_value = (void *) 0;
+
+    // Base case
+    if ( i > p_binary_tree->frozen.quantity ) return 1;
+
+    // Place the left subtree
+    if ( binary_tree_freeze_node(p_binary_tree, p_binary_tree_cursor, 2 * i) == 0 ) return 0;
+
+    // Error check
+    if ( p_binary_tree_cursor->depth == 0 ) return 0;
+
+    // Place this value
+    p_value = p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1]->p_value;
+    p_binary_tree->frozen.pp_values[i] = p_value;
+
+    // Copy the key ...
+    if ( p_binary_tree->frozen.key_size )
+        memcpy((char *) p_binary_tree->frozen.p_keys + ( i * p_binary_tree->frozen.key_size ), p_binary_tree->functions.pfn_key_accessor(p_value), p_binary_tree->frozen.key_size);
+
+    // ... or store a pointer to the key
+    else
+        ((const void **) p_binary_tree->frozen.p_keys)[i] = p_binary_tree->functions.pfn_key_accessor(p_value);
+
+    // Advance the cursor
+    (void) binary_tree_cursor_next(p_binary_tree_cursor, (void *) 0);
+
+    // Place the right subtree
+    return binary_tree_freeze_node(p_binary_tree, p_binary_tree_cursor, 2 * i + 1);
+}
+
+int binary_tree_freeze ( binary_tree *const p_binary_tree, size_t key_size )
+{
+
+    // Argument check
+    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+
+    // Initialized data
+    binary_tree_cursor _cursor = { .p_binary_tree = p_binary_tree };
+
+    // Lock
+    binary_tree_write_lock(p_binary_tree);
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto read_only;
+
+    // Discard the old snapshot
+    binary_tree_thaw(p_binary_tree);
+
+    // Fast exit
+    if ( p_binary_tree->p_root == (void *) 0 ) goto done;
+
+    // Allocate the snapshot. Slot 0 is unused
+    p_binary_tree->frozen.p_keys    = TREE_REALLOC(0, ( p_binary_tree->metadata.node_quantity + 1 ) * ( ( key_size ) ? key_size : sizeof(void *) ));
+    p_binary_tree->frozen.pp_values = TREE_REALLOC(0, ( p_binary_tree->metadata.node_quantity + 1 ) * sizeof(void *));
+
+    // Error checking
+    if ( p_binary_tree->frozen.p_keys == (void *) 0 || p_binary_tree->frozen.pp_values == (void *) 0 ) goto no_mem;
+
+    // Store the shape of the snapshot
+    p_binary_tree->frozen.quantity = p_binary_tree->metadata.node_quantity;
+    p_binary_tree->frozen.key_size = key_size;
+
+    // Position the cursor on the first value
+    if ( binary_tree_cursor_seek(&_cursor, (void *) 0, (void *) 0) == 0 ) goto failed_to_freeze;
+
+    // Place each value
+    if ( binary_tree_freeze_node(p_binary_tree, &_cursor, 1) == 0 ) goto failed_to_freeze;
+
+    done:
+
+    // Release the path
+    if ( _cursor.pp_path ) _cursor.pp_path = TREE_REALLOC(_cursor.pp_path, 0);
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            read_only:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+
+            failed_to_freeze:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to freeze binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the path
+                if ( _cursor.pp_path ) _cursor.pp_path = TREE_REALLOC(_cursor.pp_path, 0);
+
+                // Discard the partial snapshot
+                binary_tree_thaw(p_binary_tree);
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Discard the partial snapshot
+                binary_tree_thaw(p_binary_tree);
+
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_thaw ( binary_tree *p_binary_tree )
+{
+
+    // Release the keys
+    if ( p_binary_tree->frozen.p_keys ) p_binary_tree->frozen.p_keys = TREE_REALLOC(p_binary_tree->frozen.p_keys, 0);
+
+    // Release the values
+    if ( p_binary_tree->frozen.pp_values ) p_binary_tree->frozen.pp_values = TREE_REALLOC(p_binary_tree->frozen.pp_values, 0);
+
+    // Clear the shape
+    p_binary_tree->frozen.quantity = 0;
+    p_binary_tree->frozen.key_size = 0;
+
+    // Success
+    return 1;
+}
+
+int binary_tree_search_frozen ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value )
+{
+
+    // Initialized data
+    const char     *p_keys       = p_binary_tree->frozen.p_keys;
+    size_t          quantity     = p_binary_tree->frozen.quantity,
+                    key_size     = p_binary_tree->frozen.key_size,
+                    stride       = ( key_size ) ? key_size : sizeof(void *),
+                    i            = 1;
+    fn_tree_equal  *pfn_is_equal = p_binary_tree->functions.pfn_is_equal;
+    const void     *p_slot_key   = (void *) 0;
+
+    // Descend without branching on the comparison
+    while ( i <= quantity )
+    {
+
+        // The sixteen descendants four levels down are contiguous
+        if ( 16 * i <= quantity ) TREE_PREFETCH(p_keys + ( 16 * i * stride ));
+
+        // Find the key of this slot
+        p_slot_key = ( key_size ) ? (const void *) ( p_keys + ( i * key_size ) ) : ((const void *const *) p_keys)[i];
+
+        // Go right IF the key of this slot is less than the key ELSE left
+        i = ( 2 * i ) + ( pfn_is_equal(p_slot_key, p_key) > 0 );
+    }
+
+    // Undo the right turns after the last left turn. The slot is the lower bound
+    while ( i & 1 ) i >>= 1;
+    i >>= 1;
+
+    // Not found
+    if ( i == 0 ) return 0;
+
+    // Find the key of the lower bound
+    p_slot_key = ( key_size ) ? (const void *) ( p_keys + ( i * key_size ) ) : ((const void *const *) p_keys)[i];
+
+    // Not found
+    if ( pfn_is_equal(p_slot_key, p_key) != 0 ) return 0;
+
+    // Return a pointer to the caller
+    *pp_value = p_binary_tree->frozen.pp_values[i];
+
+    // Success
+    return 1;
+}
+
+int binary_tree_cursor_construct ( binary_tree_cursor **const pp_binary_tree_cursor, const binary_tree *const p_binary_tree )
+{
+
+    // Argument check
+    if ( pp_binary_tree_cursor == (void *) 0 ) goto no_binary_tree_cursor;
+    if ( p_binary_tree         == (void *) 0 ) goto no_binary_tree;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto file_backed;
+
+    // Initialized data
+    binary_tree_cursor *p_binary_tree_cursor = TREE_REALLOC(0, sizeof(binary_tree_cursor));
+
+    // Error checking
+    if ( p_binary_tree_cursor == (void *) 0 ) goto no_mem;
+
+    // Populate the cursor
+    *p_binary_tree_cursor = (binary_tree_cursor)
+    {
+        .p_binary_tree = p_binary_tree,
+        .pp_path       = (void *) 0,
+        .depth         = 0,
+        .capacity      = 0
+    };
+
+    // Lock
+    binary_tree_read_lock(p_binary_tree);
+
+    // Return a pointer to the caller
+    *pp_binary_tree_cursor = p_binary_tree_cursor;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_cursor:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            file_backed:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] File backed binary tree has no nodes in memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_cursor_push ( binary_tree_cursor *const p_binary_tree_cursor, binary_tree_node *p_binary_tree_node )
+{
+
+    // Grow the path
+    if ( p_binary_tree_cursor->depth == p_binary_tree_cursor->capacity )
+    {
+
+        // Initialized data
+        size_t             capacity = ( p_binary_tree_cursor->capacity ) ? p_binary_tree_cursor->capacity * 2 : 32;
+        binary_tree_node **pp_path  = TREE_REALLOC(p_binary_tree_cursor->pp_path, capacity * sizeof(binary_tree_node *));
+
+        // Error checking
+        if ( pp_path == (void *) 0 ) goto no_mem;
+
+        // Store the path
+        p_binary_tree_cursor->pp_path  = pp_path;
+        p_binary_tree_cursor->capacity = capacity;
+    }
+
+    // Push the node
+    p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth++] = p_binary_tree_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_cursor_seek ( binary_tree_cursor *const p_binary_tree_cursor, const void *const p_key, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_tree_cursor == (void *) 0 ) goto no_binary_tree_cursor;
+
+    // Initialized data
+    const binary_tree *p_binary_tree = p_binary_tree_cursor->p_binary_tree;
+    binary_tree_node  *p_node        = p_binary_tree->p_root;
+    size_t             depth         = 0;
+
+    // Clear the path
+    p_binary_tree_cursor->depth = 0;
+
+    // Walk down the tree
+    while ( p_node )
+    {
+
+        // Store the node on the path
+        if ( binary_tree_cursor_push(p_binary_tree_cursor, p_node) == 0 ) goto failed_to_push;
+
+        // The key of this node is greater than or equal to the key ...
+        if ( p_key == (void *) 0 || p_binary_tree->functions.pfn_is_equal(p_binary_tree->functions.pfn_key_accessor(p_node->p_value), p_key) <= 0 )
+        {
+
+            // ... so it is the best candidate so far ...
+            depth = p_binary_tree_cursor->depth;
+
+            // ... and a better candidate can only be on the left
+            p_node = p_node->p_left;
+        }
+
+        // The key of this node is less than the key
+        else p_node = p_node->p_right;
+    }
+
+    // Truncate the path to the best candidate
+    p_binary_tree_cursor->depth = depth;
+
+    // No such value
+    if ( depth == 0 ) return 0;
+
+    // Return a pointer to the caller
+    if ( pp_value ) *pp_value = p_binary_tree_cursor->pp_path[depth - 1]->p_value;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_cursor:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_push:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to grow cursor path in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Invalidate the cursor
+                p_binary_tree_cursor->depth = 0;
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_cursor_next ( binary_tree_cursor *const p_binary_tree_cursor, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_tree_cursor == (void *) 0 ) goto no_binary_tree_cursor;
+
+    // State check
+    if ( p_binary_tree_cursor->depth == 0 ) return 0;
+
+    // Initialized data
+    binary_tree_node *p_node = p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1];
+
+    // The successor is the leftmost node of the right subtree ...
+    if ( p_node->p_right )
+    {
+
+        // Walk down the left spine of the right subtree
+        for ( p_node = p_node->p_right; p_node; p_node = p_node->p_left )
+
+            // Store the node on the path
+            if ( binary_tree_cursor_push(p_binary_tree_cursor, p_node) == 0 ) goto failed_to_push;
+    }
+
+    // ... or the first ancestor that is reached from the left
+    else
+    {
+
+        // Walk up the path
+        for (;;)
+        {
+
+            // Initialized data
+            binary_tree_node *p_child = p_binary_tree_cursor->pp_path[--p_binary_tree_cursor->depth];
+
+            // Past the last value
+            if ( p_binary_tree_cursor->depth == 0 ) return 0;
+
+            // Reached from the left?
+            if ( p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1]->p_left == p_child ) break;
+        }
+    }
+
+    // Return a pointer to the caller
+    if ( pp_value ) *pp_value = p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1]->p_value;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_cursor:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_push:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to grow cursor path in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Invalidate the cursor
+                p_binary_tree_cursor->depth = 0;
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_cursor_prev ( binary_tree_cursor *const p_binary_tree_cursor, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_tree_cursor == (void *) 0 ) goto no_binary_tree_cursor;
+
+    // State check
+    if ( p_binary_tree_cursor->depth == 0 ) return 0;
+
+    // Initialized data
+    binary_tree_node *p_node = p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1];
+
+    // The predecessor is the rightmost node of the left subtree ...
+    if ( p_node->p_left )
+    {
+
+        // Walk down the right spine of the left subtree
+        for ( p_node = p_node->p_left; p_node; p_node = p_node->p_right )
+
+            // Store the node on the path
+            if ( binary_tree_cursor_push(p_binary_tree_cursor, p_node) == 0 ) goto failed_to_push;
+    }
+
+    // ... or the first ancestor that is reached from the right
+    else
+    {
+
+        // Walk up the path
+        for (;;)
+        {
+
+            // Initialized data
+            binary_tree_node *p_child = p_binary_tree_cursor->pp_path[--p_binary_tree_cursor->depth];
+
+            // Before the first value
+            if ( p_binary_tree_cursor->depth == 0 ) return 0;
+
+            // Reached from the right?
+            if ( p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1]->p_right == p_child ) break;
+        }
+    }
+
+    // Return a pointer to the caller
+    if ( pp_value ) *pp_value = p_binary_tree_cursor->pp_path[p_binary_tree_cursor->depth - 1]->p_value;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_cursor:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_push:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Failed to grow cursor path in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Invalidate the cursor
+                p_binary_tree_cursor->depth = 0;
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_cursor_destroy ( binary_tree_cursor **const pp_binary_tree_cursor )
+{
+
+    // Argument check
+    if ( pp_binary_tree_cursor == (void *) 0 ) goto no_binary_tree_cursor;
+
+    // Initialized data
+    binary_tree_cursor *p_binary_tree_cursor = *pp_binary_tree_cursor;
+
+    // Fast exit
+    if ( p_binary_tree_cursor == (void *) 0 ) return 1;
+
+    // No more pointer for caller
+    *pp_binary_tree_cursor = (void *) 0;
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree_cursor->p_binary_tree);
+
+    // Release the path
+    if ( p_binary_tree_cursor->pp_path ) p_binary_tree_cursor->pp_path = TREE_REALLOC(p_binary_tree_cursor->pp_path, 0);
+
+    // Release the cursor
+    p_binary_tree_cursor = TREE_REALLOC(p_binary_tree_cursor, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_cursor:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_cursor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_snapshot_construct ( binary_tree *const p_binary_tree, binary_tree_snapshot **const pp_binary_tree_snapshot )
+{
+
+    // Argument check
+    if ( p_binary_tree           == (void *) 0 ) goto no_binary_tree;
+    if ( pp_binary_tree_snapshot == (void *) 0 ) goto no_binary_tree_snapshot;
+
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto read_only;
+
+    // Initialized data
+    binary_tree_snapshot *p_binary_tree_snapshot = TREE_REALLOC(0, sizeof(binary_tree_snapshot));
+
+    // Error check
+    if ( p_binary_tree_snapshot == (void *) 0 ) goto no_mem;
+
+    // Copy on write snapshot
+    #ifdef BINARY_TREE_SNAPSHOTS
+
+        // Lock
+        binary_tree_write_lock(p_binary_tree);
+
+    // Locked snapshot. The read lock is held until the snapshot is destroyed
+    #else
+
+        // Lock
+        binary_tree_read_lock(p_binary_tree);
+    #endif
+
+    // Populate the snapshot
+    *p_binary_tree_snapshot = (binary_tree_snapshot)
+    {
+        .p_binary_tree = p_binary_tree,
+        .p_root        = p_binary_tree->p_root,
+        .node_quantity = p_binary_tree->metadata.node_quantity
+    };
+
+    // Copy on write snapshot
+    #ifdef BINARY_TREE_SNAPSHOTS
+
+        // Every node that exists now is shared with the snapshot
+        p_binary_tree->snapshots.quantity++;
+        p_binary_tree->snapshots.generation++;
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+    #endif
+
+    // Return a pointer to the caller
+    *pp_binary_tree_snapshot = p_binary_tree_snapshot;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            read_only:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File backed binary tree can not be snapshot in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_snapshot_traverse_preorder ( const binary_tree_snapshot *const p_binary_tree_snapshot, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree_snapshot == (void *) 0 ) goto no_binary_tree_snapshot;
+    if ( pfn_traverse           == (void *) 0 ) goto no_traverse_function;
+
+    // Fast exit
+    if ( p_binary_tree_snapshot->p_root == (void *) 0 ) return 1;
+
+    // Traverse the snapshot
+    return binary_tree_traverse_preorder_node(p_binary_tree_snapshot->p_root, pfn_traverse);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_snapshot_traverse_inorder ( const binary_tree_snapshot *const p_binary_tree_snapshot, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree_snapshot == (void *) 0 ) goto no_binary_tree_snapshot;
+    if ( pfn_traverse           == (void *) 0 ) goto no_traverse_function;
+
+    // Fast exit
+    if ( p_binary_tree_snapshot->p_root == (void *) 0 ) return 1;
+
+    // Traverse the snapshot
+    return binary_tree_traverse_inorder_node(p_binary_tree_snapshot->p_root, pfn_traverse);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_snapshot_traverse_postorder ( const binary_tree_snapshot *const p_binary_tree_snapshot, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_tree_snapshot == (void *) 0 ) goto no_binary_tree_snapshot;
+    if ( pfn_traverse           == (void *) 0 ) goto no_traverse_function;
+
+    // Fast exit
+    if ( p_binary_tree_snapshot->p_root == (void *) 0 ) return 1;
+
+    // Traverse the snapshot
+    return binary_tree_traverse_postorder_node(p_binary_tree_snapshot->p_root, pfn_traverse);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_snapshot_serialize ( const binary_tree_snapshot *const p_binary_tree_snapshot, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node )
+{
+
+    // Argument check
+    if ( p_binary_tree_snapshot == (void *) 0 ) goto no_binary_tree_snapshot;
+    if ( p_path                 == (void *) 0 ) goto no_file;
+    if ( pfn_serialize_node     == (void *) 0 ) goto no_serializer;
+
+    // Initialized data
+    FILE *p_file = fopen(p_path, "wb+");
+
+    // Error check
+    if ( p_file == (void *) 0 ) goto failed_to_open_file;
+
+    // Write the metadata
+    {
+
+        // Write the quantity of nodes
+        fwrite(&p_binary_tree_snapshot->node_quantity, sizeof(unsigned long long), 1, p_file);
+
+        // Write the size of a node
+        fwrite(&p_binary_tree_snapshot->p_binary_tree->metadata.node_size, sizeof(unsigned long long), 1, p_file);
+    }
+
+    // Write the nodes
+    if ( binary_tree_serialize_nodes(p_file, p_binary_tree_snapshot, pfn_serialize_node) == 0 ) goto failed_to_serialize_node;
+
+    // Close the file
+    if ( fclose(p_file) ) goto failed_to_close_file;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_serializer:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_serialize_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    
+        // Tree errors
+        {
+            failed_to_serialize_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to serialize node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_file);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_close_file:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to write file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_snapshot_destroy ( binary_tree_snapshot **const pp_binary_tree_snapshot )
+{
+
+    // Argument check
+    if ( pp_binary_tree_snapshot == (void *) 0 ) goto no_binary_tree_snapshot;
+
+    // Initialized data
+    binary_tree_snapshot *p_binary_tree_snapshot = *pp_binary_tree_snapshot;
+    binary_tree          *p_binary_tree          = (void *) 0;
+
+    // Fast exit
+    if ( p_binary_tree_snapshot == (void *) 0 ) return 1;
+
+    // No more pointer for caller
+    *pp_binary_tree_snapshot = (void *) 0;
+
+    // Store the binary tree
+    p_binary_tree = p_binary_tree_snapshot->p_binary_tree;
+
+    // Locked snapshot. Release the read lock
+    #ifndef BINARY_TREE_SNAPSHOTS
+
+        // Unlock
+        binary_tree_unlock(p_binary_tree);
+
+        // Release the snapshot
+        p_binary_tree_snapshot = TREE_REALLOC(p_binary_tree_snapshot, 0);
+
+        // Success
+        return 1;
+    #endif
+
+    // Lock
+    binary_tree_write_lock(p_binary_tree);
+
+    // The last snapshot returns the retired nodes to the free list
+    if ( --p_binary_tree->snapshots.quantity == 0 )
+    {
+
+        // Free each retired node
+        for (size_t i = 0; i < p_binary_tree->snapshots.retired_quantity; i++)
+        {
+
+            // Initialized data
+            binary_tree_node *p_binary_tree_node = p_binary_tree->snapshots.pp_retired[i];
+
+            // Push the node onto the free list
+            p_binary_tree_node->p_left           = p_binary_tree->allocator.p_free_list;
+            p_binary_tree_node->p_right          = (void *) 0;
+            p_binary_tree_node->p_value          = (void *) 0;
+            p_binary_tree->allocator.p_free_list = p_binary_tree_node;
+        }
+
+        // Empty the retired list
+        p_binary_tree->snapshots.retired_quantity = 0;
+    }
+
+    // Unlock
+    binary_tree_unlock(p_binary_tree);
+
+    // Release the snapshot
+    p_binary_tree_snapshot = TREE_REALLOC(p_binary_tree_snapshot, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_parse ( binary_tree **const pp_binary_tree, const char *p_file, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, fn_binary_tree_parse *pfn_parse_node )
+{
+    
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_file         == (void *) 0 ) goto no_file;
+    if ( pfn_parse_node == (void *) 0 ) goto no_parser;
+
+    // Initialized data
+    binary_tree *p_binary_tree = 0;
+    unsigned long long node_quantity = 0,
+                       node_size     = 0;
+    FILE *p_f = fopen(p_file, "rb");
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Read the metadata
+    {
+
+        // Read the quantity of nodes
+        if ( fread(&node_quantity, sizeof(unsigned long long), 1, p_f) != 1 ) goto invalid_file;
+
+        // Read the size of a node
+        if ( fread(&node_size, sizeof(unsigned long long), 1, p_f) != 1 ) goto invalid_file;
+    }
+
+    // Error check
+    if ( node_size <= 2 * sizeof(unsigned long long) ) goto invalid_file;
+
+    // Allocate a binary tree
+    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_tree_key_accessor, node_size-sizeof(p_binary_tree->metadata)) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Read the root node, IF the binary tree is not empty
+    if ( node_quantity && binary_tree_parse_node(p_f, p_binary_tree, &p_binary_tree->p_root, pfn_parse_node) == 0 ) goto failed_to_parse_binary_tree;
+
+    // Error check
+    if ( p_binary_tree->metadata.node_quantity != node_quantity ) goto failed_to_parse_binary_tree; 
+
+    // Close the file
+    fclose(p_f);
+
+    // Return a pointer to the caller
+    *pp_binary_tree = p_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {            
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_parser:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_parse_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            invalid_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File \"%s\" is not a serialized binary tree in call to function \"%s\"\n", p_file, __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_parse_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to parse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Free the binary tree
+                binary_tree_destroy(&p_binary_tree);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_file, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_parse_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node, fn_binary_tree_parse *pfn_binary_tree_parse )
+{
+
+    // Argument check
+    if ( p_file                == (void *) 0 ) goto no_file;
+    if ( p_binary_tree         == (void *) 0 ) goto no_binary_tree;
+    if ( pp_binary_tree_node   == (void *) 0 ) goto no_binary_tree_node;
+    if ( pfn_binary_tree_parse == (void *) 0 ) goto no_binary_tree_parser; 
+
+    // Initialized data
+    binary_tree_node *p_binary_tree_node = (void *) 0;
+    unsigned long long left_pointer, right_pointer;
+    
+    // Allocate a binary tree node
+    if ( binary_tree_node_create(p_binary_tree, &p_binary_tree_node) == 0 ) goto failed_to_allocate_node;
+
+    p_binary_tree_node->node_pointer = ( ftell(p_file) ) / (p_binary_tree->metadata.node_size);
+
+    // Fresh node pointers must not collide with parsed node pointers
+    if ( p_binary_tree_node->node_pointer >= p_binary_tree->allocator.next_node_pointer ) p_binary_tree->allocator.next_node_pointer = p_binary_tree_node->node_pointer + 1;
+
+    // Set the pointer correctly
+    fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + (p_binary_tree_node->node_pointer * ( p_binary_tree->metadata.node_size ))), SEEK_SET);
+
+    // User provided parsing function
+    pfn_binary_tree_parse(p_file, p_binary_tree_node);
+    
+    // Store the left pointer
+    fread(&left_pointer, 8, 1, p_file);
+    // printf("[%04d] -> left : < %llu, %lld >\n", p_binary_tree_node->node_pointer, ftell(p_file), left_pointer);
+
+    // Store the right pointer
+    fread(&right_pointer, 8, 1, p_file);
+    // printf("       -> right: < %llu, %lld >\n", ftell(p_file), right_pointer);
+    
+    // State check
+    if ( left_pointer == eight_bytes_of_f ) goto parse_right;
+
+    // Set the pointer correctly
+    fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + (left_pointer * ( p_binary_tree->metadata.node_size ))), SEEK_SET);
+
+    // Parse the left node
+    if ( binary_tree_parse_node(p_file, p_binary_tree, &p_binary_tree_node->p_left, pfn_binary_tree_parse) == 0 ) goto failed_to_parse_node;
+
+    parse_right:
+
+    // State check
+    if ( right_pointer == eight_bytes_of_f ) goto done;
+
+    // Set the pointer correctly
+    fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + (right_pointer * ( p_binary_tree->metadata.node_size))), SEEK_SET);
+
+    // Parse the right node
+    if ( binary_tree_parse_node(p_file, p_binary_tree, &p_binary_tree_node->p_right, pfn_binary_tree_parse) == 0 ) goto failed_to_parse_node;
+
+    done:
+
+    // Return a pointer to the caller
+    *pp_binary_tree_node = p_binary_tree_node;
+
+    // Increment the node quantity
+    p_binary_tree->metadata.node_quantity++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_binary_tree_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_binary_tree_parser:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_binary_tree_parse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_parse_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to parse node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_tree_parse_parallel ( binary_tree **const pp_binary_tree, const char *p_file, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, fn_binary_tree_parse *pfn_parse_node, size_t thread_quantity )
+{
+
+    // Argument check
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_file         == (void *) 0 ) goto no_file;
+    if ( pfn_parse_node == (void *) 0 ) goto no_parser;
+
+    // Initialized data
+    binary_tree                 *p_binary_tree = (void *) 0;
+    binary_tree_node           **pp_nodes      = (void *) 0;
+    binary_tree_parse_task      *p_tasks       = (void *) 0;
+    pthread_t                   *p_threads     = (void *) 0;
+    unsigned long long           node_quantity = 0,
+                                 node_size     = 0;
+    size_t                       threads       = 0;
+    int                          result        = 1;
+    FILE                        *p_f           = fopen(p_file, "rb");
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Read the metadata
+    {
+
+        // Read the quantity of nodes
+        if ( fread(&node_quantity, sizeof(unsigned long long), 1, p_f) != 1 ) node_quantity = 0, node_size = 0;
+
+        // Read the size of a node
+        else if ( fread(&node_size, sizeof(unsigned long long), 1, p_f) != 1 ) node_size = 0;
+
+        // Close the file
+        fclose(p_f);
+    }
+
+    // Error check
+    if ( node_size <= 2 * sizeof(unsigned long long) ) goto invalid_file;
+
+    // Allocate a binary tree
+    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_tree_key_accessor, node_size - sizeof(p_binary_tree->metadata)) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Fast exit
+    if ( node_quantity == 0 ) goto done;
+
+    // Use one thread per processor by default
+    if ( thread_quantity == 0 ) thread_quantity = (size_t) sysconf(_SC_NPROCESSORS_ONLN);
+
+    // Clamp the quantity of threads to [ 1, node_quantity ]
+    threads = ( thread_quantity == 0 ) ? 1 : ( thread_quantity > node_quantity ) ? (size_t) node_quantity : thread_quantity;
+
+    // Allocate memory for the node table, the tasks, and the threads
+    pp_nodes  = TREE_REALLOC(0, (size_t) node_quantity * sizeof(binary_tree_node *));
+    p_tasks   = TREE_REALLOC(0, threads * sizeof(binary_tree_parse_task));
+    p_threads = TREE_REALLOC(0, threads * sizeof(pthread_t));
+
+    // Error check
+    if ( pp_nodes == (void *) 0 || p_tasks == (void *) 0 || p_threads == (void *) 0 ) goto no_mem;
+
+    // Allocate every node up front. The node pointer of each node is its record index
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Allocate a binary tree node
+        if ( binary_tree_node_create(p_binary_tree, &pp_nodes[i]) == 0 ) goto failed_to_allocate_node;
+
+        // Store the node pointer
+        pp_nodes[i]->node_pointer = i;
+    }
+
+    // Fresh node pointers must not collide with parsed node pointers
+    p_binary_tree->allocator.next_node_pointer = node_quantity;
+
+    // Split the records into contiguous ranges
+    for (size_t i = 0; i < threads; i++)
+        p_tasks[i] = (binary_tree_parse_task)
+        {
+            .p_binary_tree  = p_binary_tree,
+            .pp_nodes       = pp_nodes,
+            .p_path         = p_file,
+            .pfn_parse_node = pfn_parse_node,
+            .start          = ( (size_t) node_quantity * i ) / threads,
+            .end            = ( (size_t) node_quantity * ( i + 1 ) ) / threads,
+            .running        = false,
+            .result         = 0
+        };
+
+    // Parse the first range on this thread, and the rest on worker threads
+    for (size_t i = 1; i < threads; i++)
+        p_tasks[i].running = ( pthread_create(&p_threads[i], (void *) 0, binary_tree_parse_records, &p_tasks[i]) == 0 );
+
+    // Parse the first range
+    binary_tree_parse_records(&p_tasks[0]);
+
+    // Wait for the worker threads, and collect the results
+    for (size_t i = 1; i < threads; i++)
+    {
+
+        // Wait for the thread
+        if ( p_tasks[i].running ) pthread_join(p_threads[i], (void *) 0);
+
+        // Accumulate the result. A thread that failed to start parsed nothing
+        result &= p_tasks[i].result;
+    }
+
+    // Accumulate the result of the first range
+    result &= p_tasks[0].result;
+
+    // Error check
+    if ( result == 0 ) goto failed_to_parse_binary_tree;
+
+    // The root node is the first record
+    p_binary_tree->p_root = pp_nodes[0];
+
+    // Store the quantity of nodes
+    p_binary_tree->metadata.node_quantity = node_quantity;
+
+    // Clean up
+    pp_nodes  = TREE_REALLOC(pp_nodes, 0);
+    p_tasks   = TREE_REALLOC(p_tasks, 0);
+    p_threads = TREE_REALLOC(p_threads, 0);
+
+    done:
+
+    // Return a pointer to the caller
+    *pp_binary_tree = p_binary_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {            
+            no_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_parser:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_parse_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            invalid_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File \"%s\" is not a serialized binary tree in call to function \"%s\"\n", p_file, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+
+            failed_to_parse_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to parse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_file, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        clean_up:
+
+            // Release the node table, the tasks, and the threads
+            if ( pp_nodes  ) pp_nodes  = TREE_REALLOC(pp_nodes, 0);
+            if ( p_tasks   ) p_tasks   = TREE_REALLOC(p_tasks, 0);
+            if ( p_threads ) p_threads = TREE_REALLOC(p_threads, 0);
+
+            // Release the binary tree, and every node with it
+            binary_tree_destroy(&p_binary_tree);
+
+            // Error
+            return 0;
+    }
+}
+
+void *binary_tree_parse_records ( void *p_parameter )
+{
+
+    // Initialized data
+    binary_tree_parse_task *p_task        = p_parameter;
+    binary_tree            *p_binary_tree = p_task->p_binary_tree;
+    unsigned long long      node_size     = p_binary_tree->metadata.node_size,
+                            node_quantity = p_binary_tree->allocator.next_node_pointer,
+                            left_pointer  = 0,
+                            right_pointer = 0;
+    FILE                   *p_f           = fopen(p_task->p_path, "rb");
+
+    // Error check
+    if ( p_f == (void *) 0 ) return (void *) 0;
+
+    // Read the range in large blocks
+    setvbuf(p_f, (void *) 0, _IOFBF, BINARY_TREE_PARSE_BUFFER_SIZE);
+
+    // Parse each record in the range
+    for (size_t i = p_task->start; i < p_task->end; i++)
+    {
+
+        // Initialized data
+        binary_tree_node *p_binary_tree_node = p_task->pp_nodes[i];
+        long              offset             = (long) ( sizeof(p_binary_tree->metadata) + ( i * node_size ) );
+
+        // Set the pointer correctly
+        fseek(p_f, offset, SEEK_SET);
+
+        // User provided parsing function
+        p_task->pfn_parse_node(p_f, p_binary_tree_node);
+
+        // Set the pointer correctly
+        fseek(p_f, offset + (long) ( node_size - ( 2 * sizeof(unsigned long long) ) ), SEEK_SET);
+
+        // Read the node pointers
+        if ( fread(&left_pointer, sizeof(unsigned long long), 1, p_f) != 1 ) goto failed_to_parse_record;
+        if ( fread(&right_pointer, sizeof(unsigned long long), 1, p_f) != 1 ) goto failed_to_parse_record;
+
+        // Link the left node
+        if ( left_pointer != eight_bytes_of_f )
+        {
+
+            // Error check
+            if ( left_pointer >= node_quantity ) goto failed_to_parse_record;
 
-    // Initialized data
-    binary_tree *p_binary_tree = TREE_REALLOC(0, sizeof(binary_tree));
+            // Store the left node
+            p_binary_tree_node->p_left = p_task->pp_nodes[left_pointer];
+        }
 
-    // Error checking
-    if ( p_binary_tree == (void *) 0 ) goto no_mem;
+        // Link the right node
+        if ( right_pointer != eight_bytes_of_f )
+        {
 
-    // Zero set the memory
-    memset(p_binary_tree, 0, sizeof(binary_tree));
+            // Error check
+            if ( right_pointer >= node_quantity ) goto failed_to_parse_record;
 
-    // Return a pointer to the caller
-    *pp_binary_tree = p_binary_tree;
+            // Store the right node
+            p_binary_tree_node->p_right = p_task->pp_nodes[right_pointer];
+        }
+    }
 
     // Success
-    return 1;
+    p_task->result = 1;
+
+    // Close the file
+    fclose(p_f);
+
+    // Done
+    return (void *) 0;
 
     // Error handling
     {
 
-        // Argument errors
+        // Tree errors
         {
-            no_binary_tree:
+            failed_to_parse_record:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Failed to parse record in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-        }
-
-        // Standard library
-        {
-            no_mem:
-                #ifndef NDEBUG
-                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                // Close the file
+                fclose(p_f);
 
                 // Error
-                return 0;
+                return (void *) 0;
         }
     }
 }
 
-int binary_tree_node_create ( binary_tree_node **pp_binary_tree_node )
+int binary_tree_open_mapped ( binary_tree **const pp_binary_tree, const char *p_path, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor )
 {
 
     // Argument check
-    if ( pp_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
+    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_path         == (void *) 0 ) goto no_file;
 
     // Initialized data
-    binary_tree_node *p_binary_tree_node = TREE_REALLOC(0, sizeof(binary_tree_node));
+    binary_tree        *p_binary_tree = (void *) 0;
+    struct stat         _stat         = { 0 };
+    void               *p_base        = MAP_FAILED;
+    unsigned long long  node_quantity = 0,
+                        node_size     = 0;
+    int                 fd            = open(p_path, O_RDONLY);
 
-    // Error checking
-    if ( p_binary_tree_node == (void *) 0 ) goto no_mem;
+    // Error check
+    if ( fd == -1 ) goto failed_to_open_file;
 
-    // Zero set the memory
-    memset(p_binary_tree_node, 0, sizeof(binary_tree_node));
+    // Find the size of the file
+    if ( fstat(fd, &_stat) == -1 ) goto failed_to_stat_file;
+
+    // Error check
+    if ( (size_t) _stat.st_size < sizeof(p_binary_tree->metadata) ) goto invalid_file;
+
+    // Map the file. Pages are read on first access
+    p_base = mmap((void *) 0, (size_t) _stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping holds a reference to the file
+    close(fd);
+
+    // Error check
+    if ( p_base == MAP_FAILED ) goto failed_to_map_file;
+
+    // Read the metadata
+    memcpy(&node_quantity, (const char *) p_base, sizeof(unsigned long long));
+    memcpy(&node_size, (const char *) p_base + sizeof(unsigned long long), sizeof(unsigned long long));
+
+    // Error check
+    if ( node_size <= 2 * sizeof(unsigned long long) ) goto invalid_file;
+    if ( node_quantity > ( ( (size_t) _stat.st_size - sizeof(p_binary_tree->metadata) ) / node_size ) ) goto invalid_file;
+
+    // Allocate a binary tree
+    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_tree_key_accessor, node_size - sizeof(p_binary_tree->metadata)) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Store the mapping
+    p_binary_tree->mapped.p_base = p_base;
+    p_binary_tree->mapped.size   = (size_t) _stat.st_size;
+
+    // Store the quantity of nodes
+    p_binary_tree->metadata.node_quantity = node_quantity;
 
     // Return a pointer to the caller
-    *pp_binary_tree_node = p_binary_tree_node;
+    *pp_binary_tree = p_binary_tree;
 
     // Success
     return 1;
@@ -193,122 +6376,164 @@ int binary_tree_node_create ( binary_tree_node **pp_binary_tree_node )
     {
 
         // Argument errors
-        {
-            no_binary_tree_node:
+        {            
+            no_binary_tree:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-        }
 
-        // Standard library
-        {
-            no_mem:
+            no_file:
                 #ifndef NDEBUG
-                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
-    }
-}
-
-int binary_tree_node_allocate ( binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node )
-{
-
-    // Argument check
-    if ( p_binary_tree       == (void *) 0 ) goto no_binary_tree;
-    if ( pp_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
-    
-    // Initialized data
-    binary_tree_node *p_binary_tree_node = (void *) 0;
 
-    // Allocate a node
-    if ( binary_tree_node_create(&p_binary_tree_node) == 0 ) goto failed_to_allocate_node;
+        // Tree errors
+        {
+            invalid_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File \"%s\" is not a serialized binary tree in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
 
-    // Store the node pointer
-    p_binary_tree_node->node_pointer = p_binary_tree->metadata.node_quantity;
+                // Release the file
+                if ( p_base != MAP_FAILED ) munmap(p_base, (size_t) _stat.st_size);
+                else close(fd);
 
-    // Increment the node quantity
-    p_binary_tree->metadata.node_quantity++;
+                // Error
+                return 0;
 
-    // Return a pointer to the caller
-    *pp_binary_tree_node = p_binary_tree_node;
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Success
-    return 1;
+                // Release the mapping
+                munmap(p_base, (size_t) _stat.st_size);
 
-    // Error handling
-    {
+                // Error
+                return 0;
+        }
 
-        // Argument errors
+        // Standard library errors
         {
-            no_binary_tree:
+            failed_to_open_file:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-                
-            no_binary_tree_node:
+
+            failed_to_stat_file:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"fstat\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Close the file
+                close(fd);
+
                 // Error
                 return 0;
-        }
 
-        // Tree
-        {
-            failed_to_allocate_node:
+            failed_to_map_file:
                 #ifndef NDEBUG
-                    printf("[tree] Call to function \"binary_tree_node_create\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"mmap\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Unlock
-                mutex_unlock(&p_binary_tree->_lock);
-                
                 // Error
                 return 0;
         }
     }
 }
 
-int binary_tree_construct ( binary_tree **const pp_binary_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size )
+int binary_tree_open_lazy ( binary_tree **const pp_binary_tree, const char *p_path, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, size_t cache_quantity )
 {
 
     // Argument check
     if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
+    if ( p_path         == (void *) 0 ) goto no_file;
 
     // Initialized data
-    binary_tree *p_binary_tree = TREE_REALLOC(0, sizeof(binary_tree));
+    binary_tree            *p_binary_tree            = (void *) 0;
+    binary_tree_lazy_cache *p_binary_tree_lazy_cache = (void *) 0;
+    struct stat             _stat                    = { 0 };
+    unsigned long long      node_quantity            = 0,
+                            node_size                = 0,
+                            left_pointer             = 0,
+                            right_pointer            = 0;
+    size_t                  bucket_quantity          = 1;
+    FILE                   *p_f                      = fopen(p_path, "rb");
 
-    // Error checking
-    if ( p_binary_tree == (void *) 0 ) goto failed_to_allocate_binary_tree;
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
 
-    // Populate the binary tree structure
-    *p_binary_tree = (binary_tree)
+    // Find the size of the file
+    if ( fstat(fileno(p_f), &_stat) == -1 ) goto failed_to_stat_file;
+
+    // Read the metadata
+    if ( fread(&node_quantity, sizeof(unsigned long long), 1, p_f) != 1 ) goto invalid_file;
+    if ( fread(&node_size, sizeof(unsigned long long), 1, p_f) != 1 ) goto invalid_file;
+
+    // Error check
+    if ( node_size <= 2 * sizeof(unsigned long long) ) goto invalid_file;
+    if ( node_quantity > ( ( (size_t) _stat.st_size - sizeof(p_binary_tree->metadata) ) / node_size ) ) goto invalid_file;
+
+    // Default the size of the cache. The root takes one entry, so keep at 
+    // least one more for the rest of the tree
+    if ( cache_quantity == 0 ) cache_quantity = BINARY_TREE_LAZY_CACHE_QUANTITY;
+    if ( cache_quantity <  2 ) cache_quantity = 2;
+
+    // There is no reason to cache more records than the file holds
+    if ( node_quantity && cache_quantity > node_quantity ) cache_quantity = ( node_quantity < 2 ) ? 2 : (size_t) node_quantity;
+
+    // Use at least as many buckets as entries, so chains stay short
+    while ( bucket_quantity < cache_quantity ) bucket_quantity *= 2;
+
+    // Allocate the record cache
+    p_binary_tree_lazy_cache = TREE_REALLOC(0, sizeof(binary_tree_lazy_cache));
+
+    // Error check
+    if ( p_binary_tree_lazy_cache == (void *) 0 ) goto no_mem;
+
+    // Populate the record cache
+    *p_binary_tree_lazy_cache = (binary_tree_lazy_cache)
     {
-        .p_root    = (void *) 0,
-        .functions =
-        {
-            .pfn_is_equal     = (pfn_is_equal)     ? pfn_is_equal     : tree_compare_function,
-            .pfn_key_accessor = (pfn_key_accessor) ? pfn_key_accessor : tree_key_is_value
-        },
-        .metadata =
-        {
-            .node_quantity = 0,
-            .node_size     = node_size + ( 2 * sizeof(unsigned long long) )
-        }
+        .p_entries   = TREE_REALLOC(0, cache_quantity * sizeof(binary_tree_lazy_entry)),
+        .p_buckets   = TREE_REALLOC(0, bucket_quantity * sizeof(size_t)),
+        .p_records   = TREE_REALLOC(0, cache_quantity * (size_t) node_size),
+        .quantity    = cache_quantity,
+        .used        = 0,
+        .hand        = 1,
+        .bucket_mask = bucket_quantity - 1
     };
 
-    // Construct a lock
-    mutex_create(&p_binary_tree->_lock);
+    // Create the lock that guards the record cache
+    mutex_create(&p_binary_tree_lazy_cache->_lock);
+
+    // Error check
+    if ( p_binary_tree_lazy_cache->p_entries == (void *) 0 ) goto no_mem;
+    if ( p_binary_tree_lazy_cache->p_buckets == (void *) 0 ) goto no_mem;
+    if ( p_binary_tree_lazy_cache->p_records == (void *) 0 ) goto no_mem;
+
+    // Every bucket starts empty
+    memset(p_binary_tree_lazy_cache->p_buckets, 0xff, bucket_quantity * sizeof(size_t));
+
+    // Allocate a binary tree
+    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_tree_key_accessor, node_size - sizeof(p_binary_tree->metadata)) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Store the file and the record cache
+    p_binary_tree->p_random_access        = p_f;
+    p_binary_tree->lazy.p_cache           = p_binary_tree_lazy_cache;
+    p_binary_tree->metadata.node_quantity = node_quantity;
+
+    // Read the root record into the first entry, where it stays
+    if ( node_quantity && binary_tree_lazy_fetch(p_binary_tree, 0, &left_pointer, &right_pointer) == (void *) 0 ) goto failed_to_read_root;
 
     // Return a pointer to the caller
     *pp_binary_tree = p_binary_tree;
@@ -320,7 +6545,7 @@ int binary_tree_construct ( binary_tree **const pp_binary_tree, fn_tree_equal *p
     {
 
         // Argument errors
-        {
+        {            
             no_binary_tree:
                 #ifndef NDEBUG
                     printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
@@ -328,684 +6553,827 @@ int binary_tree_construct ( binary_tree **const pp_binary_tree, fn_tree_equal *p
 
                 // Error
                 return 0;
-        }
 
-        // Tree errors
-        {
-            failed_to_allocate_binary_tree:
+            no_file:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to allocate binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
-    }
-}
-
-binary_tree_node *binary_tree_construct_balanced_recursive ( binary_tree *p_binary_tree, void **pp_values, size_t start, size_t end )
-{
-
-    // NOTE: This function has undefined behavior if p_binary_tree, pp_keys, 
-    //       and/or pp_values is null. Check your parameters before you call.
-
-    // Initialized data
-    binary_tree_node *p_binary_tree_node = (void *) 0;
-
-    // Base case
-    if ( start == end )
-    {
-
-        // Allocate a binary tree node
-        if (binary_tree_node_allocate(p_binary_tree, &p_binary_tree_node) == 0) goto failed_to_allocate_node;
-
-        // Store the value
-        p_binary_tree_node->p_value = pp_values[start];
-        
-        // Done
-        return p_binary_tree_node;
-    }
-
-    // One property
-    else if ( end - start == 1 )
-    {
-
-        // Allocate a binary tree node
-        if (binary_tree_node_allocate(p_binary_tree, &p_binary_tree_node) == 0) goto failed_to_allocate_node;
-
-        // Store the value
-        p_binary_tree_node->p_value = pp_values[end];
-
-        // Allocate the left node
-        if (binary_tree_node_allocate(p_binary_tree, &p_binary_tree_node->p_left) == 0) goto failed_to_allocate_node;
-
-        // Store the left value
-        p_binary_tree_node->p_left->p_value = pp_values[start];
-        
-        // Done
-        return p_binary_tree_node;
-    }
 
-    // Two properties
-    else
-    {
-
-        // Initialized data
-        size_t median = (start + end) / 2;
-
-        // Allocate a binary tree node
-        if (binary_tree_node_allocate(p_binary_tree, &p_binary_tree_node) == 0) goto failed_to_allocate_node;
+        // Tree errors
+        {
+            invalid_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] File \"%s\" is not a serialized binary tree in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
 
-        // Store the value
-        p_binary_tree_node->p_value = pp_values[median];
+                // Close the file
+                fclose(p_f);
 
-        // Construct the left
-        p_binary_tree_node->p_left = binary_tree_construct_balanced_recursive(p_binary_tree, pp_values, start, median - 1);
+                // Error
+                return 0;
 
-        // Construct the right
-        p_binary_tree_node->p_right = binary_tree_construct_balanced_recursive(p_binary_tree, pp_values, median + 1, end);
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-        // Done
-        return p_binary_tree_node;
-    }
+                // Release the record cache
+                binary_tree_lazy_cache_destroy(p_binary_tree_lazy_cache);
 
-    // Error
-    return (void *) 0;
+                // Close the file
+                fclose(p_f);
 
-    // Error handling
-    {
+                // Error
+                return 0;
 
-        // Tree errors
-        {
-            failed_to_allocate_node:
+            failed_to_read_root:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Failed to read root record in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Release the binary tree, the record cache, and the file
+                binary_tree_destroy(&p_binary_tree);
+
                 // Error
                 return 0;
         }
-    }
-}
-
-int binary_tree_construct_balanced ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal,  fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size )
-{
-
-    // Argument check
-    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
-
-    // Initialized data
-    binary_tree *p_binary_tree = TREE_REALLOC(0, sizeof(binary_tree));
 
-    // Error checking
-    if ( p_binary_tree == (void *) 0 ) goto failed_to_allocate_binary_tree;
-
-    // Populate the binary tree structure
-    *p_binary_tree = (binary_tree)
-    {
-        .p_root    = (void *) 0,
-        .functions =
+        // Standard library errors
         {
-            .pfn_is_equal = (pfn_is_equal) ? pfn_is_equal : tree_compare_function,
-            .pfn_key_accessor = (pfn_key_accessor) ? pfn_key_accessor : tree_key_is_value
-        },
-        .metadata =
-        {
-            .node_quantity = 0,
-            .node_size     = node_size + ( 2 * sizeof(unsigned long long) )
-        }
-    };
-
-    // Recursively construct a binary search tree, and store the root
-    p_binary_tree->p_root = binary_tree_construct_balanced_recursive(p_binary_tree, pp_values, 0, property_quantity);
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Return a pointer to the caller
-    *pp_binary_tree = p_binary_tree;
+                // Release the record cache
+                if ( p_binary_tree_lazy_cache ) binary_tree_lazy_cache_destroy(p_binary_tree_lazy_cache);
 
-    // Success
-    return 1;
+                // Close the file
+                fclose(p_f);
 
-    // Error handling
-    {
+                // Error
+                return 0;
 
-        // Argument errors
-        {
-            no_binary_tree:
+            failed_to_open_file:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-        }
 
-        // Tree errors
-        {
-            failed_to_allocate_binary_tree:
+            failed_to_stat_file:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to allocate binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"fstat\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Close the file
+                fclose(p_f);
+
                 // Error
                 return 0;
         }
     }
 }
 
-int binary_tree_search ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value )
+int binary_tree_search_mapped ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value )
 {
 
-    // Argument check
-    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
-
-    // State check
-    if ( p_binary_tree->p_root == (void *) 0 ) return 0;
-
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
-
     // Initialized data
-    binary_tree_node *p_node = p_binary_tree->p_root;
-    int comparator_return = 0;
-
-    try_again:
-
-    // Which side? 
-    comparator_return = p_binary_tree->functions.pfn_is_equal
-    (
-        p_binary_tree->functions.pfn_key_accessor( p_node->p_value ),
-        p_key
-    );
-
-    // Search the left node
-    if ( comparator_return < 0 )
+    const char           *p_records        = p_binary_tree->mapped.p_base + sizeof(p_binary_tree->metadata);
+    unsigned long long    node_quantity    = p_binary_tree->metadata.node_quantity,
+                          node_size        = p_binary_tree->metadata.node_size,
+                          node_pointer     = 0;
+    fn_tree_equal        *pfn_is_equal     = p_binary_tree->functions.pfn_is_equal;
+    fn_tree_key_accessor *pfn_key_accessor = p_binary_tree->functions.pfn_key_accessor;
+
+    // Follow the node pointers in the file
+    while ( node_pointer < node_quantity )
     {
 
-        // If the left node exists ...
-        if ( p_node->p_left )
+        // Initialized data
+        const char *p_record          = p_records + ( node_pointer * node_size );
+        int         comparator_return = pfn_is_equal(pfn_key_accessor(p_record), p_key);
+
+        // Found
+        if ( comparator_return == 0 )
         {
 
-            // ... update the state ...
-            p_node = p_node->p_left;
+            // Return a pointer to the caller
+            *pp_value = (void *) p_record;
 
-            // ... and try again
-            goto try_again;
+            // Success
+            return 1;
         }
 
-        // Unlock
-        mutex_unlock(&p_binary_tree->_lock);
-        
-        // Error
-        return 0;
+        // Read the left pointer IF the key is on the left ELSE the right pointer
+        memcpy(&node_pointer, p_record + node_size - ( ( comparator_return < 0 ) ? 2 : 1 ) * sizeof(unsigned long long), sizeof(unsigned long long));
     }
 
-    // Search the right node
-    else if ( comparator_return > 0 )
-    {
+    // Not found
+    return 0;
+}
 
-        // If the right node exists ...
-        if ( p_node->p_right )
-        {
+int binary_tree_traverse_preorder_mapped ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse )
+{
 
-            // ... update the state ...
-            p_node = p_node->p_right;
+    // State check
+    if ( node_pointer >= p_binary_tree->metadata.node_quantity ) return 0;
 
-            // ... and try again
-            goto try_again;
-        }
+    // Initialized data
+    const char         *p_record      = p_binary_tree->mapped.p_base + sizeof(p_binary_tree->metadata) + ( node_pointer * p_binary_tree->metadata.node_size );
+    unsigned long long  left_pointer  = 0,
+                        right_pointer = 0;
 
-        // Unlock
-        mutex_unlock(&p_binary_tree->_lock);
-    
-        // Error
-        return 0;
-    }
+    // Read the node pointers
+    memcpy(&left_pointer, p_record + p_binary_tree->metadata.node_size - ( 2 * sizeof(unsigned long long) ), sizeof(unsigned long long));
+    memcpy(&right_pointer, p_record + p_binary_tree->metadata.node_size - sizeof(unsigned long long), sizeof(unsigned long long));
 
-    // Return a pointer to the caller
-    *pp_value = p_node->p_value;
+    // Root
+    pfn_traverse((void *) p_record);
 
-    // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+    // Left
+    if ( left_pointer != eight_bytes_of_f ) binary_tree_traverse_preorder_mapped(p_binary_tree, left_pointer, pfn_traverse);
+
+    // Right
+    if ( right_pointer != eight_bytes_of_f ) binary_tree_traverse_preorder_mapped(p_binary_tree, right_pointer, pfn_traverse);
 
     // Success
     return 1;
+}
 
-    // Error handling
-    {
+int binary_tree_traverse_inorder_mapped ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse )
+{
 
-        // Argument errors
-        {
-            no_binary_tree:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+    // State check
+    if ( node_pointer >= p_binary_tree->metadata.node_quantity ) return 0;
 
-                // Error
-                return 0;
-        }
-    }
+    // Initialized data
+    const char         *p_record      = p_binary_tree->mapped.p_base + sizeof(p_binary_tree->metadata) + ( node_pointer * p_binary_tree->metadata.node_size );
+    unsigned long long  left_pointer  = 0,
+                        right_pointer = 0;
+
+    // Read the node pointers
+    memcpy(&left_pointer, p_record + p_binary_tree->metadata.node_size - ( 2 * sizeof(unsigned long long) ), sizeof(unsigned long long));
+    memcpy(&right_pointer, p_record + p_binary_tree->metadata.node_size - sizeof(unsigned long long), sizeof(unsigned long long));
+
+    // Left
+    if ( left_pointer != eight_bytes_of_f ) binary_tree_traverse_inorder_mapped(p_binary_tree, left_pointer, pfn_traverse);
+
+    // Root
+    pfn_traverse((void *) p_record);
+
+    // Right
+    if ( right_pointer != eight_bytes_of_f ) binary_tree_traverse_inorder_mapped(p_binary_tree, right_pointer, pfn_traverse);
+
+    // Success
+    return 1;
 }
 
-int binary_tree_insert ( binary_tree *const p_binary_tree, const void *const p_value )
+int binary_tree_traverse_postorder_mapped ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse )
 {
 
-    // Argument check
-    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    // State check
+    if ( node_pointer >= p_binary_tree->metadata.node_quantity ) return 0;
 
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
+    // Initialized data
+    const char         *p_record      = p_binary_tree->mapped.p_base + sizeof(p_binary_tree->metadata) + ( node_pointer * p_binary_tree->metadata.node_size );
+    unsigned long long  left_pointer  = 0,
+                        right_pointer = 0;
+
+    // Read the node pointers
+    memcpy(&left_pointer, p_record + p_binary_tree->metadata.node_size - ( 2 * sizeof(unsigned long long) ), sizeof(unsigned long long));
+    memcpy(&right_pointer, p_record + p_binary_tree->metadata.node_size - sizeof(unsigned long long), sizeof(unsigned long long));
+
+    // Left
+    if ( left_pointer != eight_bytes_of_f ) binary_tree_traverse_postorder_mapped(p_binary_tree, left_pointer, pfn_traverse);
+
+    // Right
+    if ( right_pointer != eight_bytes_of_f ) binary_tree_traverse_postorder_mapped(p_binary_tree, right_pointer, pfn_traverse);
+
+    // Root
+    pfn_traverse((void *) p_record);
+
+    // Success
+    return 1;
+}
+
+const char *binary_tree_lazy_fetch ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, unsigned long long *p_left_pointer, unsigned long long *p_right_pointer )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree is not lazy.
+    //       Check your parameters before you call.
 
     // Initialized data
-    binary_tree_node *p_node = p_binary_tree->p_root;
-    int comparator_return = 0;
+    binary_tree_lazy_cache *p_cache   = p_binary_tree->lazy.p_cache;
+    binary_tree_lazy_entry *p_entry   = (void *) 0;
+    size_t                  node_size = (size_t) p_binary_tree->metadata.node_size,
+                           *p_link    = &p_cache->p_buckets[node_pointer & p_cache->bucket_mask],
+                            i         = 0;
+
+    // Grow the calling thread's record buffer
+    if ( binary_tree_lazy_record_size < node_size )
+    {
 
-    // State check
-    if ( p_binary_tree->p_root == (void *) 0 ) goto no_root;
+        // Initialized data
+        char *p_record = TREE_REALLOC(p_binary_tree_lazy_record, node_size);
 
-    try_again:
+        // Error check
+        if ( p_record == (void *) 0 ) goto no_mem;
 
-    // Which side? 
-    comparator_return = p_binary_tree->functions.pfn_is_equal
-    (
-        p_binary_tree->functions.pfn_key_accessor(p_node->p_value),
-        p_binary_tree->functions.pfn_key_accessor(p_value)
-    );
+        // Release the buffer when the thread exits
+        pthread_once(&binary_tree_lazy_record_key_once, binary_tree_lazy_record_key_create);
+        pthread_setspecific(binary_tree_lazy_record_key, p_record);
 
-    // Store the node on the left 
-    if ( comparator_return < 0 )
+        // Store the buffer
+        p_binary_tree_lazy_record    = p_record;
+        binary_tree_lazy_record_size = node_size;
+    }
+
+    // Lock the record cache. Readers of the binary tree share its lock, but 
+    // every fetch can move the clock hand and evict a record
+    mutex_lock(&p_cache->_lock);
+
+    // Store the first entry in the bucket
+    i = *p_link;
+
+    // Look for the record in its bucket
+    while ( i != SIZE_MAX )
     {
 
-        // If the left node is occupied ...
-        if ( p_node->p_left )
-        {
+        // Store the entry
+        p_entry = &p_cache->p_entries[i];
 
-            // ... update the state ...
-            p_node = p_node->p_left;
+        // Cache hit
+        if ( p_entry->node_pointer == node_pointer ) goto done;
 
-            // ... and try again
-            goto try_again;
-        }
+        // Next
+        i = p_entry->next;
+    }
 
-        // Construct a binary tree node
-        if ( binary_tree_node_allocate(p_binary_tree, &p_node->p_left) == 0 ) goto failed_to_allocate_binary_tree_node;
+    // Use a fresh entry while there are some
+    if ( p_cache->used < p_cache->quantity ) 
+    {
 
-        // Store the value
-        p_node->p_left->p_value = (void *) p_value;
+        // Store the entry
+        i = p_cache->used++;
+        p_entry = &p_cache->p_entries[i];
+
+        // The entry owns a record in the record buffer
+        p_entry->p_record = &p_cache->p_records[i * node_size];
     }
 
-    // Store the node on the right
-    else if ( comparator_return > 0 )
+    // Evict an entry
+    else
     {
 
-        // If the left node is occupied ...
-        if ( p_node->p_right )
+        // Initialized data
+        size_t *p_victim_link = (void *) 0;
+
+        // Advance the clock hand past recently used entries, clearing their 
+        // reference bits as it goes. The root is in the first entry, and is 
+        // never evicted
+        for (;;)
         {
 
-            // ... update the state ...
-            p_node = p_node->p_right;
+            // Store the entry
+            p_entry = &p_cache->p_entries[p_cache->hand];
 
-            // ... and try again
-            goto try_again;
+            // Found an entry that has not been used since the last pass
+            if ( p_entry->referenced == false ) break;
+
+            // Give the entry a second chance
+            p_entry->referenced = false;
+
+            // Advance the clock hand
+            p_cache->hand = ( p_cache->hand + 1 < p_cache->quantity ) ? p_cache->hand + 1 : 1;
         }
 
-        // Construct a binary tree node
-        if ( binary_tree_node_allocate(p_binary_tree, &p_node->p_right) == 0 ) goto failed_to_allocate_binary_tree_node;
+        // Store the entry
+        i = p_cache->hand;
 
-        // Store the value
-        p_node->p_right->p_value = (void *) p_value;
-        
+        // Advance the clock hand
+        p_cache->hand = ( p_cache->hand + 1 < p_cache->quantity ) ? p_cache->hand + 1 : 1;
+
+        // Unlink the entry from its bucket
+        for (p_victim_link = &p_cache->p_buckets[p_entry->node_pointer & p_cache->bucket_mask]; *p_victim_link != SIZE_MAX; p_victim_link = &p_cache->p_entries[*p_victim_link].next)
+        {
+
+            // Skip other entries
+            if ( *p_victim_link != i ) continue;
+
+            // Unlink
+            *p_victim_link = p_entry->next;
+
+            // Done
+            break;
+        }
     }
 
-    // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+    // The entry is unlinked until its record is read
+    p_entry->node_pointer = eight_bytes_of_f;
 
-    // Success
-    return 1;
+    // Read the record
+    if ( fseek(p_binary_tree->p_random_access, (long) ( sizeof(p_binary_tree->metadata) + ( node_pointer * node_size ) ), SEEK_SET) != 0 ) goto failed_to_read_record;
+    if ( fread(p_entry->p_record, node_size, 1, p_binary_tree->p_random_access) != 1 ) goto failed_to_read_record;
 
-    // This branch runs if there is no root node
-    no_root:
-    {
+    // Read the node pointers
+    memcpy(&p_entry->left_pointer, p_entry->p_record + node_size - ( 2 * sizeof(unsigned long long) ), sizeof(unsigned long long));
+    memcpy(&p_entry->right_pointer, p_entry->p_record + node_size - sizeof(unsigned long long), sizeof(unsigned long long));
 
-        // Initialized data
-        p_node = (void *) 0;
+    // Link the entry into its bucket
+    p_entry->node_pointer = node_pointer;
+    p_entry->next         = *p_link;
+    *p_link               = i;
 
-        // Construct a binary tree node
-        if ( binary_tree_node_allocate(p_binary_tree, &p_node) == 0 ) goto failed_to_allocate_binary_tree_node;
+    done:
 
-        // Store the value
-        p_node->p_value = (void *) p_value;
+    // Mark the entry as recently used
+    p_entry->referenced = true;
 
-        // Store the node as the root of the tree
-        p_binary_tree->p_root = p_node;
+    // Copy the record out of the cache, so another thread can evict it
+    memcpy(p_binary_tree_lazy_record, p_entry->p_record, node_size);
 
-        // Unlock
-        mutex_unlock(&p_binary_tree->_lock);
-        
-        // Success
-        return 1;
-    }
+    // Return the node pointers to the caller
+    *p_left_pointer  = p_entry->left_pointer;
+    *p_right_pointer = p_entry->right_pointer;
+
+    // Unlock the record cache
+    mutex_unlock(&p_cache->_lock);
+
+    // Success
+    return p_binary_tree_lazy_record;
 
     // Error handling
     {
 
-        // Argument errors
+        // Standard library errors
         {
-            no_binary_tree:
+            no_mem:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
-                return 0;
-        }
+                return (void *) 0;
 
-        // Tree errors
-        {
-            failed_to_allocate_binary_tree_node:
+            failed_to_read_record:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to read record %llu in call to function \"%s\"\n", node_pointer, __FUNCTION__);
                 #endif
 
-                // Unlock
-                mutex_unlock(&p_binary_tree->_lock);
-                
+                // Unlock the record cache
+                mutex_unlock(&p_cache->_lock);
+
                 // Error
-                return 0;
+                return (void *) 0;
+        }
+    }
+}
+
+void binary_tree_lazy_record_key_create ( void )
+{
+
+    // Release record buffers when their threads exit
+    pthread_key_create(&binary_tree_lazy_record_key, binary_tree_lazy_record_release);
+}
+
+void binary_tree_lazy_record_release ( void *p_record )
+{
+
+    // Release the record buffer
+    p_record = TREE_REALLOC(p_record, 0);
+}
+
+int binary_tree_search_lazy ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value )
+{
+
+    // Initialized data
+    unsigned long long    node_quantity    = p_binary_tree->metadata.node_quantity,
+                          node_pointer     = 0,
+                          left_pointer     = 0,
+                          right_pointer    = 0;
+    fn_tree_equal        *pfn_is_equal     = p_binary_tree->functions.pfn_is_equal;
+    fn_tree_key_accessor *pfn_key_accessor = p_binary_tree->functions.pfn_key_accessor;
+
+    // Follow the node pointers in the file
+    while ( node_pointer < node_quantity )
+    {
+
+        // Initialized data
+        const char *p_record          = binary_tree_lazy_fetch(p_binary_tree, node_pointer, &left_pointer, &right_pointer);
+        int         comparator_return = 0;
+
+        // Error check
+        if ( p_record == (void *) 0 ) return 0;
+
+        // Which side? 
+        comparator_return = pfn_is_equal(pfn_key_accessor(p_record), p_key);
+
+        // Found
+        if ( comparator_return == 0 )
+        {
+
+            // Return a pointer to the caller
+            *pp_value = (void *) p_record;
+
+            // Success
+            return 1;
         }
+
+        // Follow the left pointer IF the key is on the left ELSE the right pointer
+        node_pointer = ( comparator_return < 0 ) ? left_pointer : right_pointer;
     }
+
+    // Not found
+    return 0;
 }
 
-int binary_tree_remove ( binary_tree *const p_binary_tree, const void *const p_key, const void **const pp_value )
-{
+int binary_tree_traverse_preorder_lazy ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // State check
+    if ( node_pointer >= p_binary_tree->metadata.node_quantity ) return 0;
+
+    // Initialized data
+    unsigned long long  left_pointer  = 0,
+                        right_pointer = 0;
+    const char         *p_record      = binary_tree_lazy_fetch(p_binary_tree, node_pointer, &left_pointer, &right_pointer);
+
+    // Error check
+    if ( p_record == (void *) 0 ) return 0;
+
+    // Root
+    pfn_traverse((void *) p_record);
+
+    // Left
+    if ( left_pointer != eight_bytes_of_f ) if ( binary_tree_traverse_preorder_lazy(p_binary_tree, left_pointer, pfn_traverse) == 0 ) return 0;
 
-    // Argument check
-    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
+    // Right
+    if ( right_pointer != eight_bytes_of_f ) if ( binary_tree_traverse_preorder_lazy(p_binary_tree, right_pointer, pfn_traverse) == 0 ) return 0;
 
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
+    // Success
+    return 1;
+}
+
+int binary_tree_traverse_inorder_lazy ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse )
+{
 
     // State check
-    if ( p_binary_tree->p_root == (void *) 0 ) return 0;
+    if ( node_pointer >= p_binary_tree->metadata.node_quantity ) return 0;
 
     // Initialized data
-    binary_tree_node *p_node  = p_binary_tree->p_root;
-    void *p_value = 0;
-    int comparator_return = 0;
+    unsigned long long  left_pointer  = 0,
+                        right_pointer = 0;
+    const char         *p_record      = binary_tree_lazy_fetch(p_binary_tree, node_pointer, &left_pointer, &right_pointer);
 
-    try_again:
+    // Error check
+    if ( p_record == (void *) 0 ) return 0;
 
-    // Which side? 
-    comparator_return = p_binary_tree->functions.pfn_is_equal(
-        p_binary_tree->functions.pfn_key_accessor( p_node->p_value ),
-        p_key
-    );
+    // Left
+    if ( left_pointer != eight_bytes_of_f ) if ( binary_tree_traverse_inorder_lazy(p_binary_tree, left_pointer, pfn_traverse) == 0 ) return 0;
 
-    // Check the node on the left 
-    if ( comparator_return < 0 )
-    {
+    // The left subtree may have evicted the record
+    p_record = binary_tree_lazy_fetch(p_binary_tree, node_pointer, &left_pointer, &right_pointer);
 
-        // If the left node is occupied ...
-        if ( p_node->p_left )
-        {
-            
-            // If the left node is the target, remove it ...
-            if ( p_binary_tree->functions.pfn_is_equal(p_binary_tree->functions.pfn_key_accessor(p_node->p_left->p_value), p_key) == 0 ) goto remove_left;
+    // Error check
+    if ( p_record == (void *) 0 ) return 0;
 
-            // ... otherwise, update the state ...
-            p_node = p_node->p_left;
+    // Root
+    pfn_traverse((void *) p_record);
 
-            // ... and try again
-            goto try_again;
-        }
+    // Right
+    if ( right_pointer != eight_bytes_of_f ) if ( binary_tree_traverse_inorder_lazy(p_binary_tree, right_pointer, pfn_traverse) == 0 ) return 0;
 
-        // Error
-        return 0;
-    }
+    // Success
+    return 1;
+}
 
-    // Check the node on the right
-    else if ( comparator_return > 0 )
-    {
+int binary_tree_traverse_postorder_lazy ( const binary_tree *const p_binary_tree, unsigned long long node_pointer, fn_binary_tree_traverse *pfn_traverse )
+{
 
-        // If the left node is occupied ...
-        if ( p_node->p_right )
-        {
+    // State check
+    if ( node_pointer >= p_binary_tree->metadata.node_quantity ) return 0;
 
-            // If the left node is the target, remove it ...
-            if ( p_binary_tree->functions.pfn_is_equal(p_binary_tree->functions.pfn_key_accessor(p_node->p_right->p_value), p_key) == 0 ) goto remove_right;
+    // Initialized data
+    unsigned long long  left_pointer  = 0,
+                        right_pointer = 0;
+    const char         *p_record      = binary_tree_lazy_fetch(p_binary_tree, node_pointer, &left_pointer, &right_pointer);
 
-            // ... otherwise, update the state ...
-            p_node = p_node->p_right;
+    // Error check
+    if ( p_record == (void *) 0 ) return 0;
 
-            // ... and try again
-            goto try_again;
-        }
+    // Left
+    if ( left_pointer != eight_bytes_of_f ) if ( binary_tree_traverse_postorder_lazy(p_binary_tree, left_pointer, pfn_traverse) == 0 ) return 0;
 
-        // Error
-        return 0;
-    }
+    // Right
+    if ( right_pointer != eight_bytes_of_f ) if ( binary_tree_traverse_postorder_lazy(p_binary_tree, right_pointer, pfn_traverse) == 0 ) return 0;
 
-    done:
+    // The subtrees may have evicted the record
+    p_record = binary_tree_lazy_fetch(p_binary_tree, node_pointer, &left_pointer, &right_pointer);
 
-    // Return a pointer to the caller
-    *pp_value = p_value;
+    // Error check
+    if ( p_record == (void *) 0 ) return 0;
 
-    // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+    // Root
+    pfn_traverse((void *) p_record);
 
     // Success
     return 1;
+}
 
-    // Remove left
-    remove_left:
-    {
+int binary_tree_lazy_cache_destroy ( binary_tree_lazy_cache *p_binary_tree_lazy_cache )
+{
 
-        // Initialized data
-        binary_tree_node *p_left = p_node->p_left;
+    // Release the lock
+    mutex_destroy(&p_binary_tree_lazy_cache->_lock);
 
-        // Store the return value
-        p_value = p_left->p_value;
+    // Release the entries, the buckets, and the records
+    if ( p_binary_tree_lazy_cache->p_entries ) p_binary_tree_lazy_cache->p_entries = TREE_REALLOC(p_binary_tree_lazy_cache->p_entries, 0);
+    if ( p_binary_tree_lazy_cache->p_buckets ) p_binary_tree_lazy_cache->p_buckets = TREE_REALLOC(p_binary_tree_lazy_cache->p_buckets, 0);
+    if ( p_binary_tree_lazy_cache->p_records ) p_binary_tree_lazy_cache->p_records = TREE_REALLOC(p_binary_tree_lazy_cache->p_records, 0);
 
-        // Leaf
-        if ( ( p_left->p_left || p_left->p_right ) == 0 )
-        {
+    // Release the record cache
+    p_binary_tree_lazy_cache = TREE_REALLOC(p_binary_tree_lazy_cache, 0);
 
-            // Free the node
-            binary_tree_node_destroy(&p_node->p_left);
-        }
+    // Success
+    return 1;
+}
 
-        // Left
-        else if ( p_left->p_left && ( p_left->p_right == 0 ) )
-        {
-            
-            // Update the new left node
-            p_left = p_left->p_left;
+int binary_tree_serialize_nodes ( FILE *p_file, const binary_tree_snapshot *p_binary_tree_snapshot, fn_binary_tree_serialize *pfn_binary_tree_serialize )
+{
 
-            // Free the node
-            binary_tree_node_destroy(&p_node->p_left);
+    // Argument check
+    if ( p_file                    == (void *) 0 ) goto no_file;
+    if ( p_binary_tree_snapshot    == (void *) 0 ) goto no_binary_tree_snapshot;
+    if ( pfn_binary_tree_serialize == (void *) 0 ) goto no_binary_tree_serializer; 
 
-            // Repair the tree
-            p_node->p_left = p_left;
-        }
+    // Initialized data
+    size_t              node_size       = (size_t) p_binary_tree_snapshot->p_binary_tree->metadata.node_size,
+                        node_quantity   = (size_t) p_binary_tree_snapshot->node_quantity,
+                        record_quantity = ( BINARY_TREE_SERIALIZE_BUFFER_SIZE / node_size ) ? ( BINARY_TREE_SERIALIZE_BUFFER_SIZE / node_size ) : 1,
+                        head            = 0,
+                        tail            = 0,
+                        records         = 0;
+    binary_tree_node  **pp_queue        = (void *) 0;
+    char               *p_buffer        = (void *) 0;
+    FILE               *p_buffer_file   = (void *) 0;
+    unsigned long long  left_pointer    = eight_bytes_of_f,
+                        right_pointer   = eight_bytes_of_f;
 
-        // Right
-        else if ( ( p_left->p_left == 0 ) && p_left->p_right )
-        {
-            
-            // Update the new left node
-            p_left = p_left->p_right;
+    // Fast exit
+    if ( p_binary_tree_snapshot->p_root == (void *) 0 ) return 1;
 
-            // Free the node
-            binary_tree_node_destroy(&p_node->p_left);
+    // Allocate the breadth first queue
+    pp_queue = TREE_REALLOC(0, node_quantity * sizeof(binary_tree_node *));
 
-            // Repair the tree
-            p_node->p_left = p_left;
-        }
+    // Error check
+    if ( pp_queue == (void *) 0 ) goto no_mem;
 
-        // TODO: Left AND right
-        else
-        {
-            // Find the successor
-            // Swap the successor
-            // Done
-        }
-        
-        // Done
-        goto done;
-    }
+    // Allocate the record buffer. The extra byte absorbs the null terminator 
+    // that fmemopen writes after the last byte written to the stream
+    p_buffer = TREE_REALLOC(0, ( record_quantity * node_size ) + 1);
 
-    // Remove right
-    remove_right:
-    {
+    // Error check
+    if ( p_buffer == (void *) 0 ) goto no_mem;
 
-        // Initialized data
-        binary_tree_node *p_right = p_node->p_right;
-        
-        // Store the return value
-        p_value = p_right->p_value;
+    // Open the record buffer as a stream, so the node serializer can write to it
+    p_buffer_file = fmemopen(p_buffer, ( record_quantity * node_size ) + 1, "w");
 
-        // Leaf
-        if ( ( p_right->p_left || p_right->p_right ) == 0 )
-        {
+    // Error check
+    if ( p_buffer_file == (void *) 0 ) goto failed_to_open_buffer;
 
-            // Free the node
-            binary_tree_node_destroy(&p_node->p_right);
-        }
+    // Write straight through to the record buffer
+    setvbuf(p_buffer_file, (void *) 0, _IONBF, 0);
+
+    // Enqueue the root node
+    pp_queue[tail++] = p_binary_tree_snapshot->p_root;
+
+    // Write each node in breadth first order. A node's position in the queue 
+    // is its node pointer in the file, so the root is always the first record
+    while ( head < tail )
+    {
 
+        // Initialized data
+        binary_tree_node *p_binary_tree_node = pp_queue[head++];
+        size_t            offset             = records * node_size;
 
-        // Left
-        else if ( p_right->p_left && ( p_right->p_right == 0 ) )
+        // Enqueue the left node
+        if ( p_binary_tree_node->p_left )
         {
             
-            // Update the new left node
-            p_right = p_right->p_left;
+            // Error check
+            if ( tail == node_quantity ) goto wrong_node_quantity;
 
-            // Free the node
-            binary_tree_node_destroy(&p_node->p_right);
+            // Store the left pointer
+            left_pointer = tail;
 
-            // Repair the tree
-            p_node->p_right = p_right;
+            // Enqueue the left node
+            pp_queue[tail++] = p_binary_tree_node->p_left;
         }
+        else left_pointer = eight_bytes_of_f;
 
-        // Right
-        else if ( ( p_right->p_left == 0 ) && p_right->p_right )
+        // Enqueue the right node
+        if ( p_binary_tree_node->p_right )
         {
-            
-            // Update the new left node
-            p_right = p_right->p_right;
 
-            // Free the node
-            binary_tree_node_destroy(&p_node->p_right);
+            // Error check
+            if ( tail == node_quantity ) goto wrong_node_quantity;
 
-            // Repair the tree
-            p_node->p_right = p_right;
-        }
+            // Store the right pointer
+            right_pointer = tail;
 
-        // TODO: Left AND right
-        else
-        {
-            // Find the successor
-            // Swap the successor
-            // Done
+            // Enqueue the right node
+            pp_queue[tail++] = p_binary_tree_node->p_right;
         }
+        else right_pointer = eight_bytes_of_f;
 
-        // Done
-        goto done;
-    }
+        // Clear the record, in case the node serializer writes a short record
+        memset(&p_buffer[offset], 0, node_size);
 
-    // Error handling
-    {
+        // Set the pointer correctly
+        fseek(p_buffer_file, (long) offset, SEEK_SET);
 
-        // Argument errors
-        {
-            no_binary_tree:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+        // Serialize the node
+        pfn_binary_tree_serialize(p_buffer_file, p_binary_tree_node);
 
-                // Error
-                return 0;
-        }
-    }
-}
+        // Set the pointer correctly
+        fseek(p_buffer_file, (long) ( offset + node_size - ( 2 * sizeof(unsigned long long) ) ), SEEK_SET);
 
-int binary_tree_traverse_preorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse )
-{
+        // Write the left pointer to the record
+        fwrite(&left_pointer, sizeof(unsigned long long), 1, p_buffer_file);
 
-    // Argument check
-    if ( p_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
-    if ( pfn_traverse       == (void *) 0 ) goto no_traverse_function;
+        // Write the right pointer to the record
+        fwrite(&right_pointer, sizeof(unsigned long long), 1, p_buffer_file);
 
-    // Root
-    pfn_traverse(p_binary_tree_node->p_value);
+        // Increment the record quantity
+        records++;
 
-    // Left
-    if ( p_binary_tree_node->p_left ) binary_tree_traverse_preorder_node(p_binary_tree_node->p_left, pfn_traverse);
+        // Write the record buffer to the file when it is full, or when there are no more nodes
+        if ( records == record_quantity || head == tail )
+        {
 
-    // Right
-    if ( p_binary_tree_node->p_right ) binary_tree_traverse_preorder_node(p_binary_tree_node->p_right, pfn_traverse);
+            // Write the records
+            if ( fwrite(p_buffer, node_size, records, p_file) != records ) goto failed_to_write_file;
+
+            // Reset the record quantity
+            records = 0;
+        }
+    }
+
+    // Clean up
+    fclose(p_buffer_file);
+    p_buffer = TREE_REALLOC(p_buffer, 0);
+    pp_queue = TREE_REALLOC(pp_queue, 0);
 
     // Success
     return 1;
-
+    
     // Error handling
     {
 
         // Argument errors
         {
-            no_binary_tree_node:
+            no_file:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+            
+            no_binary_tree_snapshot:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            no_traverse_function:
+                // Error
+                return 0;
+            
+            no_binary_tree_serializer:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_binary_tree_serialize\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
+
+        // Tree errors
+        {
+            wrong_node_quantity:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Binary tree has more nodes than its node quantity in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+
+            failed_to_open_buffer:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"fmemopen\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+
+            failed_to_write_file:
+                #ifndef NDEBUG
+                    printf("[Standard Library] Call to function \"fwrite\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                goto clean_up;
+        }
+
+        clean_up:
+
+            // Release the buffer stream
+            if ( p_buffer_file ) fclose(p_buffer_file);
+
+            // Release the buffers
+            if ( p_buffer ) p_buffer = TREE_REALLOC(p_buffer, 0);
+            if ( pp_queue ) pp_queue = TREE_REALLOC(pp_queue, 0);
+
+            // Error
+            return 0;
     }
 }
 
-int binary_tree_traverse_inorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse )
+int binary_tree_serialize ( binary_tree *const p_binary_tree, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node )
 {
 
     // Argument check
-    if ( p_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
-    if ( pfn_traverse       == (void *) 0 ) goto no_traverse_function;
+    if ( p_binary_tree      == (void *) 0 ) goto no_binary_tree;
+    if ( p_path             == (void *) 0 ) goto no_file;
+    if ( pfn_serialize_node == (void *) 0 ) goto no_serializer;
 
-    // Left
-    if ( p_binary_tree_node->p_left ) binary_tree_traverse_inorder_node(p_binary_tree_node->p_left, pfn_traverse);
+    // Initialized data
+    binary_tree_snapshot *p_binary_tree_snapshot = (void *) 0;
+    int                   result                 = 0;
 
-    // Root
-    pfn_traverse(p_binary_tree_node->p_value);
+    // Take a snapshot
+    if ( binary_tree_snapshot_construct(p_binary_tree, &p_binary_tree_snapshot) == 0 ) goto failed_to_snapshot;
 
-    // Right
-    if ( p_binary_tree_node->p_right ) binary_tree_traverse_inorder_node(p_binary_tree_node->p_right, pfn_traverse);
+    // Write the snapshot
+    result = binary_tree_snapshot_serialize(p_binary_tree_snapshot, p_path, pfn_serialize_node);
 
-    // Success
-    return 1;
+    // Release the snapshot
+    binary_tree_snapshot_destroy(&p_binary_tree_snapshot);
+
+    // Done
+    return result;
 
     // Error handling
     {
 
         // Argument errors
         {
-            no_binary_tree_node:
+            no_binary_tree:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+            
+            no_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            no_traverse_function:
+                // Error
+                return 0;
+
+            no_serializer:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_serialize_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    
+        // Tree errors
+        {
+            failed_to_snapshot:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to snapshot binary tree in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -1014,64 +7382,60 @@ int binary_tree_traverse_inorder_node ( binary_tree_node *p_binary_tree_node, fn
     }
 }
 
-int binary_tree_traverse_postorder_node ( binary_tree_node *p_binary_tree_node, fn_binary_tree_traverse *pfn_traverse )
+int binary_tree_checkpoint ( binary_tree *const p_binary_tree, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node )
 {
 
     // Argument check
-    if ( p_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
-    if ( pfn_traverse       == (void *) 0 ) goto no_traverse_function;
+    if ( p_binary_tree      == (void *) 0 ) goto no_binary_tree;
+    if ( p_path             == (void *) 0 ) goto no_file;
+    if ( pfn_serialize_node == (void *) 0 ) goto no_serializer;
 
-    // Left
-    if ( p_binary_tree_node->p_left ) binary_tree_traverse_postorder_node(p_binary_tree_node->p_left, pfn_traverse);
+    // Initialized data
+    int result = 0;
 
-    // Right
-    if ( p_binary_tree_node->p_right ) binary_tree_traverse_postorder_node(p_binary_tree_node->p_right, pfn_traverse);
+    // Lock
+    binary_tree_write_lock(p_binary_tree);
 
-    // Root
-    pfn_traverse(p_binary_tree_node->p_value);
+    // State check
+    if ( p_binary_tree->mapped.p_base || p_binary_tree->lazy.p_cache ) goto read_only;
 
-    // Success
-    return 1;
+    // Patch the file IF it is the file of the last checkpoint
+    if ( p_binary_tree->checkpoint.p_path && p_binary_tree->p_random_access && p_binary_tree->checkpoint.invalid == false && strcmp(p_binary_tree->checkpoint.p_path, p_path) == 0 )
+        result = binary_tree_checkpoint_incremental(p_binary_tree, pfn_serialize_node);
 
-    // Error handling
+    // Write a new file
+    else
     {
 
-        // Argument errors
-        {
-            no_binary_tree_node:
-                #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-
-            no_traverse_function:
-                #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+        // Initialized data
+        size_t  path_length = strlen(p_path);
+        char   *p_copy      = TREE_REALLOC(p_binary_tree->checkpoint.p_path, path_length + 1);
 
-                // Error
-                return 0;
-        }
-    }
-}
+        // Error check
+        if ( p_copy == (void *) 0 ) goto no_mem;
 
-int binary_tree_traverse_preorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse )
-{
+        // Store the path
+        memcpy(p_copy, p_path, path_length + 1);
+        p_binary_tree->checkpoint.p_path = p_copy;
 
-    // Argument check
-    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
-    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+        // Close the last checkpoint file
+        if ( p_binary_tree->p_random_access ) fclose(p_binary_tree->p_random_access);
 
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
+        // Open the file
+        p_binary_tree->p_random_access = fopen(p_path, "wb+");
 
-    // Traverse the tree
-    if ( binary_tree_traverse_preorder_node(p_binary_tree->p_root, pfn_traverse) == 0 ) goto failed_to_traverse_binary_tree;    
+        // Error check
+        if ( p_binary_tree->p_random_access == (void *) 0 ) goto failed_to_open_file;
+
+        // Write every node
+        result = binary_tree_checkpoint_full(p_binary_tree, pfn_serialize_node);
+    }
+
+    // Error check
+    if ( result == 0 ) goto failed_to_write_checkpoint;
 
     // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+    binary_tree_unlock(p_binary_tree);
 
     // Success
     return 1;
@@ -1083,15 +7447,23 @@ int binary_tree_traverse_preorder ( binary_tree *const p_binary_tree, fn_binary_
         {
             no_binary_tree:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+            
+            no_file:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            no_traverse_function:
+                // Error
+                return 0;
+
+            no_serializer:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_serialize_node\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -1100,93 +7472,128 @@ int binary_tree_traverse_preorder ( binary_tree *const p_binary_tree, fn_binary_
 
         // Tree errors
         {
-            failed_to_traverse_binary_tree:
+            read_only:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Failed to traverse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] File backed binary tree is read only in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
                 // Unlock
-                mutex_unlock(&p_binary_tree->_lock);
-                
+                binary_tree_unlock(p_binary_tree);
+
                 // Error
                 return 0;
-        }
-    }
-}
-
-int binary_tree_traverse_inorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse )
-{
-
-    // Argument check
-    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
-    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
-
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
 
-    // Traverse the tree
-    if ( binary_tree_traverse_inorder_node(p_binary_tree->p_root, pfn_traverse) == 0 ) goto failed_to_traverse_binary_tree;    
+            failed_to_write_checkpoint:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to write checkpoint in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+                // The file is in an unknown state. Rewrite it next time
+                p_binary_tree->checkpoint.invalid = true;
 
-    // Success
-    return 1;
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
 
-    // Error handling
-    {
+                // Error
+                return 0;
+        }
 
-        // Argument errors
+        // Standard library errors
         {
-            no_binary_tree:
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Unlock
+                binary_tree_unlock(p_binary_tree);
+
                 // Error
                 return 0;
 
-            no_traverse_function:
+            failed_to_open_file:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-        }
+                // Forget the path
+                p_binary_tree->checkpoint.p_path = TREE_REALLOC(p_binary_tree->checkpoint.p_path, 0);
 
-        // Tree errors
-        {
-            failed_to_traverse_binary_tree:
-                #ifndef NDEBUG
-                    log_error("[tree] [binary] Failed to traverse binary tree in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-                
                 // Unlock
-                mutex_unlock(&p_binary_tree->_lock);
-                
+                binary_tree_unlock(p_binary_tree);
+
                 // Error
                 return 0;
         }
     }
 }
 
-int binary_tree_traverse_postorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse )
+int binary_tree_checkpoint_full ( binary_tree *p_binary_tree, fn_binary_tree_serialize *pfn_serialize_node )
 {
 
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       pfn_serialize_node is null. Check your parameters before you call.
 
-    // Argument check
-    if ( p_binary_tree == (void *) 0 ) goto no_binary_tree;
-    if ( pfn_traverse  == (void *) 0 ) goto no_traverse_function;
+    // Initialized data
+    size_t                node_quantity          = (size_t) p_binary_tree->metadata.node_quantity,
+                          head                   = 0,
+                          tail                   = 0;
+    FILE                 *p_file                 = p_binary_tree->p_random_access;
+    binary_tree_snapshot  _snapshot              =
+    {
+        .p_binary_tree = p_binary_tree,
+        .p_root        = p_binary_tree->p_root,
+        .node_quantity = p_binary_tree->metadata.node_quantity
+    };
 
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
+    // Start over
+    p_binary_tree->checkpoint.invalid        = false;
+    p_binary_tree->checkpoint.slot_quantity  = node_quantity;
+    p_binary_tree->checkpoint.free_quantity  = 0;
+    p_binary_tree->checkpoint.dirty_quantity = 0;
 
-    // Traverse the tree
-    if ( binary_tree_traverse_postorder_node(p_binary_tree->p_root, pfn_traverse) == 0 ) goto failed_to_traverse_binary_tree;    
+    // Grow the slot table
+    if ( node_quantity && binary_tree_checkpoint_reserve(p_binary_tree, node_quantity - 1) == 0 ) goto failed_to_reserve;
 
-    // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+    // Clear the slot table and the dirty bits
+    if ( p_binary_tree->checkpoint.slot_capacity )
+    {
+        memset(p_binary_tree->checkpoint.pp_slots, 0, p_binary_tree->checkpoint.slot_capacity * sizeof(binary_tree_node *));
+        memset(p_binary_tree->checkpoint.p_dirty_bits, 0, p_binary_tree->checkpoint.slot_capacity / 8);
+    }
+
+    // Number the nodes in breadth first order, the order they are written in. 
+    // The slot table doubles as the queue
+    if ( p_binary_tree->p_root ) p_binary_tree->checkpoint.pp_slots[tail++] = p_binary_tree->p_root;
+
+    // Walk the queue
+    while ( head < tail )
+    {
+
+        // Initialized data
+        binary_tree_node *p_binary_tree_node = p_binary_tree->checkpoint.pp_slots[head];
+
+        // Store the node pointer
+        p_binary_tree_node->node_pointer = head++;
+
+        // Error check
+        if ( tail + ( p_binary_tree_node->p_left != (void *) 0 ) + ( p_binary_tree_node->p_right != (void *) 0 ) > node_quantity ) goto wrong_node_quantity;
+
+        // Enqueue the children
+        if ( p_binary_tree_node->p_left  ) p_binary_tree->checkpoint.pp_slots[tail++] = p_binary_tree_node->p_left;
+        if ( p_binary_tree_node->p_right ) p_binary_tree->checkpoint.pp_slots[tail++] = p_binary_tree_node->p_right;
+    }
+
+    // Write the metadata
+    fseek(p_file, 0, SEEK_SET);
+    fwrite(&p_binary_tree->metadata.node_quantity, sizeof(unsigned long long), 1, p_file);
+    fwrite(&p_binary_tree->metadata.node_size, sizeof(unsigned long long), 1, p_file);
+
+    // Write the nodes
+    if ( binary_tree_serialize_nodes(p_file, &_snapshot, pfn_serialize_node) == 0 ) goto failed_to_serialize_nodes;
+
+    // Flush the file
+    if ( fflush(p_file) ) goto failed_to_write_file;
 
     // Success
     return 1;
@@ -1194,79 +7601,244 @@ int binary_tree_traverse_postorder ( binary_tree *const p_binary_tree, fn_binary
     // Error handling
     {
 
-        // Argument errors
+        // Tree errors
         {
-            no_binary_tree:
+            failed_to_reserve:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Failed to grow checkpoint slot table in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
-            no_traverse_function:
+            wrong_node_quantity:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Binary tree has more nodes than its node quantity in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_serialize_nodes:
+                #ifndef NDEBUG
+                    printf("[tree] [binary] Failed to serialize nodes in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
 
-        // Tree errors
+        // Standard library errors
         {
-            failed_to_traverse_binary_tree:
+            failed_to_write_file:
                 #ifndef NDEBUG
-                    log_error("[tree] [binary] Failed to traverse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"fflush\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
-                // Unlock
-                mutex_unlock(&p_binary_tree->_lock);
-                
+
                 // Error
                 return 0;
         }
     }
 }
 
-int binary_tree_parse ( binary_tree **const pp_binary_tree, const char *p_file, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, fn_binary_tree_parse *pfn_parse_node )
+int binary_tree_checkpoint_incremental ( binary_tree *p_binary_tree, fn_binary_tree_serialize *pfn_serialize_node )
 {
-    
-    // Argument check
-    if ( pp_binary_tree == (void *) 0 ) goto no_binary_tree;
-    if ( p_file         == (void *) 0 ) goto no_file;
-    if ( pfn_parse_node == (void *) 0 ) goto no_parser;
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       pfn_serialize_node is null. Check your parameters before you call.
 
     // Initialized data
-    binary_tree *p_binary_tree = 0;
-    unsigned long long node_quantity = 0,
-                       node_size     = 0;
-    FILE *p_f = fopen(p_file, "rw");
+    size_t              node_quantity   = (size_t) p_binary_tree->metadata.node_quantity,
+                        node_size       = (size_t) p_binary_tree->metadata.node_size,
+                        record_quantity = ( BINARY_TREE_SERIALIZE_BUFFER_SIZE / node_size ) ? ( BINARY_TREE_SERIALIZE_BUFFER_SIZE / node_size ) : 1,
+                        top             = p_binary_tree->checkpoint.slot_quantity,
+                        records         = 0,
+                        first           = 0;
+    FILE               *p_file          = p_binary_tree->p_random_access,
+                       *p_buffer_file   = (void *) 0;
+    char               *p_buffer        = (void *) 0;
+    binary_tree_node   *p_root          = p_binary_tree->p_root;
+
+    // Move the root into the first record
+    if ( p_root && p_root->node_pointer != 0 )
+    {
 
-    // Read the metadata
+        // Initialized data
+        size_t            root_slot = (size_t) p_root->node_pointer;
+        binary_tree_node *p_other   = p_binary_tree->checkpoint.pp_slots[0],
+                         *p_parent  = ( p_other ) ? binary_tree_checkpoint_parent(p_binary_tree, p_other) : (void *) 0;
+
+        // Swap the records
+        p_root->node_pointer                          = 0;
+        p_binary_tree->checkpoint.pp_slots[0]         = p_root;
+        p_binary_tree->checkpoint.pp_slots[root_slot] = p_other;
+
+        // Mark the changed records
+        binary_tree_checkpoint_mark(p_binary_tree, p_root);
+
+        // The other node takes the root's old record
+        if ( p_other )
+        {
+
+            // Move the other node
+            p_other->node_pointer = root_slot;
+
+            // Mark the changed records
+            binary_tree_checkpoint_mark(p_binary_tree, p_other);
+            binary_tree_checkpoint_mark(p_binary_tree, p_parent);
+        }
+
+        // The root's old record is free
+        else
+        {
+
+            // Initialized data
+            binary_tree_node _free = { .node_pointer = root_slot };
+
+            // Free the record
+            binary_tree_checkpoint_slot_release(p_binary_tree, &_free);
+        }
+    }
+
+    // Fill each free record below the node quantity with a node from a record 
+    // at or above the node quantity. There are as many of one as the other
+    for (size_t i = 0; i < p_binary_tree->checkpoint.free_quantity; i++)
     {
 
-        // Set the cursor to the start of the file
-        fseek(p_f, 0, SEEK_SET);
+        // Initialized data
+        size_t            slot     = (size_t) p_binary_tree->checkpoint.p_free_slots[i];
+        binary_tree_node *p_node   = (void *) 0,
+                         *p_parent = (void *) 0;
 
-        // Read the quantity of nodes
-        fread(&node_quantity, sizeof(unsigned long long), 1, p_f);
+        // Skip records that stay past the end of the file, or that are in use
+        if ( slot >= node_quantity || p_binary_tree->checkpoint.pp_slots[slot] ) continue;
 
-        // Read the size of a node
-        fread(&node_size, sizeof(unsigned long long), 1, p_f);
+        // Find the last node
+        do { top--; } while ( p_binary_tree->checkpoint.pp_slots[top] == (void *) 0 );
+
+        // Store the node, and its parent
+        p_node   = p_binary_tree->checkpoint.pp_slots[top];
+        p_parent = binary_tree_checkpoint_parent(p_binary_tree, p_node);
+
+        // Move the node
+        p_binary_tree->checkpoint.pp_slots[top]  = (void *) 0;
+        p_binary_tree->checkpoint.pp_slots[slot] = p_node;
+        p_node->node_pointer                     = slot;
+
+        // Mark the changed records
+        binary_tree_checkpoint_mark(p_binary_tree, p_node);
+        binary_tree_checkpoint_mark(p_binary_tree, p_parent);
     }
 
-    // Allocate a binary tree
-    if ( binary_tree_construct(&p_binary_tree, pfn_is_equal, pfn_tree_key_accessor, node_size-sizeof(p_binary_tree->metadata)) == 0 ) goto failed_to_construct_binary_tree;
+    // Error check
+    if ( p_binary_tree->checkpoint.invalid ) goto failed_to_track_records;
+
+    // The records are dense
+    p_binary_tree->checkpoint.slot_quantity = node_quantity;
+    p_binary_tree->checkpoint.free_quantity = 0;
 
-    // Read the root node
-    if ( binary_tree_parse_node(p_f, p_binary_tree, &p_binary_tree->p_root, pfn_parse_node) == 0 ) goto failed_to_construct_binary_tree;
+    // Write the changed records in file order
+    qsort(p_binary_tree->checkpoint.p_dirty_slots, p_binary_tree->checkpoint.dirty_quantity, sizeof(unsigned long long), binary_tree_checkpoint_slot_compare);
+
+    // Allocate the record buffer. The extra byte absorbs the null terminator 
+    // that fmemopen writes after the last byte written to the stream
+    p_buffer = TREE_REALLOC(0, ( record_quantity * node_size ) + 1);
 
     // Error check
-    if ( p_binary_tree->metadata.node_quantity != node_quantity ) goto failed_to_parse_binary_tree; 
+    if ( p_buffer == (void *) 0 ) goto no_mem;
 
-    // Return a pointer to the caller
-    *pp_binary_tree = p_binary_tree;
+    // Open the record buffer as a stream, so the node serializer can write to it
+    p_buffer_file = fmemopen(p_buffer, ( record_quantity * node_size ) + 1, "w");
+
+    // Error check
+    if ( p_buffer_file == (void *) 0 ) goto failed_to_open_buffer;
+
+    // Write straight through to the record buffer
+    setvbuf(p_buffer_file, (void *) 0, _IONBF, 0);
+
+    // Stage each changed record, and write runs of adjacent records at once
+    for (size_t i = 0; i <= p_binary_tree->checkpoint.dirty_quantity; i++)
+    {
+
+        // Initialized data
+        bool   done = ( i == p_binary_tree->checkpoint.dirty_quantity );
+        size_t slot = ( done ) ? 0 : (size_t) p_binary_tree->checkpoint.p_dirty_slots[i];
+
+        // Clear the dirty bit
+        if ( done == false ) p_binary_tree->checkpoint.p_dirty_bits[slot / 8] &= (unsigned char) ~( 1 << ( slot % 8 ) );
+
+        // Skip records past the end of the file
+        if ( done == false && slot >= node_quantity ) continue;
+
+        // Write the staged run IF this record does not extend it
+        if ( records && ( done || slot != first + records || records == record_quantity ) )
+        {
+
+            // Set the pointer correctly
+            fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + ( first * node_size ) ), SEEK_SET);
+
+            // Write the records
+            if ( fwrite(p_buffer, node_size, records, p_file) != records ) goto failed_to_write_file;
+
+            // Reset the record quantity
+            records = 0;
+        }
+
+        // Done
+        if ( done ) break;
+
+        // Start a new run
+        if ( records == 0 ) first = slot;
+
+        // Stage the record
+        {
+
+            // Initialized data
+            binary_tree_node   *p_node        = p_binary_tree->checkpoint.pp_slots[slot];
+            size_t              offset        = records * node_size;
+            unsigned long long  left_pointer  = ( p_node->p_left  ) ? p_node->p_left->node_pointer  : eight_bytes_of_f,
+                                right_pointer = ( p_node->p_right ) ? p_node->p_right->node_pointer : eight_bytes_of_f;
+
+            // Clear the record, in case the node serializer writes a short record
+            memset(&p_buffer[offset], 0, node_size);
+
+            // Set the pointer correctly
+            fseek(p_buffer_file, (long) offset, SEEK_SET);
+
+            // Serialize the node
+            pfn_serialize_node(p_buffer_file, p_node);
+
+            // Set the pointer correctly
+            fseek(p_buffer_file, (long) ( offset + node_size - ( 2 * sizeof(unsigned long long) ) ), SEEK_SET);
+
+            // Write the left pointer to the record
+            fwrite(&left_pointer, sizeof(unsigned long long), 1, p_buffer_file);
+
+            // Write the right pointer to the record
+            fwrite(&right_pointer, sizeof(unsigned long long), 1, p_buffer_file);
+
+            // Increment the record quantity
+            records++;
+        }
+    }
+
+    // Every record is written
+    p_binary_tree->checkpoint.dirty_quantity = 0;
+
+    // Write the metadata
+    fseek(p_file, 0, SEEK_SET);
+    fwrite(&p_binary_tree->metadata.node_quantity, sizeof(unsigned long long), 1, p_file);
+    fwrite(&p_binary_tree->metadata.node_size, sizeof(unsigned long long), 1, p_file);
+
+    // Flush the file
+    if ( fflush(p_file) ) goto failed_to_write_file;
+
+    // Drop the records past the end of the tree
+    if ( ftruncate(fileno(p_file), (off_t) ( sizeof(p_binary_tree->metadata) + ( node_quantity * node_size ) )) ) goto failed_to_write_file;
+
+    // Clean up
+    fclose(p_buffer_file);
+    p_buffer = TREE_REALLOC(p_buffer, 0);
 
     // Success
     return 1;
@@ -1274,112 +7846,161 @@ int binary_tree_parse ( binary_tree **const pp_binary_tree, const char *p_file,
     // Error handling
     {
 
-        // Argument errors
-        {            
-            no_binary_tree:
+        // Tree errors
+        {
+            failed_to_track_records:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Lost track of changed records in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+        }
 
-            no_file:
+        // Standard library errors
+        {
+            no_mem:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
+                // Clean up
+                goto clean_up;
 
-            no_parser:
+            failed_to_open_buffer:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_parse_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"fmemopen\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-        }
+                // Clean up
+                goto clean_up;
 
-        // Tree errors
-        {
-            failed_to_construct_binary_tree:
+            failed_to_write_file:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Failed to write checkpoint file in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
+                // Clean up
+                goto clean_up;
+        }
+
+        clean_up:
+
+            // Release the buffer stream
+            if ( p_buffer_file ) fclose(p_buffer_file);
+
+            // Release the buffer
+            if ( p_buffer ) p_buffer = TREE_REALLOC(p_buffer, 0);
+
+            // Error
+            return 0;
+    }
+}
+
+int binary_tree_checkpoint_reserve ( binary_tree *p_binary_tree, size_t slot )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree is null.
+    //       Check your parameters before you call.
+
+    // Initialized data
+    size_t              capacity     = ( p_binary_tree->checkpoint.slot_capacity ) ? p_binary_tree->checkpoint.slot_capacity : 64;
+    binary_tree_node  **pp_slots     = (void *) 0;
+    unsigned char      *p_dirty_bits = (void *) 0;
+
+    // Fast exit
+    if ( slot < p_binary_tree->checkpoint.slot_capacity ) return 1;
+
+    // Double the capacity until the slot fits
+    while ( capacity <= slot ) capacity *= 2;
+
+    // Grow the slot table
+    pp_slots = TREE_REALLOC(p_binary_tree->checkpoint.pp_slots, capacity * sizeof(binary_tree_node *));
+
+    // Error check
+    if ( pp_slots == (void *) 0 ) goto no_mem;
+
+    // Clear the new slots
+    memset(&pp_slots[p_binary_tree->checkpoint.slot_capacity], 0, ( capacity - p_binary_tree->checkpoint.slot_capacity ) * sizeof(binary_tree_node *));
+
+    // Store the slot table
+    p_binary_tree->checkpoint.pp_slots = pp_slots;
+
+    // Grow the dirty bits
+    p_dirty_bits = TREE_REALLOC(p_binary_tree->checkpoint.p_dirty_bits, capacity / 8);
+
+    // Error check
+    if ( p_dirty_bits == (void *) 0 ) goto no_mem;
+
+    // Clear the new dirty bits
+    memset(&p_dirty_bits[p_binary_tree->checkpoint.slot_capacity / 8], 0, ( capacity - p_binary_tree->checkpoint.slot_capacity ) / 8);
+
+    // Update the checkpoint state
+    p_binary_tree->checkpoint.p_dirty_bits  = p_dirty_bits;
+    p_binary_tree->checkpoint.slot_capacity = capacity;
+
+    // Success
+    return 1;
 
-            failed_to_parse_binary_tree:
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to parse binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Rewrite the whole file at the next checkpoint
+                p_binary_tree->checkpoint.invalid = true;
+
                 // Error
                 return 0;
         }
     }
 }
 
-int binary_tree_parse_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tree_node **pp_binary_tree_node, fn_binary_tree_parse *pfn_binary_tree_parse )
+int binary_tree_checkpoint_mark ( binary_tree *p_binary_tree, const binary_tree_node *const p_binary_tree_node )
 {
 
-    // Argument check
-    if ( p_file                == (void *) 0 ) goto no_file;
-    if ( p_binary_tree         == (void *) 0 ) goto no_binary_tree;
-    if ( pp_binary_tree_node   == (void *) 0 ) goto no_binary_tree_node;
-    if ( pfn_binary_tree_parse == (void *) 0 ) goto no_binary_tree_parser; 
+    // NOTE: This function has undefined behavior if p_binary_tree is null.
+    //       Check your parameters before you call.
 
     // Initialized data
-    binary_tree_node *p_binary_tree_node = TREE_REALLOC(0, sizeof(binary_tree_node));
-    unsigned long long left_pointer, right_pointer;
-    
-    memset(p_binary_tree_node, 0, sizeof(binary_tree_node));
-
-    p_binary_tree_node->node_pointer = ( ftell(p_file) ) / (p_binary_tree->metadata.node_size);
-
-    // Set the pointer correctly
-    fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + (p_binary_tree_node->node_pointer * ( p_binary_tree->metadata.node_size ))), SEEK_SET);
-
-    // User provided parsing function
-    pfn_binary_tree_parse(p_file, p_binary_tree_node);
-    
-    // Store the left pointer
-    fread(&left_pointer, 8, 1, p_file);
-    // printf("[%04d] -> left : < %llu, %lld >\n", p_binary_tree_node->node_pointer, ftell(p_file), left_pointer);
-
-    // Store the right pointer
-    fread(&right_pointer, 8, 1, p_file);
-    // printf("       -> right: < %llu, %lld >\n", ftell(p_file), right_pointer);
-    
-    // State check
-    if ( left_pointer == eight_bytes_of_f ) goto parse_right;
+    size_t slot = 0;
 
-    // Set the pointer correctly
-    fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + (left_pointer * ( p_binary_tree->metadata.node_size ))), SEEK_SET);
+    // Fast exit. Records are not tracked
+    if ( p_binary_tree->checkpoint.p_path == (void *) 0 || p_binary_tree->checkpoint.invalid || p_binary_tree_node == (void *) 0 ) return 1;
 
-    // Parse the left node
-    if ( binary_tree_parse_node(p_file, p_binary_tree, &p_binary_tree_node->p_left, pfn_binary_tree_parse) == 0 ) goto failed_to_parse_node;
+    // Store the slot
+    slot = (size_t) p_binary_tree_node->node_pointer;
 
-    parse_right:
+    // Grow the dirty bits
+    if ( binary_tree_checkpoint_reserve(p_binary_tree, slot) == 0 ) return 0;
 
-    // State check
-    if ( right_pointer == eight_bytes_of_f ) goto done;
+    // Fast exit. Already marked
+    if ( p_binary_tree->checkpoint.p_dirty_bits[slot / 8] & ( 1 << ( slot % 8 ) ) ) return 1;
 
-    // Set the pointer correctly
-    fseek(p_file, (long) ( sizeof(p_binary_tree->metadata) + (right_pointer * ( p_binary_tree->metadata.node_size))), SEEK_SET);
+    // Grow the dirty list
+    if ( p_binary_tree->checkpoint.dirty_quantity == p_binary_tree->checkpoint.dirty_capacity )
+    {
 
-    // Parse the right node
-    if ( binary_tree_parse_node(p_file, p_binary_tree, &p_binary_tree_node->p_right, pfn_binary_tree_parse) == 0 ) goto failed_to_parse_node;
+        // Initialized data
+        size_t              capacity      = ( p_binary_tree->checkpoint.dirty_capacity ) ? p_binary_tree->checkpoint.dirty_capacity * 2 : 64;
+        unsigned long long *p_dirty_slots = TREE_REALLOC(p_binary_tree->checkpoint.p_dirty_slots, capacity * sizeof(unsigned long long));
 
-    done:
+        // Error check
+        if ( p_dirty_slots == (void *) 0 ) goto no_mem;
 
-    // Return a pointer to the caller
-    *pp_binary_tree_node = p_binary_tree_node;
+        // Update the dirty list
+        p_binary_tree->checkpoint.p_dirty_slots  = p_dirty_slots;
+        p_binary_tree->checkpoint.dirty_capacity = capacity;
+    }
 
-    // Increment the node quantity
-    p_binary_tree->metadata.node_quantity++;
+    // Mark the record
+    p_binary_tree->checkpoint.p_dirty_bits[slot / 8] |= (unsigned char) ( 1 << ( slot % 8 ) );
+    p_binary_tree->checkpoint.p_dirty_slots[p_binary_tree->checkpoint.dirty_quantity++] = slot;
 
     // Success
     return 1;
@@ -1387,165 +8008,199 @@ int binary_tree_parse_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tr
     // Error handling
     {
 
-        // Argument errors
+        // Standard library errors
         {
-            no_file:
+            no_mem:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-            
-            no_binary_tree:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                // Rewrite the whole file at the next checkpoint
+                p_binary_tree->checkpoint.invalid = true;
 
                 // Error
                 return 0;
+        }
+    }
+}
 
-            no_binary_tree_node:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+int binary_tree_checkpoint_mark_subtree ( binary_tree *p_binary_tree, const binary_tree_node *const p_binary_tree_node )
+{
 
-                // Error
-                return 0;
-            
-            no_binary_tree_parser:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_binary_tree_parse\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+    // NOTE: This function has undefined behavior if p_binary_tree is null.
+    //       Check your parameters before you call.
 
-                // Error
-                return 0;
-        }
+    // Fast exit. Records are not tracked
+    if ( p_binary_tree->checkpoint.p_path == (void *) 0 || p_binary_tree->checkpoint.invalid || p_binary_tree_node == (void *) 0 ) return 1;
 
-        // Tree errors
-        {
-            failed_to_parse_node:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to parse node in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+    // Mark the node
+    if ( binary_tree_checkpoint_mark(p_binary_tree, p_binary_tree_node) == 0 ) return 0;
 
-                // Error
-                return 0;
-        }
+    // Mark the subtrees
+    return binary_tree_checkpoint_mark_subtree(p_binary_tree, p_binary_tree_node->p_left) &&
+           binary_tree_checkpoint_mark_subtree(p_binary_tree, p_binary_tree_node->p_right);
+}
+
+int binary_tree_checkpoint_slot_acquire ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       p_binary_tree_node is null. Check your parameters before you call.
+
+    // Fast exit. Records are not tracked, so any unique record will do
+    if ( p_binary_tree->checkpoint.invalid )
+    {
+
+        // Take a record at the end of the file
+        p_binary_tree_node->node_pointer = p_binary_tree->checkpoint.slot_quantity++;
+
+        // Success
+        return 1;
     }
+
+    // Reuse a free record, or take a record at the end of the file
+    p_binary_tree_node->node_pointer = ( p_binary_tree->checkpoint.free_quantity ) ? p_binary_tree->checkpoint.p_free_slots[--p_binary_tree->checkpoint.free_quantity]
+                                                                                    : p_binary_tree->checkpoint.slot_quantity++;
+
+    // Grow the slot table
+    if ( binary_tree_checkpoint_reserve(p_binary_tree, (size_t) p_binary_tree_node->node_pointer) == 0 ) return 0;
+
+    // Store the node
+    p_binary_tree->checkpoint.pp_slots[p_binary_tree_node->node_pointer] = p_binary_tree_node;
+
+    // Success
+    return 1;
 }
 
-int binary_tree_serialize_node ( FILE *p_file, binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node, fn_binary_tree_serialize *pfn_binary_tree_serialize )
+int binary_tree_checkpoint_slot_release ( binary_tree *p_binary_tree, const binary_tree_node *const p_binary_tree_node )
 {
 
-    // Argument check
-    if ( p_file                    == (void *) 0 ) goto no_file;
-    if ( p_binary_tree             == (void *) 0 ) goto no_binary_tree;
-    if ( p_binary_tree_node        == (void *) 0 ) goto no_binary_tree_node;
-    if ( pfn_binary_tree_serialize == (void *) 0 ) goto no_binary_tree_serializer; 
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       p_binary_tree_node is null. Check your parameters before you call.
 
-    // Initialized data
-    long offset = (long) ( sizeof(p_binary_tree->metadata) + (p_binary_tree_node->node_pointer * p_binary_tree->metadata.node_size) );
+    // Fast exit. Records are not tracked
+    if ( p_binary_tree->checkpoint.invalid ) return 1;
 
-    // Set the pointer correctly
-    fseek(p_file, offset, SEEK_SET);
+    // Grow the free list
+    if ( p_binary_tree->checkpoint.free_quantity == p_binary_tree->checkpoint.free_capacity )
+    {
 
-    // Serialize the node
-    pfn_binary_tree_serialize(p_file, p_binary_tree_node);
-    
-    // Write the left pointer to the output
-    fwrite((p_binary_tree_node->p_left) ? &p_binary_tree_node->p_left->node_pointer : &eight_bytes_of_f, sizeof(void *), 1, p_file);
+        // Initialized data
+        size_t              capacity     = ( p_binary_tree->checkpoint.free_capacity ) ? p_binary_tree->checkpoint.free_capacity * 2 : 64;
+        unsigned long long *p_free_slots = TREE_REALLOC(p_binary_tree->checkpoint.p_free_slots, capacity * sizeof(unsigned long long));
 
-    // Write the right pointer to the output
-    fwrite((p_binary_tree_node->p_right) ? &p_binary_tree_node->p_right->node_pointer : &eight_bytes_of_f, sizeof(void *), 1, p_file);
+        // Error check
+        if ( p_free_slots == (void *) 0 ) goto no_mem;
 
-    // Write the left node to the output
-    if ( p_binary_tree_node->p_left ) binary_tree_serialize_node(p_file, p_binary_tree, p_binary_tree_node->p_left, pfn_binary_tree_serialize);
+        // Update the free list
+        p_binary_tree->checkpoint.p_free_slots  = p_free_slots;
+        p_binary_tree->checkpoint.free_capacity = capacity;
+    }
 
-    // Write the right node to the output
-    if ( p_binary_tree_node->p_right ) binary_tree_serialize_node(p_file, p_binary_tree, p_binary_tree_node->p_right, pfn_binary_tree_serialize);
+    // Free the record
+    p_binary_tree->checkpoint.pp_slots[p_binary_tree_node->node_pointer]                    = (void *) 0;
+    p_binary_tree->checkpoint.p_free_slots[p_binary_tree->checkpoint.free_quantity++] = p_binary_tree_node->node_pointer;
 
     // Success
     return 1;
-    
+
     // Error handling
     {
 
-        // Argument errors
+        // Standard library errors
         {
-            no_file:
+            no_mem:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-            
-            no_binary_tree:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                // Rewrite the whole file at the next checkpoint
+                p_binary_tree->checkpoint.invalid = true;
 
                 // Error
                 return 0;
+        }
+    }
+}
 
-            no_binary_tree_node:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+binary_tree_node *binary_tree_checkpoint_parent ( const binary_tree *const p_binary_tree, const binary_tree_node *const p_binary_tree_node )
+{
 
-                // Error
-                return 0;
-            
-            no_binary_tree_serializer:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_binary_tree_serialize\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+    // NOTE: This function has undefined behavior if p_binary_tree, or 
+    //       p_binary_tree_node is null, or if the node is not in the binary
+    //       tree. Check your parameters before you call.
 
-                // Error
-                return 0;
-        }
+    // Initialized data
+    const void       *p_key    = p_binary_tree->functions.pfn_key_accessor(p_binary_tree_node->p_value);
+    binary_tree_node *p_node   = p_binary_tree->p_root,
+                     *p_parent = (void *) 0;
+
+    // Walk down to the node
+    while ( p_node != p_binary_tree_node )
+    {
+
+        // Store the parent
+        p_parent = p_node;
+
+        // Left or right
+        p_node = ( p_binary_tree->functions.pfn_is_equal(p_binary_tree->functions.pfn_key_accessor(p_node->p_value), p_key) < 0 ) ? p_node->p_left : p_node->p_right;
     }
+
+    // Done
+    return p_parent;
 }
 
-int binary_tree_serialize ( binary_tree *const p_binary_tree, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node )
+int binary_tree_checkpoint_slot_compare ( const void *p_a, const void *p_b )
 {
 
-    // Argument check
-    if ( p_binary_tree      == (void *) 0 ) goto no_binary_tree;
-    if ( p_path             == (void *) 0 ) goto no_file;
-    if ( pfn_serialize_node == (void *) 0 ) goto no_serializer;
+    // Initialized data
+    unsigned long long a = *(const unsigned long long *) p_a,
+                       b = *(const unsigned long long *) p_b;
 
-    // Lock
-    mutex_lock(&p_binary_tree->_lock);
+    // Compare
+    return ( a > b ) - ( a < b );
+}
 
-    // Open the file
-    p_binary_tree->p_random_access = fopen(p_path, "wb+");
+int binary_tree_node_writable ( binary_tree *p_binary_tree, binary_tree_node **const pp_binary_tree_node )
+{
 
-    // Error check
-    if ( p_binary_tree->p_random_access == NULL ) goto failed_to_open_file;
+    // NOTE: This function has undefined behavior if p_binary_tree, or
+    //       pp_binary_tree_node is null. Check your parameters before you call.
 
-    // Write the metadata
-    {
+    // Initialized data
+    binary_tree_node *p_binary_tree_node = *pp_binary_tree_node,
+                     *p_copy             = (void *) 0;
 
-        // Set the cursor to the start of the file
-        fseek(p_binary_tree->p_random_access, 0, SEEK_SET);
+    // Fast exit. No snapshot shares the node
+    if ( !BINARY_TREE_NODE_SHARED(p_binary_tree, p_binary_tree_node) ) return 1;
 
-        // Write the quantity of nodes
-        fwrite(&p_binary_tree->metadata.node_quantity, sizeof(unsigned long long), 1, p_binary_tree->p_random_access);
+    // Allocate a copy
+    if ( binary_tree_node_create(p_binary_tree, &p_copy) == 0 ) goto failed_to_allocate_node;
 
-        // Write the size of a node
-        fwrite(&p_binary_tree->metadata.node_size, sizeof(unsigned long long), 1, p_binary_tree->p_random_access);
-    }
+    // Copy the node. The copy keeps its own generation
+    p_copy->p_value = p_binary_tree_node->p_value;
+    p_copy->p_left  = p_binary_tree_node->p_left;
+    p_copy->p_right = p_binary_tree_node->p_right;
 
-    // Write the root node
-    if ( binary_tree_serialize_node(p_binary_tree->p_random_access, p_binary_tree, p_binary_tree->p_root, pfn_serialize_node) == 0 ) goto failed_to_serialize_node;
+    // Copy the subtree size
+    BINARY_TREE_NODE_SIZE_SET(p_copy, BINARY_TREE_NODE_SIZE(p_binary_tree_node));
 
-    // Flush the file
-    fflush(p_binary_tree->p_random_access);
+    // The copy takes over the node's record in the checkpoint file
+    if ( p_binary_tree->checkpoint.p_path )
+    {
 
-    // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+        // Take over the record
+        p_copy->node_pointer = p_binary_tree_node->node_pointer;
+
+        // Update the slot table
+        if ( p_binary_tree->checkpoint.invalid == false ) p_binary_tree->checkpoint.pp_slots[p_copy->node_pointer] = p_copy;
+    }
+
+    // Hold the original for the snapshots
+    if ( binary_tree_node_retire(p_binary_tree, p_binary_tree_node) == 0 ) goto failed_to_retire_node;
+
+    // Point the link at the copy
+    *pp_binary_tree_node = p_copy;
 
     // Success
     return 1;
@@ -1553,49 +8208,67 @@ int binary_tree_serialize ( binary_tree *const p_binary_tree, const char *p_path
     // Error handling
     {
 
-        // Argument errors
+        // Tree errors
         {
-            no_binary_tree:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-            
-            no_file:
+            failed_to_allocate_node:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Failed to allocate binary tree node in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
-            no_serializer:
+            failed_to_retire_node:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pfn_serialize_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Failed to retire binary tree node in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error
-                return 0;
-        }
-    
-        // tree errors
-        {
-            failed_to_serialize_node:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to serialize node in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                // Return the copy to the free list
+                p_copy->p_left                       = p_binary_tree->allocator.p_free_list;
+                p_binary_tree->allocator.p_free_list = p_copy;
 
                 // Error
                 return 0;
         }
+    }
+}
+
+int binary_tree_node_retire ( binary_tree *p_binary_tree, binary_tree_node *p_binary_tree_node )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_tree, or
+    //       p_binary_tree_node is null. Check your parameters before you call.
+
+    // Grow the retired list
+    if ( p_binary_tree->snapshots.retired_quantity == p_binary_tree->snapshots.retired_capacity )
+    {
+
+        // Initialized data
+        size_t             capacity    = ( p_binary_tree->snapshots.retired_capacity ) ? p_binary_tree->snapshots.retired_capacity * 2 : 64;
+        binary_tree_node **pp_retired  = TREE_REALLOC(p_binary_tree->snapshots.pp_retired, capacity * sizeof(binary_tree_node *));
+
+        // Error check
+        if ( pp_retired == (void *) 0 ) goto no_mem;
+
+        // Update the retired list
+        p_binary_tree->snapshots.pp_retired       = pp_retired;
+        p_binary_tree->snapshots.retired_capacity = capacity;
+    }
+
+    // Retire the node
+    p_binary_tree->snapshots.pp_retired[p_binary_tree->snapshots.retired_quantity++] = p_binary_tree_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
 
-        // Standard library errrors
+        // Standard library errors
         {
-            failed_to_open_file:
+            no_mem:
                 #ifndef NDEBUG
-                    printf("[Standard Library] Failed to open file\n");
+                    printf("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -1604,10 +8277,11 @@ int binary_tree_serialize ( binary_tree *const p_binary_tree, const char *p_path
     }
 }
 
-int binary_tree_node_destroy ( binary_tree_node **const pp_binary_tree_node )
+int binary_tree_node_destroy ( binary_tree *p_binary_tree, binary_tree_node **const pp_binary_tree_node )
 {
 
     // Argument check
+    if ( p_binary_tree       == (void *) 0 ) goto no_binary_tree;
     if ( pp_binary_tree_node == (void *) 0 ) goto no_binary_tree_node;
 
     // Initialized data
@@ -1616,14 +8290,24 @@ int binary_tree_node_destroy ( binary_tree_node **const pp_binary_tree_node )
     // Fast exit
     if ( p_binary_tree_node == (void *) 0 ) return 1;
 
-    // Recursively free the left node
-    if ( binary_tree_node_destroy(&p_binary_tree_node->p_left) == 0 ) goto failed_to_free;
+    // Decrement the node quantity
+    p_binary_tree->metadata.node_quantity--;
 
-    // Recursively free the right node
-    if ( binary_tree_node_destroy(&p_binary_tree_node->p_right) == 0 ) goto failed_to_free;
+    // No more pointer for caller
+    *pp_binary_tree_node = (void *) 0;
 
-    // Free the node
-    p_binary_tree_node = TREE_REALLOC(p_binary_tree_node, 0);
+    // Free the node's record in the checkpoint file
+    if ( p_binary_tree->checkpoint.p_path ) binary_tree_checkpoint_slot_release(p_binary_tree, p_binary_tree_node);
+
+    // Hold the node IF a snapshot shares it
+    if ( BINARY_TREE_NODE_SHARED(p_binary_tree, p_binary_tree_node) )
+        return binary_tree_node_retire(p_binary_tree, p_binary_tree_node);
+
+    // Push the node onto the free list
+    p_binary_tree_node->p_left           = p_binary_tree->allocator.p_free_list;
+    p_binary_tree_node->p_right          = (void *) 0;
+    p_binary_tree_node->p_value          = (void *) 0;
+    p_binary_tree->allocator.p_free_list = p_binary_tree_node;
 
     // Success
     return 1;
@@ -1633,24 +8317,21 @@ int binary_tree_node_destroy ( binary_tree_node **const pp_binary_tree_node )
 
         // Argument errors
         {
-            no_binary_tree_node:
+            no_binary_tree:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"p_binary_tree\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-        }
 
-        // Tree errors
-        {
-            failed_to_free:
+            no_binary_tree_node:
                 #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to free binary tree in call to function \"%s\"\n", __FUNCTION__);
+                    printf("[tree] [binary] Null pointer provided for parameter \"pp_binary_tree_node\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
-                return 0; 
+                return 0;
         }
     }
 }
@@ -1668,22 +8349,47 @@ int binary_tree_destroy ( binary_tree **const pp_binary_tree )
     if ( p_binary_tree == (void *) 0 ) return 1;
 
     // Lock
-    mutex_lock(&p_binary_tree->_lock);
+    binary_tree_write_lock(p_binary_tree);
 
     // No more pointer for caller
     *pp_binary_tree = (void *) 0;
 
     // Unlock
-    mutex_unlock(&p_binary_tree->_lock);
+    binary_tree_unlock(p_binary_tree);
+
+    // Discard the frozen snapshot
+    binary_tree_thaw(p_binary_tree);
+
+    // Release every slab of nodes. Slabs shared with other binary trees by 
+    // binary_tree_split_at are freed by the last binary tree to let go of them
+    binary_tree_slab_release(p_binary_tree->allocator.p_slabs);
 
-    // Recursively free nodes
-    if ( binary_tree_node_destroy(&p_binary_tree->p_root) == 0 ) goto failed_to_free_nodes;
+    // Release the retired list. The retired nodes are in the slabs
+    if ( p_binary_tree->snapshots.pp_retired ) p_binary_tree->snapshots.pp_retired = TREE_REALLOC(p_binary_tree->snapshots.pp_retired, 0);
+
+    // Release the scapegoat state
+    if ( p_binary_tree->scapegoat.pp_path   ) p_binary_tree->scapegoat.pp_path   = TREE_REALLOC(p_binary_tree->scapegoat.pp_path, 0);
+    if ( p_binary_tree->scapegoat.pp_values ) p_binary_tree->scapegoat.pp_values = TREE_REALLOC(p_binary_tree->scapegoat.pp_values, 0);
+
+    // Release the checkpoint state
+    if ( p_binary_tree->checkpoint.p_path        ) p_binary_tree->checkpoint.p_path        = TREE_REALLOC(p_binary_tree->checkpoint.p_path, 0);
+    if ( p_binary_tree->checkpoint.pp_slots      ) p_binary_tree->checkpoint.pp_slots      = TREE_REALLOC(p_binary_tree->checkpoint.pp_slots, 0);
+    if ( p_binary_tree->checkpoint.p_free_slots  ) p_binary_tree->checkpoint.p_free_slots  = TREE_REALLOC(p_binary_tree->checkpoint.p_free_slots, 0);
+    if ( p_binary_tree->checkpoint.p_dirty_slots ) p_binary_tree->checkpoint.p_dirty_slots = TREE_REALLOC(p_binary_tree->checkpoint.p_dirty_slots, 0);
+    if ( p_binary_tree->checkpoint.p_dirty_bits  ) p_binary_tree->checkpoint.p_dirty_bits  = TREE_REALLOC(p_binary_tree->checkpoint.p_dirty_bits, 0);
 
     // Close the file
     if ( p_binary_tree->p_random_access ) fclose(p_binary_tree->p_random_access);
 
+    // Unmap the file
+    if ( p_binary_tree->mapped.p_base ) munmap((void *) p_binary_tree->mapped.p_base, p_binary_tree->mapped.size);
+
+    // Release the record cache
+    if ( p_binary_tree->lazy.p_cache ) binary_tree_lazy_cache_destroy(p_binary_tree->lazy.p_cache);
+
     // Destroy the lock
-    mutex_destroy(&p_binary_tree->_lock);
+    if ( p_binary_tree->flags & BINARY_TREE_FLAG_READER_WRITER ) pthread_rwlock_destroy(&p_binary_tree->_rwlock);
+    else mutex_destroy(&p_binary_tree->_lock);
 
     // Release the tree
     p_binary_tree = TREE_REALLOC(p_binary_tree, 0);
@@ -1704,16 +8410,5 @@ int binary_tree_destroy ( binary_tree **const pp_binary_tree )
                 // Error
                 return 0;
         }
-
-        // Tree error
-        {
-            failed_to_free_nodes:
-                #ifndef NDEBUG
-                    printf("[tree] [binary] Failed to free binary tree nodes in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-        }
     }
 }
@@ -0,0 +1,1079 @@
+/** !
+ * Implementation of compact binary search tree
+ *
+ * @file binary_compact.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header file
+#include <tree/binary_compact.h>
+
+// Static data
+static const unsigned long long binary_compact_tree_null_pointer = 0xffffffffffffffff;
+
+// Forward declarations
+/** !
+ * Grow the pool of a compact binary tree to hold at least a quantity of nodes
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param node_quantity         the quantity of nodes
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_reserve ( binary_compact_tree *const p_binary_compact_tree, size_t node_quantity );
+
+/** !
+ * Find the link that refers to a node, by searching for the node's key
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param index                 the index of the node
+ *
+ * @return pointer to the root, or to the child index of the node's parent
+ */
+uint32_t *binary_compact_tree_link ( binary_compact_tree *const p_binary_compact_tree, uint32_t index );
+
+/** !
+ * Traverse a compact binary tree using the pre order technique
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param index                 the index of the node
+ * @param pfn_traverse          called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_traverse_preorder_node ( const binary_compact_tree *const p_binary_compact_tree, uint32_t index, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a compact binary tree using the in order technique
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param index                 the index of the node
+ * @param pfn_traverse          called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_traverse_inorder_node ( const binary_compact_tree *const p_binary_compact_tree, uint32_t index, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a compact binary tree using the post order technique
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param index                 the index of the node
+ * @param pfn_traverse          called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_traverse_postorder_node ( const binary_compact_tree *const p_binary_compact_tree, uint32_t index, fn_binary_tree_traverse *pfn_traverse );
+
+// Function definitions
+int binary_compact_tree_construct ( binary_compact_tree **const pp_binary_compact_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size )
+{
+
+    // Argument check
+    if ( pp_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+
+    // Initialized data
+    binary_compact_tree *p_binary_compact_tree = TREE_REALLOC(0, sizeof(binary_compact_tree));
+
+    // Error check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_mem;
+
+    // Populate the compact binary tree structure
+    *p_binary_compact_tree = (binary_compact_tree)
+    {
+        .p_nodes       = (void *) 0,
+        .root          = BINARY_COMPACT_TREE_NONE,
+        .node_capacity = 0,
+        .functions     =
+        {
+            .pfn_is_equal     = (pfn_is_equal)     ? pfn_is_equal     : tree_compare_function,
+            .pfn_key_accessor = (pfn_key_accessor) ? pfn_key_accessor : tree_key_is_value
+        },
+        .metadata      =
+        {
+            .node_quantity = 0,
+            .node_size     = node_size + ( 2 * sizeof(unsigned long long) )
+        }
+    };
+
+    // Construct a lock
+    mutex_create(&p_binary_compact_tree->_lock);
+
+    // Return a pointer to the caller
+    *pp_binary_compact_tree = p_binary_compact_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pp_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_reserve ( binary_compact_tree *const p_binary_compact_tree, size_t node_quantity )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_compact_tree is
+    //       null. Check your parameters before you call.
+
+    // Initialized data
+    size_t                    capacity = ( p_binary_compact_tree->node_capacity ) ? p_binary_compact_tree->node_capacity : 64;
+    binary_compact_tree_node *p_nodes  = (void *) 0;
+
+    // Fast exit
+    if ( node_quantity <= p_binary_compact_tree->node_capacity ) return 1;
+
+    // Error check. The last index marks a missing child
+    if ( node_quantity > BINARY_COMPACT_TREE_NONE ) goto too_many_nodes;
+
+    // Double the capacity until the nodes fit
+    while ( capacity < node_quantity ) capacity *= 2;
+
+    // Clamp the capacity to the range of an index
+    if ( capacity > BINARY_COMPACT_TREE_NONE ) capacity = BINARY_COMPACT_TREE_NONE;
+
+    // Grow the pool
+    p_nodes = TREE_REALLOC(p_binary_compact_tree->p_nodes, capacity * sizeof(binary_compact_tree_node));
+
+    // Error check
+    if ( p_nodes == (void *) 0 ) goto no_mem;
+
+    // Update the pool
+    p_binary_compact_tree->p_nodes       = p_nodes;
+    p_binary_compact_tree->node_capacity = capacity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            too_many_nodes:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Compact binary tree can not hold %zu nodes in call to function \"%s\"\n", node_quantity, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_search ( binary_compact_tree *const p_binary_compact_tree, const void *const p_key, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+
+    // Initialized data
+    uint32_t index = BINARY_COMPACT_TREE_NONE;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Walk down from the root
+    for (index = p_binary_compact_tree->root; index != BINARY_COMPACT_TREE_NONE; )
+    {
+
+        // Initialized data
+        const binary_compact_tree_node *p_node            = &p_binary_compact_tree->p_nodes[index];
+        int                             comparator_return = p_binary_compact_tree->functions.pfn_is_equal
+        (
+            p_binary_compact_tree->functions.pfn_key_accessor(p_node->p_value),
+            p_key
+        );
+
+        // Found it
+        if ( comparator_return == 0 ) break;
+
+        // Left or right
+        index = ( comparator_return < 0 ) ? p_node->left : p_node->right;
+    }
+
+    // Return the value to the caller
+    if ( index != BINARY_COMPACT_TREE_NONE && pp_value ) *pp_value = p_binary_compact_tree->p_nodes[index].p_value;
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Done
+    return index != BINARY_COMPACT_TREE_NONE;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_insert ( binary_compact_tree *const p_binary_compact_tree, const void *const p_value )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+
+    // Initialized data
+    uint32_t   *p_link = (void *) 0,
+                index  = 0;
+    const void *p_key  = (void *) 0;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Grow the pool first, since growing it moves the links
+    if ( binary_compact_tree_reserve(p_binary_compact_tree, (size_t) p_binary_compact_tree->metadata.node_quantity + 1) == 0 ) goto failed_to_grow_pool;
+
+    // Store the key
+    p_key = p_binary_compact_tree->functions.pfn_key_accessor(p_value);
+
+    // Walk down from the root to an empty link
+    for (p_link = &p_binary_compact_tree->root; *p_link != BINARY_COMPACT_TREE_NONE; )
+    {
+
+        // Initialized data
+        binary_compact_tree_node *p_node            = &p_binary_compact_tree->p_nodes[*p_link];
+        int                       comparator_return = p_binary_compact_tree->functions.pfn_is_equal
+        (
+            p_binary_compact_tree->functions.pfn_key_accessor(p_node->p_value),
+            p_key
+        );
+
+        // Error check
+        if ( comparator_return == 0 ) goto duplicate_key;
+
+        // Left or right
+        p_link = ( comparator_return < 0 ) ? &p_node->left : &p_node->right;
+    }
+
+    // The new node goes at the end of the pool
+    index = (uint32_t) p_binary_compact_tree->metadata.node_quantity++;
+
+    // Populate the node
+    p_binary_compact_tree->p_nodes[index] = (binary_compact_tree_node)
+    {
+        .p_value = (void *) p_value,
+        .left    = BINARY_COMPACT_TREE_NONE,
+        .right   = BINARY_COMPACT_TREE_NONE
+    };
+
+    // Link the node
+    *p_link = index;
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_grow_pool:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Failed to grow node pool in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                mutex_unlock(&p_binary_compact_tree->_lock);
+
+                // Error
+                return 0;
+
+            duplicate_key:
+
+                // Unlock
+                mutex_unlock(&p_binary_compact_tree->_lock);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_remove ( binary_compact_tree *const p_binary_compact_tree, const void *const p_key, const void **const pp_value )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+
+    // Initialized data
+    binary_compact_tree_node *p_nodes = p_binary_compact_tree->p_nodes;
+    uint32_t                 *p_link  = (void *) 0,
+                              index   = 0,
+                              hole    = 0,
+                              last    = 0;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Walk down from the root to the key
+    for (p_link = &p_binary_compact_tree->root; *p_link != BINARY_COMPACT_TREE_NONE; )
+    {
+
+        // Initialized data
+        binary_compact_tree_node *p_node            = &p_nodes[*p_link];
+        int                       comparator_return = p_binary_compact_tree->functions.pfn_is_equal
+        (
+            p_binary_compact_tree->functions.pfn_key_accessor(p_node->p_value),
+            p_key
+        );
+
+        // Found it
+        if ( comparator_return == 0 ) break;
+
+        // Left or right
+        p_link = ( comparator_return < 0 ) ? &p_node->left : &p_node->right;
+    }
+
+    // Error check
+    if ( *p_link == BINARY_COMPACT_TREE_NONE ) goto no_key;
+
+    // Store the node
+    index = *p_link;
+
+    // Return the value to the caller
+    if ( pp_value ) *pp_value = p_nodes[index].p_value;
+
+    // The node has two children. Move the successor's value into the node, and
+    // unlink the successor instead
+    if ( p_nodes[index].left != BINARY_COMPACT_TREE_NONE && p_nodes[index].right != BINARY_COMPACT_TREE_NONE )
+    {
+
+        // Initialized data
+        uint32_t *p_successor_link = &p_nodes[index].right;
+
+        // Find the successor
+        while ( p_nodes[*p_successor_link].left != BINARY_COMPACT_TREE_NONE ) p_successor_link = &p_nodes[*p_successor_link].left;
+
+        // Store the successor
+        hole = *p_successor_link;
+
+        // Move the successor's value
+        p_nodes[index].p_value = p_nodes[hole].p_value;
+
+        // Unlink the successor
+        *p_successor_link = p_nodes[hole].right;
+    }
+
+    // The node has one child, or none. Replace the node with its child
+    else
+    {
+
+        // Store the node
+        hole = index;
+
+        // Unlink the node
+        *p_link = ( p_nodes[index].left != BINARY_COMPACT_TREE_NONE ) ? p_nodes[index].left : p_nodes[index].right;
+    }
+
+    // The root was unlinked. Move the new root into the first slot
+    if ( hole == 0 && p_binary_compact_tree->root != BINARY_COMPACT_TREE_NONE )
+    {
+
+        // Move the root
+        hole                        = p_binary_compact_tree->root;
+        p_nodes[0]                  = p_nodes[hole];
+        p_binary_compact_tree->root = 0;
+    }
+
+    // Store the last node
+    last = (uint32_t) ( p_binary_compact_tree->metadata.node_quantity - 1 );
+
+    // Move the last node into the hole, so the pool stays dense
+    if ( hole != last )
+    {
+
+        // Point the last node's parent at the hole
+        *binary_compact_tree_link(p_binary_compact_tree, last) = hole;
+
+        // Move the node
+        p_nodes[hole] = p_nodes[last];
+    }
+
+    // Decrement the node quantity
+    p_binary_compact_tree->metadata.node_quantity--;
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            no_key:
+
+                // Unlock
+                mutex_unlock(&p_binary_compact_tree->_lock);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+uint32_t *binary_compact_tree_link ( binary_compact_tree *const p_binary_compact_tree, uint32_t index )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_compact_tree is
+    //       null, or if the node is not in the compact binary tree. Check your
+    //       parameters before you call.
+
+    // Initialized data
+    binary_compact_tree_node *p_nodes = p_binary_compact_tree->p_nodes;
+    const void               *p_key   = p_binary_compact_tree->functions.pfn_key_accessor(p_nodes[index].p_value);
+    uint32_t                 *p_link  = &p_binary_compact_tree->root;
+
+    // Walk down to the node
+    while ( *p_link != index )
+    {
+
+        // Initialized data
+        binary_compact_tree_node *p_node = &p_nodes[*p_link];
+
+        // Left or right
+        p_link = ( p_binary_compact_tree->functions.pfn_is_equal(p_binary_compact_tree->functions.pfn_key_accessor(p_node->p_value), p_key) < 0 ) ? &p_node->left : &p_node->right;
+    }
+
+    // Done
+    return p_link;
+}
+
+int binary_compact_tree_traverse_preorder_node ( const binary_compact_tree *const p_binary_compact_tree, uint32_t index, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Base case
+    if ( index == BINARY_COMPACT_TREE_NONE ) return 1;
+
+    // Call the traverse function
+    pfn_traverse(p_binary_compact_tree->p_nodes[index].p_value);
+
+    // Traverse the left node
+    binary_compact_tree_traverse_preorder_node(p_binary_compact_tree, p_binary_compact_tree->p_nodes[index].left, pfn_traverse);
+
+    // Traverse the right node
+    return binary_compact_tree_traverse_preorder_node(p_binary_compact_tree, p_binary_compact_tree->p_nodes[index].right, pfn_traverse);
+}
+
+int binary_compact_tree_traverse_inorder_node ( const binary_compact_tree *const p_binary_compact_tree, uint32_t index, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Base case
+    if ( index == BINARY_COMPACT_TREE_NONE ) return 1;
+
+    // Traverse the left node
+    binary_compact_tree_traverse_inorder_node(p_binary_compact_tree, p_binary_compact_tree->p_nodes[index].left, pfn_traverse);
+
+    // Call the traverse function
+    pfn_traverse(p_binary_compact_tree->p_nodes[index].p_value);
+
+    // Traverse the right node
+    return binary_compact_tree_traverse_inorder_node(p_binary_compact_tree, p_binary_compact_tree->p_nodes[index].right, pfn_traverse);
+}
+
+int binary_compact_tree_traverse_postorder_node ( const binary_compact_tree *const p_binary_compact_tree, uint32_t index, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Base case
+    if ( index == BINARY_COMPACT_TREE_NONE ) return 1;
+
+    // Traverse the left node
+    binary_compact_tree_traverse_postorder_node(p_binary_compact_tree, p_binary_compact_tree->p_nodes[index].left, pfn_traverse);
+
+    // Traverse the right node
+    binary_compact_tree_traverse_postorder_node(p_binary_compact_tree, p_binary_compact_tree->p_nodes[index].right, pfn_traverse);
+
+    // Call the traverse function
+    return pfn_traverse(p_binary_compact_tree->p_nodes[index].p_value);
+}
+
+int binary_compact_tree_traverse_preorder ( binary_compact_tree *const p_binary_compact_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+    if ( pfn_traverse          == (void *) 0 ) goto no_traverse_function;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Traverse the tree
+    binary_compact_tree_traverse_preorder_node(p_binary_compact_tree, p_binary_compact_tree->root, pfn_traverse);
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_traverse_inorder ( binary_compact_tree *const p_binary_compact_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+    if ( pfn_traverse          == (void *) 0 ) goto no_traverse_function;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Traverse the tree
+    binary_compact_tree_traverse_inorder_node(p_binary_compact_tree, p_binary_compact_tree->root, pfn_traverse);
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_traverse_postorder ( binary_compact_tree *const p_binary_compact_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+    if ( pfn_traverse          == (void *) 0 ) goto no_traverse_function;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Traverse the tree
+    binary_compact_tree_traverse_postorder_node(p_binary_compact_tree, p_binary_compact_tree->root, pfn_traverse);
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_parse ( binary_compact_tree **const pp_binary_compact_tree, const char *p_path, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, fn_binary_compact_tree_parse *pfn_parse_value )
+{
+
+    // Argument check
+    if ( pp_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+    if ( p_path                 == (void *) 0 ) goto no_path;
+    if ( pfn_parse_value        == (void *) 0 ) goto no_parser;
+
+    // Initialized data
+    binary_compact_tree *p_binary_compact_tree = (void *) 0;
+    unsigned long long   node_quantity         = 0,
+                         node_size             = 0,
+                         left_pointer          = 0,
+                         right_pointer         = 0;
+    FILE                *p_f                   = fopen(p_path, "rb");
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Read the metadata
+    if ( fread(&node_quantity, sizeof(unsigned long long), 1, p_f) != 1 ) goto invalid_file;
+    if ( fread(&node_size, sizeof(unsigned long long), 1, p_f) != 1 ) goto invalid_file;
+
+    // Error check
+    if ( node_size <= 2 * sizeof(unsigned long long) ) goto invalid_file;
+    if ( node_quantity >= BINARY_COMPACT_TREE_NONE ) goto invalid_file;
+
+    // Construct a compact binary tree
+    if ( binary_compact_tree_construct(&p_binary_compact_tree, pfn_is_equal, pfn_key_accessor, node_size - ( 2 * sizeof(unsigned long long) )) == 0 ) goto failed_to_construct_binary_compact_tree;
+
+    // Allocate the whole pool up front
+    if ( binary_compact_tree_reserve(p_binary_compact_tree, (size_t) node_quantity) == 0 ) goto failed_to_parse_record;
+
+    // Read the file in large blocks
+    setvbuf(p_f, (void *) 0, _IOFBF, BINARY_TREE_PARSE_BUFFER_SIZE);
+
+    // Read each record straight into its slot. A node's index is its node pointer
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        binary_compact_tree_node *p_node = &p_binary_compact_tree->p_nodes[i];
+        long                      offset = (long) ( ( 2 * sizeof(unsigned long long) ) + ( i * node_size ) );
+
+        // Set the pointer correctly
+        fseek(p_f, offset, SEEK_SET);
+
+        // User provided parsing function
+        if ( pfn_parse_value(p_f, &p_node->p_value) == 0 ) goto failed_to_parse_record;
+
+        // Set the pointer correctly
+        fseek(p_f, offset + (long) ( node_size - ( 2 * sizeof(unsigned long long) ) ), SEEK_SET);
+
+        // Read the node pointers
+        if ( fread(&left_pointer, sizeof(unsigned long long), 1, p_f) != 1 ) goto failed_to_parse_record;
+        if ( fread(&right_pointer, sizeof(unsigned long long), 1, p_f) != 1 ) goto failed_to_parse_record;
+
+        // Error check
+        if ( left_pointer  != binary_compact_tree_null_pointer && left_pointer  >= node_quantity ) goto failed_to_parse_record;
+        if ( right_pointer != binary_compact_tree_null_pointer && right_pointer >= node_quantity ) goto failed_to_parse_record;
+
+        // Store the children
+        p_node->left  = ( left_pointer  == binary_compact_tree_null_pointer ) ? BINARY_COMPACT_TREE_NONE : (uint32_t) left_pointer;
+        p_node->right = ( right_pointer == binary_compact_tree_null_pointer ) ? BINARY_COMPACT_TREE_NONE : (uint32_t) right_pointer;
+
+        // Increment the node quantity
+        p_binary_compact_tree->metadata.node_quantity++;
+    }
+
+    // The root is the first record
+    if ( node_quantity ) p_binary_compact_tree->root = 0;
+
+    // Close the file
+    fclose(p_f);
+
+    // Return a pointer to the caller
+    *pp_binary_compact_tree = p_binary_compact_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pp_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_parser:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pfn_parse_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            invalid_file:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] File \"%s\" is not a serialized binary tree in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_construct_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Failed to construct compact binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_parse_record:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Failed to parse record in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Release the compact binary tree
+                binary_compact_tree_destroy(&p_binary_compact_tree);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_serialize ( binary_compact_tree *const p_binary_compact_tree, const char *p_path, fn_binary_compact_tree_serialize *pfn_serialize_value )
+{
+
+    // Argument check
+    if ( p_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+    if ( p_path                == (void *) 0 ) goto no_path;
+    if ( pfn_serialize_value   == (void *) 0 ) goto no_serializer;
+
+    // Initialized data
+    size_t              node_size       = (size_t) p_binary_compact_tree->metadata.node_size,
+                        record_quantity = ( BINARY_TREE_SERIALIZE_BUFFER_SIZE / node_size ) ? ( BINARY_TREE_SERIALIZE_BUFFER_SIZE / node_size ) : 1,
+                        records         = 0;
+    char               *p_buffer        = (void *) 0;
+    FILE               *p_f             = (void *) 0,
+                       *p_buffer_file   = (void *) 0;
+    unsigned long long  left_pointer    = 0,
+                        right_pointer   = 0;
+
+    // Allocate the record buffer. The extra byte absorbs the null terminator
+    // that fmemopen writes after the last byte written to the stream
+    p_buffer = TREE_REALLOC(0, ( record_quantity * node_size ) + 1);
+
+    // Error check
+    if ( p_buffer == (void *) 0 ) goto no_mem;
+
+    // Open the record buffer as a stream, so the value serializer can write to it
+    p_buffer_file = fmemopen(p_buffer, ( record_quantity * node_size ) + 1, "w");
+
+    // Error check
+    if ( p_buffer_file == (void *) 0 ) goto failed_to_open_buffer;
+
+    // Write straight through to the record buffer
+    setvbuf(p_buffer_file, (void *) 0, _IONBF, 0);
+
+    // Open the file
+    p_f = fopen(p_path, "wb");
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Lock
+    mutex_lock(&p_binary_compact_tree->_lock);
+
+    // Write the metadata
+    fwrite(&p_binary_compact_tree->metadata.node_quantity, sizeof(unsigned long long), 1, p_f);
+    fwrite(&p_binary_compact_tree->metadata.node_size, sizeof(unsigned long long), 1, p_f);
+
+    // Write the pool in order. The root is the first node, and a node's index
+    // is its node pointer
+    for (size_t i = 0; i < p_binary_compact_tree->metadata.node_quantity; i++)
+    {
+
+        // Initialized data
+        const binary_compact_tree_node *p_node = &p_binary_compact_tree->p_nodes[i];
+        size_t                          offset = records * node_size;
+
+        // Store the node pointers
+        left_pointer  = ( p_node->left  == BINARY_COMPACT_TREE_NONE ) ? binary_compact_tree_null_pointer : p_node->left;
+        right_pointer = ( p_node->right == BINARY_COMPACT_TREE_NONE ) ? binary_compact_tree_null_pointer : p_node->right;
+
+        // Clear the record, in case the value serializer writes a short record
+        memset(&p_buffer[offset], 0, node_size);
+
+        // Set the pointer correctly
+        fseek(p_buffer_file, (long) offset, SEEK_SET);
+
+        // Serialize the value
+        pfn_serialize_value(p_buffer_file, p_node->p_value);
+
+        // Set the pointer correctly
+        fseek(p_buffer_file, (long) ( offset + node_size - ( 2 * sizeof(unsigned long long) ) ), SEEK_SET);
+
+        // Write the node pointers to the record
+        fwrite(&left_pointer, sizeof(unsigned long long), 1, p_buffer_file);
+        fwrite(&right_pointer, sizeof(unsigned long long), 1, p_buffer_file);
+
+        // Increment the record quantity
+        records++;
+
+        // Write the record buffer to the file when it is full, or when there are no more nodes
+        if ( records == record_quantity || i + 1 == p_binary_compact_tree->metadata.node_quantity )
+        {
+
+            // Write the records
+            if ( fwrite(p_buffer, node_size, records, p_f) != records ) goto failed_to_write_file;
+
+            // Reset the record quantity
+            records = 0;
+        }
+    }
+
+    // Unlock
+    mutex_unlock(&p_binary_compact_tree->_lock);
+
+    // Clean up
+    fclose(p_f);
+    fclose(p_buffer_file);
+    p_buffer = TREE_REALLOC(p_buffer, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_serializer:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pfn_serialize_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_open_buffer:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Call to function \"fmemopen\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_buffer = TREE_REALLOC(p_buffer, 0);
+
+                // Error
+                return 0;
+
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Clean up
+                fclose(p_buffer_file);
+                p_buffer = TREE_REALLOC(p_buffer, 0);
+
+                // Error
+                return 0;
+
+            failed_to_write_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to write file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Unlock
+                mutex_unlock(&p_binary_compact_tree->_lock);
+
+                // Clean up
+                fclose(p_f);
+                fclose(p_buffer_file);
+                p_buffer = TREE_REALLOC(p_buffer, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_compact_tree_destroy ( binary_compact_tree **const pp_binary_compact_tree )
+{
+
+    // Argument check
+    if ( pp_binary_compact_tree == (void *) 0 ) goto no_binary_compact_tree;
+
+    // Initialized data
+    binary_compact_tree *p_binary_compact_tree = *pp_binary_compact_tree;
+
+    // Fast exit
+    if ( p_binary_compact_tree == (void *) 0 ) return 1;
+
+    // No more pointer for caller
+    *pp_binary_compact_tree = (void *) 0;
+
+    // Free the pool
+    if ( p_binary_compact_tree->p_nodes ) p_binary_compact_tree->p_nodes = TREE_REALLOC(p_binary_compact_tree->p_nodes, 0);
+
+    // Destroy the lock
+    mutex_destroy(&p_binary_compact_tree->_lock);
+
+    // Free the compact binary tree
+    p_binary_compact_tree = TREE_REALLOC(p_binary_compact_tree, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_compact_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary compact] Null pointer provided for parameter \"pp_binary_compact_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,1080 @@
+/** !
+ * Implementation of lock free binary search tree
+ *
+ * @file binary_lockfree.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header file
+#include <tree/binary_lockfree.h>
+
+// Preprocessor definitions
+#define BINARY_LOCKFREE_TREE_EDGE_FLAG    ( (uintptr_t) 1 )
+#define BINARY_LOCKFREE_TREE_EDGE_TAG     ( (uintptr_t) 2 )
+#define BINARY_LOCKFREE_TREE_EDGE_ADDRESS ( ~(uintptr_t) 3 )
+
+#define BINARY_LOCKFREE_TREE_NODE(edge) ( (binary_lockfree_tree_node *) ( (edge) & BINARY_LOCKFREE_TREE_EDGE_ADDRESS ) )
+#define BINARY_LOCKFREE_TREE_LOAD(p_edge) __atomic_load_n((p_edge), __ATOMIC_ACQUIRE)
+
+// Structure definitions
+struct binary_lockfree_tree_seek_record_s
+{
+    binary_lockfree_tree_node *p_ancestor,
+                              *p_successor,
+                              *p_parent,
+                              *p_leaf;
+};
+
+struct binary_lockfree_tree_epoch_record_s
+{
+    struct binary_lockfree_tree_epoch_record_s *p_next;
+    int                                         in_use,
+                                                active;
+    unsigned long long                          epoch;
+    size_t                                      depth;
+    binary_lockfree_tree_node                  *p_retired;
+    size_t                                      retired_quantity;
+};
+
+// Type definitions
+typedef struct binary_lockfree_tree_seek_record_s  binary_lockfree_tree_seek_record;
+typedef struct binary_lockfree_tree_epoch_record_s binary_lockfree_tree_epoch_record;
+
+// Static data
+static unsigned long long                          binary_lockfree_tree_global_epoch = 0;
+static binary_lockfree_tree_epoch_record          *p_binary_lockfree_tree_epoch_records = (void *) 0;
+static __thread binary_lockfree_tree_epoch_record *p_binary_lockfree_tree_thread_record = (void *) 0;
+static pthread_key_t                               binary_lockfree_tree_thread_key;
+static pthread_once_t                              binary_lockfree_tree_thread_key_once = PTHREAD_ONCE_INIT;
+
+// Forward declarations
+/** !
+ * Allocate a lock free binary tree node with room for a key
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param pp_node                return
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_node_allocate ( binary_lockfree_tree *const p_binary_lockfree_tree, binary_lockfree_tree_node **const pp_node );
+
+/** !
+ * Point a node at a key, copying the key into the node IF the lock free binary
+ * tree copies keys
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_node                 the node
+ * @param p_key                  the key
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_node_key_set ( binary_lockfree_tree *const p_binary_lockfree_tree, binary_lockfree_tree_node *const p_node, const void *const p_key );
+
+/** !
+ * Compare the key of a node to a key. Sentinel nodes are greater than any key
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_node                 the node
+ * @param p_key                  the key
+ *
+ * @return 0 if the keys are equal, less than 0 if the key is less than the node's key, else greater than 0
+ */
+int binary_lockfree_tree_compare ( const binary_lockfree_tree *const p_binary_lockfree_tree, const binary_lockfree_tree_node *const p_node, const void *const p_key );
+
+/** !
+ * Find the leaf where a key is, or would be, and the nodes above it that a
+ * remove must change
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_key                  the key
+ * @param p_seek_record          return
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_seek ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, binary_lockfree_tree_seek_record *const p_seek_record );
+
+/** !
+ * Unlink a flagged leaf and its parent from a lock free binary tree, along with
+ * any chain of tagged nodes above them
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_key                  the key that led to the flagged leaf
+ * @param p_seek_record          the seek record of the key
+ *
+ * @return 1 if this thread unlinked the nodes, 0 if another thread changed the tree first
+ */
+int binary_lockfree_tree_cleanup ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, const binary_lockfree_tree_seek_record *const p_seek_record );
+
+/** !
+ * Call a function on each value in a subtree of a lock free binary tree, in order
+ *
+ * @param edge         the edge to the root of the subtree
+ * @param pfn_traverse called for each value in the subtree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_traverse_inorder_node ( uintptr_t edge, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Free every node in a subtree of a lock free binary tree
+ *
+ * @param p_node the root of the subtree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_node_destroy ( binary_lockfree_tree_node *p_node );
+
+/** !
+ * Mark the calling thread as in a lock free binary tree. Nodes that are removed
+ * while the thread is in a tree are not freed until it leaves. Calls nest; only
+ * the outermost call announces the thread
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_epoch_enter ( void );
+
+/** !
+ * Leave the innermost lock free binary tree the calling thread entered. The
+ * thread is out of every tree once each enter has been matched by an exit
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_epoch_exit ( void );
+
+/** !
+ * Hand an unlinked node to the calling thread's epoch record, to be freed once
+ * no thread can still be reading it
+ *
+ * @param p_node the node
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_epoch_retire ( binary_lockfree_tree_node *p_node );
+
+/** !
+ * Advance the global epoch IF every thread in a tree has seen it, then free the
+ * calling thread's retired nodes that are two or more epochs old
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_epoch_collect ( void );
+
+/** !
+ * Release an epoch record when its thread exits, so another thread can claim it
+ *
+ * @param p_record the epoch record
+ */
+void binary_lockfree_tree_epoch_record_release ( void *p_record );
+
+/** !
+ * Create the key that releases epoch records when threads exit
+ */
+void binary_lockfree_tree_epoch_key_create ( void );
+
+// Function definitions
+int binary_lockfree_tree_node_allocate ( binary_lockfree_tree *const p_binary_lockfree_tree, binary_lockfree_tree_node **const pp_node )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_lockfree_tree
+    //       or pp_node is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_lockfree_tree_node *p_node = TREE_REALLOC(0, sizeof(binary_lockfree_tree_node) + p_binary_lockfree_tree->key_size);
+
+    // Error check
+    if ( p_node == (void *) 0 ) goto no_mem;
+
+    // Initialize the node
+    *p_node = (binary_lockfree_tree_node)
+    {
+        .left           = 0,
+        .right          = 0,
+        .p_value        = (void *) 0,
+        .p_key          = (void *) 0,
+        .p_next_retired = (void *) 0,
+        .retired_epoch  = 0,
+        .infinity       = 0
+    };
+
+    // Return a pointer to the caller
+    *pp_node = p_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_node_key_set ( binary_lockfree_tree *const p_binary_lockfree_tree, binary_lockfree_tree_node *const p_node, const void *const p_key )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_lockfree_tree
+    //       or p_node is null. Check your parameters before you call.
+
+    // Point at the key
+    if ( p_binary_lockfree_tree->key_size == 0 || p_key == (void *) 0 )
+        p_node->p_key = p_key;
+
+    // Copy the key
+    else
+    {
+
+        // Copy the key into the node
+        memcpy(p_node->_key, p_key, p_binary_lockfree_tree->key_size);
+
+        // Point at the copy
+        p_node->p_key = p_node->_key;
+    }
+
+    // Success
+    return 1;
+}
+
+int binary_lockfree_tree_compare ( const binary_lockfree_tree *const p_binary_lockfree_tree, const binary_lockfree_tree_node *const p_node, const void *const p_key )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_lockfree_tree
+    //       or p_node is null. Check your parameters before you call.
+
+    // Sentinels are greater than any key
+    if ( p_node->infinity ) return -1;
+
+    // Compare the keys
+    return p_binary_lockfree_tree->functions.pfn_is_equal(p_node->p_key, p_key);
+}
+
+int binary_lockfree_tree_seek ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, binary_lockfree_tree_seek_record *const p_seek_record )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_lockfree_tree,
+    //       p_key, or p_seek_record is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_lockfree_tree_node *p_root          = p_binary_lockfree_tree->p_root,
+                              *p_sentinel      = BINARY_LOCKFREE_TREE_NODE(p_root->left),
+                              *p_current       = (void *) 0;
+    uintptr_t                  parent_field    = BINARY_LOCKFREE_TREE_LOAD(&p_sentinel->left),
+                               current_field   = 0;
+
+    // Start below the sentinels
+    *p_seek_record = (binary_lockfree_tree_seek_record)
+    {
+        .p_ancestor  = p_root,
+        .p_successor = p_sentinel,
+        .p_parent    = p_sentinel,
+        .p_leaf      = BINARY_LOCKFREE_TREE_NODE(parent_field)
+    };
+
+    // Load the edge below the leaf
+    current_field = BINARY_LOCKFREE_TREE_LOAD(&p_seek_record->p_leaf->left);
+    p_current     = BINARY_LOCKFREE_TREE_NODE(current_field);
+
+    // Walk down to a leaf
+    while ( p_current )
+    {
+
+        // The last untagged edge is the one a remove swings
+        if ( ( parent_field & BINARY_LOCKFREE_TREE_EDGE_TAG ) == 0 )
+        {
+            p_seek_record->p_ancestor  = p_seek_record->p_parent;
+            p_seek_record->p_successor = p_seek_record->p_leaf;
+        }
+
+        // Step down
+        p_seek_record->p_parent = p_seek_record->p_leaf;
+        p_seek_record->p_leaf   = p_current;
+        parent_field            = current_field;
+
+        // Choose a side
+        current_field = ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_current, p_key) < 0 )
+                      ? BINARY_LOCKFREE_TREE_LOAD(&p_current->left)
+                      : BINARY_LOCKFREE_TREE_LOAD(&p_current->right);
+        p_current     = BINARY_LOCKFREE_TREE_NODE(current_field);
+    }
+
+    // Success
+    return 1;
+}
+
+int binary_lockfree_tree_cleanup ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, const binary_lockfree_tree_seek_record *const p_seek_record )
+{
+
+    // NOTE: This function has undefined behavior if p_binary_lockfree_tree,
+    //       p_key, or p_seek_record is null. Check your parameters before you call.
+
+    // Initialized data
+    binary_lockfree_tree_node *p_ancestor      = p_seek_record->p_ancestor,
+                              *p_successor     = p_seek_record->p_successor,
+                              *p_parent        = p_seek_record->p_parent,
+                              *p_node          = (void *) 0;
+    uintptr_t                 *p_successor_edge = ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_ancestor, p_key) < 0 ) ? &p_ancestor->left : &p_ancestor->right,
+                              *p_child_edge     = &p_parent->right,
+                              *p_sibling_edge   = &p_parent->left,
+                               expected         = (uintptr_t) p_successor,
+                               sibling          = 0;
+
+    // The key is left of the parent
+    if ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_parent, p_key) < 0 )
+        p_child_edge = &p_parent->left,
+        p_sibling_edge = &p_parent->right;
+
+    // IF the leaf on the key's side is not the one being removed, keep it
+    if ( ( BINARY_LOCKFREE_TREE_LOAD(p_child_edge) & BINARY_LOCKFREE_TREE_EDGE_FLAG ) == 0 )
+        p_sibling_edge = p_child_edge;
+
+    // Tag the sibling edge, so it can not change while it moves up
+    sibling = __atomic_fetch_or(p_sibling_edge, BINARY_LOCKFREE_TREE_EDGE_TAG, __ATOMIC_ACQ_REL) | BINARY_LOCKFREE_TREE_EDGE_TAG;
+
+    // Swing the successor edge past the parent, keeping the sibling's flag
+    if ( __atomic_compare_exchange_n(p_successor_edge, &expected, ( sibling & BINARY_LOCKFREE_TREE_EDGE_ADDRESS ) | ( sibling & BINARY_LOCKFREE_TREE_EDGE_FLAG ), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == false ) return 0;
+
+    // Retire the chain of tagged nodes from the successor to the parent
+    for (p_node = p_successor; p_node != p_parent; )
+    {
+
+        // Initialized data
+        bool left = binary_lockfree_tree_compare(p_binary_lockfree_tree, p_node, p_key) < 0;
+        binary_lockfree_tree_node *p_next = BINARY_LOCKFREE_TREE_NODE(BINARY_LOCKFREE_TREE_LOAD(left ? &p_node->left : &p_node->right));
+
+        // Retire the flagged leaf off the path
+        binary_lockfree_tree_epoch_retire(BINARY_LOCKFREE_TREE_NODE(BINARY_LOCKFREE_TREE_LOAD(left ? &p_node->right : &p_node->left)));
+
+        // Retire the node
+        binary_lockfree_tree_epoch_retire(p_node);
+
+        // Step down
+        p_node = p_next;
+    }
+
+    // Retire the removed leaf
+    binary_lockfree_tree_epoch_retire(BINARY_LOCKFREE_TREE_NODE(BINARY_LOCKFREE_TREE_LOAD(( p_sibling_edge == &p_parent->left ) ? &p_parent->right : &p_parent->left)));
+
+    // Retire the parent
+    binary_lockfree_tree_epoch_retire(p_parent);
+
+    // Success
+    return 1;
+}
+
+int binary_lockfree_tree_construct ( binary_lockfree_tree **const pp_binary_lockfree_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, size_t key_size )
+{
+
+    // Argument check
+    if ( pp_binary_lockfree_tree == (void *) 0 ) goto no_binary_lockfree_tree;
+
+    // Initialized data
+    binary_lockfree_tree      *p_binary_lockfree_tree = TREE_REALLOC(0, sizeof(binary_lockfree_tree));
+    binary_lockfree_tree_node *_sentinels[5]          = { 0 };
+
+    // Error check
+    if ( p_binary_lockfree_tree == (void *) 0 ) goto no_mem;
+
+    // Populate the lock free binary tree structure
+    *p_binary_lockfree_tree = (binary_lockfree_tree)
+    {
+        .p_root    = (void *) 0,
+        .functions =
+        {
+            .pfn_is_equal     = (pfn_is_equal)     ? pfn_is_equal     : tree_compare_function,
+            .pfn_key_accessor = (pfn_key_accessor) ? pfn_key_accessor : tree_key_is_value
+        },
+        .key_size  = key_size
+    };
+
+    // Allocate the sentinels
+    for (size_t i = 0; i < 5; i++)
+        if ( binary_lockfree_tree_node_allocate(p_binary_lockfree_tree, &_sentinels[i]) == 0 ) goto failed_to_allocate_sentinel;
+
+    // The root and the node below it route everything left
+    _sentinels[0]->infinity = 3, _sentinels[0]->left = (uintptr_t) _sentinels[1], _sentinels[0]->right = (uintptr_t) _sentinels[4];
+    _sentinels[1]->infinity = 2, _sentinels[1]->left = (uintptr_t) _sentinels[2], _sentinels[1]->right = (uintptr_t) _sentinels[3];
+
+    // The leaves
+    _sentinels[2]->infinity = 1;
+    _sentinels[3]->infinity = 2;
+    _sentinels[4]->infinity = 3;
+
+    // Store the root
+    p_binary_lockfree_tree->p_root = _sentinels[0];
+
+    // Return a pointer to the caller
+    *pp_binary_lockfree_tree = p_binary_lockfree_tree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_lockfree_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"pp_binary_lockfree_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_sentinel:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Failed to allocate sentinel node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the sentinels
+                for (size_t i = 0; i < 5; i++) if ( _sentinels[i] ) _sentinels[i] = TREE_REALLOC(_sentinels[i], 0);
+
+                // Free the lock free binary tree
+                p_binary_lockfree_tree = TREE_REALLOC(p_binary_lockfree_tree, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_search ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, void **pp_value )
+{
+
+    // Argument check
+    if ( p_binary_lockfree_tree == (void *) 0 ) goto no_binary_lockfree_tree;
+    if ( p_key                  == (void *) 0 ) goto no_key;
+    if ( pp_value               == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    binary_lockfree_tree_node *p_node = p_binary_lockfree_tree->p_root;
+    uintptr_t                  edge   = 0;
+
+    // Enter the tree
+    if ( binary_lockfree_tree_epoch_enter() == 0 ) goto failed_to_enter_epoch;
+
+    // Walk down to a leaf
+    while ( ( edge = ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_node, p_key) < 0 ) ? BINARY_LOCKFREE_TREE_LOAD(&p_node->left) : BINARY_LOCKFREE_TREE_LOAD(&p_node->right) ) )
+        p_node = BINARY_LOCKFREE_TREE_NODE(edge);
+
+    // Not found
+    if ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_node, p_key) != 0 ) goto not_found;
+
+    // Return the value to the caller
+    *pp_value = p_node->p_value;
+
+    // Leave the tree
+    binary_lockfree_tree_epoch_exit();
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_lockfree_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"p_binary_lockfree_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_key:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"p_key\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            not_found:
+
+                // Leave the tree
+                binary_lockfree_tree_epoch_exit();
+
+                // Error
+                return 0;
+
+            failed_to_enter_epoch:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Failed to enter epoch in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_insert ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_value )
+{
+
+    // Argument check
+    if ( p_binary_lockfree_tree == (void *) 0 ) goto no_binary_lockfree_tree;
+
+    // Initialized data
+    const void                       *p_key      = p_binary_lockfree_tree->functions.pfn_key_accessor(p_value);
+    binary_lockfree_tree_node        *p_leaf     = (void *) 0,
+                                     *p_internal = (void *) 0,
+                                     *p_sibling  = (void *) 0;
+    binary_lockfree_tree_seek_record  seek_record;
+    uintptr_t                        *p_edge     = (void *) 0,
+                                      expected   = 0,
+                                      edge       = 0;
+
+    // Allocate the new leaf and the node above it
+    if ( binary_lockfree_tree_node_allocate(p_binary_lockfree_tree, &p_leaf)     == 0 ) goto failed_to_allocate_node;
+    if ( binary_lockfree_tree_node_allocate(p_binary_lockfree_tree, &p_internal) == 0 ) goto failed_to_allocate_node;
+
+    // Populate the new leaf
+    p_leaf->p_value = (void *) p_value;
+    binary_lockfree_tree_node_key_set(p_binary_lockfree_tree, p_leaf, p_key);
+
+    // Enter the tree
+    if ( binary_lockfree_tree_epoch_enter() == 0 ) goto failed_to_enter_epoch;
+
+    // Until the new leaf is linked
+    while ( true )
+    {
+
+        // Find the leaf to split
+        binary_lockfree_tree_seek(p_binary_lockfree_tree, p_key, &seek_record);
+
+        // Duplicate
+        p_sibling = seek_record.p_leaf;
+        if ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_sibling, p_key) == 0 ) goto duplicate;
+
+        // The routing node takes the larger key
+        if ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_sibling, p_key) < 0 )
+        {
+            p_internal->infinity = p_sibling->infinity;
+            binary_lockfree_tree_node_key_set(p_binary_lockfree_tree, p_internal, p_sibling->p_key);
+            p_internal->left  = (uintptr_t) p_leaf;
+            p_internal->right = (uintptr_t) p_sibling;
+        }
+        else
+        {
+            p_internal->infinity = 0;
+            binary_lockfree_tree_node_key_set(p_binary_lockfree_tree, p_internal, p_key);
+            p_internal->left  = (uintptr_t) p_sibling;
+            p_internal->right = (uintptr_t) p_leaf;
+        }
+
+        // Swing the parent's edge from the leaf to the routing node
+        p_edge   = ( binary_lockfree_tree_compare(p_binary_lockfree_tree, seek_record.p_parent, p_key) < 0 ) ? &seek_record.p_parent->left : &seek_record.p_parent->right;
+        expected = (uintptr_t) p_sibling;
+        if ( __atomic_compare_exchange_n(p_edge, &expected, (uintptr_t) p_internal, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) break;
+
+        // IF a remove is in the way, help it finish
+        edge = expected;
+        if ( BINARY_LOCKFREE_TREE_NODE(edge) == p_sibling && ( edge & ( BINARY_LOCKFREE_TREE_EDGE_FLAG | BINARY_LOCKFREE_TREE_EDGE_TAG ) ) )
+            binary_lockfree_tree_cleanup(p_binary_lockfree_tree, p_key, &seek_record);
+    }
+
+    // Leave the tree
+    binary_lockfree_tree_epoch_exit();
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_lockfree_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"p_binary_lockfree_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_allocate_node:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Failed to allocate node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the new leaf
+                if ( p_leaf ) p_leaf = TREE_REALLOC(p_leaf, 0);
+
+                // Error
+                return 0;
+
+            failed_to_enter_epoch:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Failed to enter epoch in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // The new nodes were never linked
+                p_leaf     = TREE_REALLOC(p_leaf, 0);
+                p_internal = TREE_REALLOC(p_internal, 0);
+
+                // Error
+                return 0;
+
+            duplicate:
+
+                // Leave the tree
+                binary_lockfree_tree_epoch_exit();
+
+                // The new nodes were never linked
+                p_leaf     = TREE_REALLOC(p_leaf, 0);
+                p_internal = TREE_REALLOC(p_internal, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_remove ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, const void **const pp_value )
+{
+
+    // Argument check
+    if ( p_binary_lockfree_tree == (void *) 0 ) goto no_binary_lockfree_tree;
+    if ( p_key                  == (void *) 0 ) goto no_key;
+
+    // Initialized data
+    binary_lockfree_tree_node        *p_leaf   = (void *) 0;
+    binary_lockfree_tree_seek_record  seek_record;
+    uintptr_t                        *p_edge   = (void *) 0,
+                                      expected = 0;
+    bool                              injected = false;
+
+    // Enter the tree
+    if ( binary_lockfree_tree_epoch_enter() == 0 ) goto failed_to_enter_epoch;
+
+    // Until the leaf is unlinked
+    while ( true )
+    {
+
+        // Find the leaf
+        binary_lockfree_tree_seek(p_binary_lockfree_tree, p_key, &seek_record);
+
+        // Cleanup mode. Done IF another thread unlinked the leaf
+        if ( injected )
+        {
+            if ( seek_record.p_leaf != p_leaf ) break;
+            if ( binary_lockfree_tree_cleanup(p_binary_lockfree_tree, p_key, &seek_record) ) break;
+
+            continue;
+        }
+
+        // Injection mode. Not found
+        p_leaf = seek_record.p_leaf;
+        if ( binary_lockfree_tree_compare(p_binary_lockfree_tree, p_leaf, p_key) != 0 ) goto not_found;
+
+        // Flag the edge to the leaf
+        p_edge   = ( binary_lockfree_tree_compare(p_binary_lockfree_tree, seek_record.p_parent, p_key) < 0 ) ? &seek_record.p_parent->left : &seek_record.p_parent->right;
+        expected = (uintptr_t) p_leaf;
+        if ( __atomic_compare_exchange_n(p_edge, &expected, (uintptr_t) p_leaf | BINARY_LOCKFREE_TREE_EDGE_FLAG, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) )
+        {
+
+            // The remove is committed. Read the value while the leaf is safe
+            injected = true;
+            if ( pp_value ) *pp_value = p_leaf->p_value;
+
+            // Unlink the leaf
+            if ( binary_lockfree_tree_cleanup(p_binary_lockfree_tree, p_key, &seek_record) ) break;
+        }
+
+        // IF another remove is in the way, help it finish
+        else if ( BINARY_LOCKFREE_TREE_NODE(expected) == p_leaf && ( expected & ( BINARY_LOCKFREE_TREE_EDGE_FLAG | BINARY_LOCKFREE_TREE_EDGE_TAG ) ) )
+            binary_lockfree_tree_cleanup(p_binary_lockfree_tree, p_key, &seek_record);
+    }
+
+    // Leave the tree
+    binary_lockfree_tree_epoch_exit();
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_lockfree_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"p_binary_lockfree_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_key:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"p_key\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            not_found:
+
+                // Leave the tree
+                binary_lockfree_tree_epoch_exit();
+
+                // Error
+                return 0;
+
+            failed_to_enter_epoch:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Failed to enter epoch in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_traverse_inorder_node ( uintptr_t edge, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // NOTE: This function has undefined behavior if pfn_traverse is null.
+    //       Check your parameters before you call.
+
+    // Initialized data
+    binary_lockfree_tree_node *p_node = BINARY_LOCKFREE_TREE_NODE(edge);
+    uintptr_t                  left   = BINARY_LOCKFREE_TREE_LOAD(&p_node->left);
+
+    // Leaf
+    if ( left == 0 )
+    {
+
+        // Skip sentinels, and leaves that are being removed
+        if ( p_node->infinity || ( edge & BINARY_LOCKFREE_TREE_EDGE_FLAG ) ) return 1;
+
+        // Call the traverse function
+        return pfn_traverse(p_node->p_value);
+    }
+
+    // Traverse the left subtree, then the right subtree
+    if ( binary_lockfree_tree_traverse_inorder_node(left, pfn_traverse) == 0 ) return 0;
+    return binary_lockfree_tree_traverse_inorder_node(BINARY_LOCKFREE_TREE_LOAD(&p_node->right), pfn_traverse);
+}
+
+int binary_lockfree_tree_traverse_inorder ( binary_lockfree_tree *const p_binary_lockfree_tree, fn_binary_tree_traverse *pfn_traverse )
+{
+
+    // Argument check
+    if ( p_binary_lockfree_tree == (void *) 0 ) goto no_binary_lockfree_tree;
+    if ( pfn_traverse           == (void *) 0 ) goto no_traverse_function;
+
+    // Initialized data
+    int result = 0;
+
+    // Enter the tree
+    if ( binary_lockfree_tree_epoch_enter() == 0 ) goto failed_to_enter_epoch;
+
+    // Traverse the tree
+    result = binary_lockfree_tree_traverse_inorder_node((uintptr_t) p_binary_lockfree_tree->p_root, pfn_traverse);
+
+    // Leave the tree
+    binary_lockfree_tree_epoch_exit();
+
+    // Done
+    return result;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_lockfree_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"p_binary_lockfree_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_traverse_function:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"pfn_traverse\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Tree errors
+        {
+            failed_to_enter_epoch:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Failed to enter epoch in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_node_destroy ( binary_lockfree_tree_node *p_node )
+{
+
+    // Base case
+    if ( p_node == (void *) 0 ) return 1;
+
+    // Free the children
+    binary_lockfree_tree_node_destroy(BINARY_LOCKFREE_TREE_NODE(p_node->left));
+    binary_lockfree_tree_node_destroy(BINARY_LOCKFREE_TREE_NODE(p_node->right));
+
+    // Free the node
+    p_node = TREE_REALLOC(p_node, 0);
+
+    // Success
+    return 1;
+}
+
+int binary_lockfree_tree_destroy ( binary_lockfree_tree **const pp_binary_lockfree_tree )
+{
+
+    // Argument check
+    if ( pp_binary_lockfree_tree == (void *) 0 ) goto no_binary_lockfree_tree;
+
+    // Initialized data
+    binary_lockfree_tree *p_binary_lockfree_tree = *pp_binary_lockfree_tree;
+
+    // No more pointer for caller
+    *pp_binary_lockfree_tree = (void *) 0;
+
+    // Free the nodes
+    binary_lockfree_tree_node_destroy(p_binary_lockfree_tree->p_root);
+
+    // Free the lock free binary tree
+    p_binary_lockfree_tree = TREE_REALLOC(p_binary_lockfree_tree, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_binary_lockfree_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [binary lockfree] Null pointer provided for parameter \"pp_binary_lockfree_tree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void binary_lockfree_tree_epoch_key_create ( void )
+{
+
+    // Release epoch records when their threads exit
+    pthread_key_create(&binary_lockfree_tree_thread_key, binary_lockfree_tree_epoch_record_release);
+}
+
+void binary_lockfree_tree_epoch_record_release ( void *p_record )
+{
+
+    // Initialized data
+    binary_lockfree_tree_epoch_record *p_epoch_record = p_record;
+
+    // Leave every tree, and let another thread claim the record. The retired
+    // nodes stay with the record, and are freed by its next owner
+    p_epoch_record->depth = 0;
+    __atomic_store_n(&p_epoch_record->active, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&p_epoch_record->in_use, 0, __ATOMIC_RELEASE);
+}
+
+int binary_lockfree_tree_epoch_enter ( void )
+{
+
+    // Initialized data
+    binary_lockfree_tree_epoch_record *p_record = p_binary_lockfree_tree_thread_record;
+
+    // First use on this thread
+    if ( p_record == (void *) 0 )
+    {
+
+        // Create the thread key
+        pthread_once(&binary_lockfree_tree_thread_key_once, binary_lockfree_tree_epoch_key_create);
+
+        // Claim a released record
+        for (p_record = __atomic_load_n(&p_binary_lockfree_tree_epoch_records, __ATOMIC_ACQUIRE); p_record; p_record = p_record->p_next)
+        {
+
+            // Initialized data
+            int expected = 0;
+
+            // Claim the record
+            if ( __atomic_compare_exchange_n(&p_record->in_use, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) break;
+        }
+
+        // Add a new record
+        if ( p_record == (void *) 0 )
+        {
+
+            // Allocate a record
+            p_record = TREE_REALLOC(0, sizeof(binary_lockfree_tree_epoch_record));
+
+            // Error check
+            if ( p_record == (void *) 0 ) goto no_mem;
+
+            // Populate the record
+            *p_record = (binary_lockfree_tree_epoch_record)
+            {
+                .p_next           = __atomic_load_n(&p_binary_lockfree_tree_epoch_records, __ATOMIC_RELAXED),
+                .in_use           = 1,
+                .active           = 0,
+                .epoch            = 0,
+                .depth            = 0,
+                .p_retired        = (void *) 0,
+                .retired_quantity = 0
+            };
+
+            // Push the record
+            while ( __atomic_compare_exchange_n(&p_binary_lockfree_tree_epoch_records, &p_record->p_next, p_record, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) == false );
+        }
+
+        // Store the record
+        pthread_setspecific(binary_lockfree_tree_thread_key, p_record);
+        p_binary_lockfree_tree_thread_record = p_record;
+    }
+
+    // Nested enter. The outer section's epoch already protects this one, and
+    // must not be moved past nodes the outer section can still reach
+    if ( p_record->depth++ ) return 1;
+
+    // Announce the thread, then the epoch it saw
+    __atomic_store_n(&p_record->active, 1, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&p_record->epoch, __atomic_load_n(&binary_lockfree_tree_global_epoch, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int binary_lockfree_tree_epoch_exit ( void )
+{
+
+    // Initialized data
+    binary_lockfree_tree_epoch_record *p_record = p_binary_lockfree_tree_thread_record;
+
+    // Leave the tree. The thread is out of every tree after the outermost exit
+    if ( p_record && p_record->depth && --p_record->depth == 0 ) __atomic_store_n(&p_record->active, 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+}
+
+int binary_lockfree_tree_epoch_retire ( binary_lockfree_tree_node *p_node )
+{
+
+    // NOTE: This function has undefined behavior if p_node is null, or if the
+    //       calling thread is not in a tree. Check your parameters before you call.
+
+    // Initialized data
+    binary_lockfree_tree_epoch_record *p_record = p_binary_lockfree_tree_thread_record;
+
+    // Stamp the node with the epoch it was unlinked in. Threads that can still
+    // reach it are in this epoch or an earlier one
+    p_node->retired_epoch  = __atomic_load_n(&binary_lockfree_tree_global_epoch, __ATOMIC_SEQ_CST);
+    p_node->p_next_retired = p_record->p_retired;
+    p_record->p_retired    = p_node;
+
+    // Periodically free old nodes
+    if ( ++p_record->retired_quantity % BINARY_LOCKFREE_TREE_RETIRE_THRESHOLD == 0 ) binary_lockfree_tree_epoch_collect();
+
+    // Success
+    return 1;
+}
+
+int binary_lockfree_tree_epoch_collect ( void )
+{
+
+    // Initialized data
+    binary_lockfree_tree_epoch_record  *p_record = p_binary_lockfree_tree_thread_record,
+                                       *p_other  = (void *) 0;
+    binary_lockfree_tree_node         **pp_node  = &p_record->p_retired,
+                                       *p_node   = (void *) 0;
+    unsigned long long                  epoch    = __atomic_load_n(&binary_lockfree_tree_global_epoch, __ATOMIC_SEQ_CST);
+
+    // Check every thread in a tree has seen the epoch
+    for (p_other = __atomic_load_n(&p_binary_lockfree_tree_epoch_records, __ATOMIC_ACQUIRE); p_other; p_other = p_other->p_next)
+        if ( __atomic_load_n(&p_other->in_use, __ATOMIC_SEQ_CST) && __atomic_load_n(&p_other->active, __ATOMIC_SEQ_CST) && __atomic_load_n(&p_other->epoch, __ATOMIC_SEQ_CST) != epoch ) break;
+
+    // Advance the epoch
+    if ( p_other == (void *) 0 && __atomic_compare_exchange_n(&binary_lockfree_tree_global_epoch, &epoch, epoch + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ) epoch++;
+
+    // Free nodes retired two or more epochs ago
+    while ( ( p_node = *pp_node ) )
+    {
+        if ( p_node->retired_epoch + 2 <= epoch )
+        {
+            *pp_node = p_node->p_next_retired;
+            p_node   = TREE_REALLOC(p_node, 0);
+        }
+        else pp_node = &p_node->p_next_retired;
+    }
+
+    // Success
+    return 1;
+}
@@ -13,8 +13,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <errno.h>
+#include <time.h>
+
+// POSIX
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 // sync submodule
 #include <sync/sync.h>
@@ -22,10 +29,43 @@
 // tree
 #include <tree/tree.h>
 
+// Preprocessor definitions
+#ifndef B_TREE_POOL_SIZE
+    #define B_TREE_POOL_SIZE 8
+#endif
+
+#ifndef B_TREE_POOL_FRAMES_MIN
+    #define B_TREE_POOL_FRAMES_MIN 8
+#endif
+
+#ifndef B_TREE_PAGE_ALIGNMENT
+    #define B_TREE_PAGE_ALIGNMENT 4096
+#endif
+
+#ifndef B_TREE_ASYNC_QUEUE_DEPTH
+    #define B_TREE_ASYNC_QUEUE_DEPTH 256
+#endif
+
+#ifndef B_TREE_FILL_FACTOR
+    #define B_TREE_FILL_FACTOR 0.9
+#endif
+
+#ifndef B_TREE_READ_AHEAD
+    #define B_TREE_READ_AHEAD 8
+#endif
+
+// Enumeration definitions
+enum b_tree_flags_e
+{
+    B_TREE_FLAG_NONE = 0,
+    B_TREE_FLAG_PLUS = 1 << 0
+};
+
 // Forward declarations
 struct b_tree_s;
 struct b_tree_node_s;
 struct b_tree_metadata_s;
+struct b_tree_cursor_s;
 
 // Type definitions
 /** !
@@ -43,6 +83,11 @@ typedef struct b_tree_node_s b_tree_node;
  */
 typedef struct b_tree_metadata_s b_tree_metadata;
 
+/** !
+ *  @brief The type definition for a b tree cursor
+ */
+typedef struct b_tree_cursor_s b_tree_cursor;
+
 /** !
  *  @brief The type definition for a function that serializes a node to a file
  * 
@@ -74,12 +119,34 @@ typedef int (fn_b_tree_parse)(FILE *p_file, b_tree *p_b_tree, b_tree_node **pp_b
  */
 typedef int (fn_b_tree_traverse)(void *p_key, void *p_value);
 
+/** !
+ *  @brief The type definition for a function that is called when an asynchronous operation completes
+ * 
+ *  @param p_context the context that was submitted with the operation
+ *  @param result    1 IF the key was found or the property was inserted ELSE 0
+ *  @param p_value   the property IF result ELSE null pointer
+ * 
+ *  @return 1 on success, 0 on error
+ */
+typedef int (fn_b_tree_complete)(void *p_context, int result, const void *p_value);
+
+/** !
+ *  @brief The type definition for a function that returns the next property of a sorted sequence
+ * 
+ *  @param p_context   the context that was passed to the bulk load
+ *  @param pp_property return
+ * 
+ *  @return 1 IF a property was returned ELSE 0 at the end of the sequence
+ */
+typedef int (fn_b_tree_next)(void *p_context, const void **pp_property);
+
 // Struct definitions
 struct b_tree_node_s
 {
     bool                leaf;
     int                 key_quantity;
-    unsigned long long  node_pointer;
+    unsigned long long  node_pointer,
+                        sibling_pointer;
     void               **properties;
     unsigned long long _child_pointers[];
 };
@@ -92,14 +159,18 @@ struct b_tree_metadata_s
                        key_quantity;
     int node_size,
         degree,
-        height;
+        height,
+        flags;
 };
 
 struct b_tree_s
 {
+    pthread_rwlock_t  _rwlock;
     b_tree_metadata   _metadata;
-    b_tree_node     *p_root;
-    FILE            *p_random_access;
+    b_tree_node      *p_root;
+    int               random_access;
+    void             *p_pool;
+    void             *p_async;
 
     struct 
     {
@@ -109,6 +180,16 @@ struct b_tree_s
     } functions;
 };
 
+struct b_tree_cursor_s
+{
+    const b_tree       *p_b_tree;
+    b_tree_node        *p_leaf;
+    const void         *p_hi;
+    int                 index;
+    size_t              ahead;
+    unsigned long long  ahead_pointer;
+};
+
 // Allocators
 /** !
  * Allocate memory for a b tree
@@ -121,16 +202,54 @@ int b_tree_create ( b_tree **const pp_b_tree );
 
 // Constructors
 /** !
- * Construct an empty b tree
+ * Construct a b tree from a random access file, creating the file if it does 
+ * not exist. 
+ * 
+ * Nodes are pages of node_size bytes. The first page holds the metadata, and 
+ * node n is the n'th page. Nodes are read into a fixed size buffer pool, and 
+ * changed nodes are written back when they are evicted, or when the b tree is
+ * flushed. When the buffer pool is full, a node that is not in use, and that 
+ * has not been used since the clock hand last passed it, is evicted. The root
+ * is never evicted. Properties are written as their pointer values. 
+ * 
+ * Pages are read and written at their offsets with pread and pwrite, so 
+ * searches share the b tree, and read different pages at the same time. 
+ * Inserts and flushes have the b tree to themselves. IF the library is built 
+ * with B_TREE_DIRECT_IO defined, pages bypass the operating system's page 
+ * cache, and node_size must be a multiple of B_TREE_PAGE_ALIGNMENT. 
  * 
  * @param pp_b_tree      return
+ * @param path           path to the random access file
  * @param pfn_is_equal   function for testing equality of elements in set IF parameter is not null ELSE default
  * @param degree         the degree of the b tree
  * @param node_size      the size of a serialized node in bytes
+ * @param pool_size      the size of the buffer pool in megabytes IF not zero ELSE B_TREE_POOL_SIZE
  * 
  * @return 1 on success, 0 on error
  */
-int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree_equal *pfn_is_equal, int degree, unsigned long long node_size );
+int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree_equal *pfn_is_equal, int degree, unsigned long long node_size, size_t pool_size );
+
+/** !
+ * Construct a b tree from a random access file with flags, creating the file 
+ * if it does not exist. IF the file exists, the flags it was created with are
+ * used. 
+ * 
+ * B_TREE_FLAG_PLUS lays the b tree out as a B+ tree. Every property is stored 
+ * in a leaf, the properties of the nodes above the leaves only separate their
+ * children, and each leaf points to the leaf after it, so a range of 
+ * properties is read with b_tree_scan. 
+ * 
+ * @param pp_b_tree      return
+ * @param path           path to the random access file
+ * @param pfn_is_equal   function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param degree         the degree of the b tree
+ * @param node_size      the size of a serialized node in bytes
+ * @param pool_size      the size of the buffer pool in megabytes IF not zero ELSE B_TREE_POOL_SIZE
+ * @param flags          bitwise OR of b_tree_flags_e values
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_construct_with_flags ( b_tree **const pp_b_tree, const char *const path, fn_tree_equal *pfn_is_equal, int degree, unsigned long long node_size, size_t pool_size, int flags );
 
 // Accessors
 /** !
@@ -144,6 +263,37 @@ int b_tree_construct ( b_tree **const pp_b_tree, const char *const path, fn_tree
  */
 int b_tree_search ( const b_tree *const p_b_tree, const void *const p_key, const void **const pp_value );
 
+/** !
+ * Submit a search of a b tree, and return without waiting for it. 
+ * 
+ * The search descends through the buffer pool. When it needs a page that is 
+ * not there, the page is read with io_uring, and the search continues from 
+ * the root when the page arrives, so many searches read pages at the same 
+ * time. IF the kernel does not have io_uring, or does not allow it, pages are
+ * read with pread when the b tree is polled. pfn_complete is called from 
+ * b_tree_poll
+ * 
+ * @param p_b_tree     the b tree
+ * @param p_key        the key
+ * @param pfn_complete called when the search completes IF not null
+ * @param p_context    passed to pfn_complete
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_search_async ( b_tree *const p_b_tree, const void *const p_key, fn_b_tree_complete *pfn_complete, void *p_context );
+
+/** !
+ * Count the reads of a b tree's nodes that were served by its buffer pool, 
+ * and the reads that went to the random access file
+ * 
+ * @param p_b_tree the b tree
+ * @param p_hits   return IF not null
+ * @param p_misses return IF not null
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_pool_stats ( const b_tree *const p_b_tree, unsigned long long *p_hits, unsigned long long *p_misses );
+
 // Mutators
 /** !
  * Insert a property into a b tree
@@ -155,6 +305,61 @@ int b_tree_search ( const b_tree *const p_b_tree, const void *const p_key, const
  */
 int b_tree_insert ( b_tree *const p_b_tree, const void *const p_property );
 
+/** !
+ * Submit an insert into a b tree, and return without waiting for it. The 
+ * pages on the path of the insert are read like the pages of an asynchronous
+ * search, and the property is inserted when they are in the buffer pool. 
+ * pfn_complete is called from b_tree_poll
+ * 
+ * @param p_b_tree     the b tree
+ * @param p_property   the property
+ * @param pfn_complete called when the insert completes IF not null
+ * @param p_context    passed to pfn_complete
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_insert_async ( b_tree *const p_b_tree, const void *const p_property, fn_b_tree_complete *pfn_complete, void *p_context );
+
+/** !
+ * Start the page reads of a b tree's asynchronous operations, run the 
+ * operations whose pages arrived, and call the completion function of each 
+ * operation that completed. Frames that are being read stay pinned until the
+ * b tree is polled. A synchronous call that needs one of those frames finishes
+ * the outstanding reads itself, so synchronous and asynchronous calls can be 
+ * mixed on one thread
+ * 
+ * @param p_b_tree  the b tree
+ * @param wait      true to wait until an operation completes IF any are outstanding else false
+ * @param p_pending return the quantity of outstanding operations IF not null
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_poll ( b_tree *const p_b_tree, bool wait, size_t *const p_pending );
+
+/** !
+ * Load an empty b tree from a sorted sequence of properties. 
+ * 
+ * The leaves are packed left to right, and the property after each full 
+ * node goes up, so the levels above are built from the bottom up, without 
+ * splits. Each node is written to the random access file once, to the page 
+ * after the last page that was written. The last node of each level is filled
+ * from the node before it IF it would be less than half full, so the node 
+ * before it is held until the next node of its level fills. The metadata is 
+ * written after every node. 
+ * 
+ * In a B+ tree, the property after each full leaf also starts the next leaf, 
+ * and the page of the next leaf is reserved when the leaf before it is 
+ * written, so the leaf can point to it. 
+ * 
+ * @param p_b_tree    the b tree
+ * @param pfn_next    returns the next property in ascending order, until the end of the sequence
+ * @param p_context   passed to pfn_next
+ * @param fill_factor the fraction of each node that is filled IF greater than zero ELSE B_TREE_FILL_FACTOR
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_bulk_load ( b_tree *const p_b_tree, fn_b_tree_next *pfn_next, void *p_context, double fill_factor );
+
 /** !
  * Remove an element from a b tree
  * 
@@ -166,6 +371,16 @@ int b_tree_insert ( b_tree *const p_b_tree, const void *const p_property );
  */
 int b_tree_remove ( b_tree *const p_b_tree, const void *const p_key, const void **const p_value );
 
+/** !
+ * Write each changed node in a b tree's buffer pool, and the metadata, to the
+ * random access file
+ * 
+ * @param p_b_tree the b tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_flush ( b_tree *const p_b_tree );
+
 // Traversal
 /** !
  * Traverse a b tree using the pre order technique
@@ -178,10 +393,12 @@ int b_tree_remove ( b_tree *const p_b_tree, const void *const p_key, const void
 int b_tree_traverse_preorder ( b_tree *const p_b_tree, fn_b_tree_traverse *pfn_traverse );
 
 /** !
- * Traverse a b tree using the in order technique
+ * Traverse a b tree using the in order technique. Each property is passed to 
+ * pfn_traverse as the key and the value. The leaves of a B+ tree are read 
+ * with a cursor
  * 
  * @param p_b_tree     pointer to b tree
- * @param pfn_traverse called for each node in the b tree
+ * @param pfn_traverse called for each property in the b tree
  * 
  * @return 1 on success, 0 on error
 */
@@ -197,6 +414,48 @@ int b_tree_traverse_inorder ( b_tree *const p_b_tree, fn_b_tree_traverse *pfn_tr
 */
 int b_tree_traverse_postorder ( b_tree *const p_b_tree, fn_b_tree_traverse *pfn_traverse );
 
+// Cursor
+/** !
+ * Construct a cursor over the properties of a B+ tree in the interval 
+ * [ p_lo, p_hi ], in order. The cursor holds the b tree's read lock until it 
+ * is destroyed, so the calling thread must not modify the b tree while it 
+ * holds a cursor. 
+ * 
+ * The cursor descends to the first leaf of the range once, then follows the 
+ * sibling pointers of the leaves. While the caller consumes a leaf, the next 
+ * B_TREE_READ_AHEAD leaves are read into the buffer pool with io_uring. IF 
+ * the kernel does not have io_uring, the kernel is advised to read the next 
+ * leaf. 
+ * 
+ * @param p_b_tree          the b tree
+ * @param p_lo              the lower bound key IF not null ELSE the first property
+ * @param p_hi              the upper bound key IF not null ELSE the last property
+ * @param pp_b_tree_cursor  return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_scan ( const b_tree *const p_b_tree, const void *const p_lo, const void *const p_hi, b_tree_cursor **const pp_b_tree_cursor );
+
+/** !
+ * Advance a cursor to the next property in its range
+ * 
+ * @param p_b_tree_cursor the b tree cursor
+ * @param pp_value        return
+ * 
+ * @return 1 on success, 0 if the cursor is past the end of its range
+ */
+int b_tree_cursor_next ( b_tree_cursor *const p_b_tree_cursor, const void **const pp_value );
+
+/** !
+ * Release a b tree cursor, its leaf, and the b tree's read lock. The leaves 
+ * the cursor is reading ahead are finished first
+ * 
+ * @param pp_b_tree_cursor pointer to b tree cursor pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_cursor_destroy ( b_tree_cursor **const pp_b_tree_cursor );
+
 // Parser
 /** !
  * Construct a b tree from a file
@@ -13,7 +13,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
+#include <time.h>
+
+// POSIX
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 // sync submodule
 #include <sync/sync.h>
@@ -21,9 +30,71 @@
 // tree
 #include <tree/tree.h>
 
+// Preprocessor definitions
+#ifndef BINARY_TREE_SLAB_NODE_QUANTITY
+    #define BINARY_TREE_SLAB_NODE_QUANTITY 4096
+#endif
+
+#ifndef BINARY_TREE_SEARCH_BATCH_WIDTH
+    #define BINARY_TREE_SEARCH_BATCH_WIDTH 16
+#endif
+
+#ifndef BINARY_TREE_SERIALIZE_BUFFER_SIZE
+    #define BINARY_TREE_SERIALIZE_BUFFER_SIZE ( 4 * 1024 * 1024 )
+#endif
+
+#ifndef BINARY_TREE_PARSE_BUFFER_SIZE
+    #define BINARY_TREE_PARSE_BUFFER_SIZE ( 1024 * 1024 )
+#endif
+
+#ifndef BINARY_TREE_STATS_DEPTH_QUANTITY
+    #define BINARY_TREE_STATS_DEPTH_QUANTITY 64
+#endif
+
+#ifndef BINARY_TREE_STATS_SLOT_QUANTITY
+    #define BINARY_TREE_STATS_SLOT_QUANTITY 16
+#endif
+
+#ifndef BINARY_TREE_LAZY_CACHE_QUANTITY
+    #define BINARY_TREE_LAZY_CACHE_QUANTITY 65536
+#endif
+
+#ifndef BINARY_TREE_CONSTRUCT_PARALLEL_CUTOFF
+    #define BINARY_TREE_CONSTRUCT_PARALLEL_CUTOFF 16384
+#endif
+
+#ifndef BINARY_TREE_SORT_INSERTION_QUANTITY
+    #define BINARY_TREE_SORT_INSERTION_QUANTITY 16
+#endif
+
+#ifndef BINARY_TREE_SCAPEGOAT_ALPHA
+    #define BINARY_TREE_SCAPEGOAT_ALPHA 0.7
+#endif
+
+// Enumeration definitions
+enum binary_tree_flags_e
+{
+    BINARY_TREE_FLAG_NONE              = 0,
+    BINARY_TREE_FLAG_READER_WRITER     = 1 << 0,
+    BINARY_TREE_FLAG_ORDER_STATISTICS  = 1 << 1,
+    BINARY_TREE_FLAG_SCAPEGOAT         = 1 << 2
+};
+
+enum binary_tree_stats_operation_e
+{
+    BINARY_TREE_STATS_SEARCH    = 0,
+    BINARY_TREE_STATS_INSERT    = 1,
+    BINARY_TREE_STATS_REMOVE    = 2,
+    BINARY_TREE_STATS_QUANTITY  = 3
+};
+
 // Forward declarations
 struct binary_tree_s;
 struct binary_tree_node_s;
+struct binary_tree_cursor_s;
+struct binary_tree_snapshot_s;
+struct binary_tree_stats_slot_s;
+struct binary_tree_stats_report_s;
 
 // Type definitions
 /** !
@@ -36,6 +107,26 @@ typedef struct binary_tree_s binary_tree;
  */
 typedef struct binary_tree_node_s binary_tree_node;
 
+/** !
+ *  @brief The type definition for a binary tree cursor
+ */
+typedef struct binary_tree_cursor_s binary_tree_cursor;
+
+/** !
+ *  @brief The type definition for a point in time view of a binary tree
+ */
+typedef struct binary_tree_snapshot_s binary_tree_snapshot;
+
+/** !
+ *  @brief The type definition for one thread's binary tree statistics counters
+ */
+typedef struct binary_tree_stats_slot_s binary_tree_stats_slot;
+
+/** !
+ *  @brief The type definition for a report of a binary tree's shape and costs
+ */
+typedef struct binary_tree_stats_report_s binary_tree_stats_report;
+
 /** !
  *  @brief The type definition for a function that serializes a node to a file
  * 
@@ -73,11 +164,48 @@ struct binary_tree_node_s
     binary_tree_node *p_left,
                      *p_right;
     unsigned long long  node_pointer;
+
+    #ifdef BINARY_TREE_ORDER_STATISTICS
+        unsigned long long size;
+    #endif
+
+    #ifdef BINARY_TREE_SNAPSHOTS
+        unsigned long long generation;
+    #endif
+};
+
+struct binary_tree_stats_slot_s
+{
+    unsigned long long operations[BINARY_TREE_STATS_QUANTITY],
+                       comparisons[BINARY_TREE_STATS_QUANTITY],
+                       max_comparisons[BINARY_TREE_STATS_QUANTITY],
+                       lock_wait_ns;
+    unsigned long long _padding[6];
+};
+
+struct binary_tree_stats_report_s
+{
+    size_t             height;
+    unsigned long long node_quantity,
+                       bytes,
+                       depth_histogram[BINARY_TREE_STATS_DEPTH_QUANTITY];
+
+    struct
+    {
+        unsigned long long operations,
+                           comparisons,
+                           max_comparisons;
+        double             average_comparisons;
+    } operations[BINARY_TREE_STATS_QUANTITY];
+
+    unsigned long long lock_wait_ns;
 };
 
 struct binary_tree_s
 {
-    mutex _lock;
+    mutex             _lock;
+    pthread_rwlock_t  _rwlock;
+    int               flags;
     binary_tree_node *p_root;
     FILE             *p_random_access;
     
@@ -94,6 +222,87 @@ struct binary_tree_s
         unsigned long long node_quantity;
         unsigned long long node_size;
     } metadata;
+
+    struct
+    {
+        void   *p_keys;
+        void  **pp_values;
+        size_t  quantity,
+                key_size;
+    } frozen;
+
+    struct
+    {
+        const char *p_base;
+        size_t      size;
+    } mapped;
+
+    struct
+    {
+        void *p_cache;
+    } lazy;
+
+    struct
+    {
+        void               *p_slabs;
+        binary_tree_node   *p_free_list,
+                           *p_next,
+                           *p_end;
+        unsigned long long  next_node_pointer;
+    } allocator;
+
+    struct
+    {
+        binary_tree_node   **pp_retired;
+        size_t               quantity,
+                             retired_quantity,
+                             retired_capacity;
+        unsigned long long   generation;
+    } snapshots;
+
+    struct
+    {
+        char                *p_path;
+        binary_tree_node   **pp_slots;
+        unsigned long long  *p_free_slots,
+                            *p_dirty_slots;
+        unsigned char       *p_dirty_bits;
+        size_t               slot_quantity,
+                             slot_capacity,
+                             free_quantity,
+                             free_capacity,
+                             dirty_quantity,
+                             dirty_capacity;
+        bool                 invalid;
+    } checkpoint;
+
+    struct
+    {
+        binary_tree_node   **pp_path;
+        void               **pp_values;
+        size_t               path_capacity,
+                             value_capacity;
+        unsigned long long   max_node_quantity;
+    } scapegoat;
+
+    #ifdef BINARY_TREE_STATS
+        binary_tree_stats_slot stats[BINARY_TREE_STATS_SLOT_QUANTITY];
+    #endif
+};
+
+struct binary_tree_cursor_s
+{
+    const binary_tree  *p_binary_tree;
+    binary_tree_node  **pp_path;
+    size_t              depth,
+                        capacity;
+};
+
+struct binary_tree_snapshot_s
+{
+    binary_tree        *p_binary_tree;
+    binary_tree_node   *p_root;
+    unsigned long long  node_quantity;
 };
 
 // Constructors
@@ -109,6 +318,37 @@ struct binary_tree_s
  */
 int binary_tree_construct ( binary_tree **const pp_binary_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size );
 
+/** !
+ * Construct an empty binary tree with flags
+ * 
+ * BINARY_TREE_FLAG_READER_WRITER lets searches and traversals run in parallel. 
+ * Inserts, removes and serialization are still exclusive. 
+ * 
+ * BINARY_TREE_FLAG_ORDER_STATISTICS keeps the subtree size of each node up to 
+ * date, for binary_tree_rank, binary_tree_select, and binary_tree_count_range. 
+ * The subtree size adds 8 bytes to every node, so it is only stored IF the 
+ * library is built with BINARY_TREE_ORDER_STATISTICS. Otherwise the flag is an
+ * error. 
+ * 
+ * BINARY_TREE_FLAG_SCAPEGOAT keeps the height of the binary tree logarithmic, 
+ * with no balance information in the nodes. IF an insert places a node deeper 
+ * than log base 1 / BINARY_TREE_SCAPEGOAT_ALPHA of the node quantity, the 
+ * nearest ancestor with a child of more than BINARY_TREE_SCAPEGOAT_ALPHA of its
+ * nodes is rebuilt balanced. IF removes shrink the binary tree below 
+ * BINARY_TREE_SCAPEGOAT_ALPHA of its largest size since the last full rebuild, 
+ * the whole binary tree is rebuilt. Inserts and removes are amortized 
+ * O(log(N)), even for sorted input. 
+ * 
+ * @param pp_binary_tree   return
+ * @param pfn_is_equal     function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_key_accessor function for accessing the key of a value IF parameter is not null ELSE default
+ * @param node_size        the size of a serialized node in bytes
+ * @param flags            bitwise OR of binary_tree_flags_e values
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_construct_with_flags ( binary_tree **const pp_binary_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size, int flags );
+
 /** !
  * Construct a balanced binary tree from a sorted list of keys and values. 
  * 
@@ -121,6 +361,52 @@ int binary_tree_construct ( binary_tree **const pp_binary_tree, fn_tree_equal *p
 */
 int binary_tree_construct_balanced ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size );
 
+/** !
+ * Construct a balanced binary tree from a sorted list of keys and values on 
+ * several threads. 
+ * 
+ * Every node is reserved up front, and the top of the binary tree is linked on 
+ * the calling thread, until each subtree has at most 
+ * BINARY_TREE_CONSTRUCT_PARALLEL_CUTOFF values. The threads then take the 
+ * subtrees one at a time, until none are left. Each node is placed by its 
+ * position in pre order, so the binary tree, and its node pointers, are 
+ * identical to those of binary_tree_construct_balanced. 
+ * 
+ * @param pp_binary_tree    return
+ * @param pp_values         the list of values
+ * @param property_quantity the size of the list
+ * @param pfn_is_equal      function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_key_accessor  function for accessing the key of a value IF parameter is not null ELSE default
+ * @param node_size         the size of a serialized node in bytes
+ * @param thread_quantity   the quantity of threads IF not zero ELSE one per processor
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_construct_balanced_parallel ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size, size_t thread_quantity );
+
+/** !
+ * Construct a balanced binary tree from an unsorted list of values on several
+ * threads. 
+ * 
+ * The list is copied, and split into one run per thread. Each thread sorts its
+ * run with a stable merge sort, and adjacent runs are merged in pairs, in 
+ * parallel, until one run is left. Values with duplicate keys are dropped, 
+ * keeping the first in the list, just like binary_tree_insert, and the sorted 
+ * values are passed to binary_tree_construct_balanced_parallel. The caller's 
+ * list is not changed. 
+ * 
+ * @param pp_binary_tree    return
+ * @param pp_values         the list of values
+ * @param property_quantity the size of the list
+ * @param pfn_is_equal      function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_key_accessor  function for accessing the key of a value IF parameter is not null ELSE default
+ * @param node_size         the size of a serialized node in bytes
+ * @param thread_quantity   the quantity of threads IF not zero ELSE one per processor
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_construct_from_unsorted ( binary_tree **const pp_binary_tree, void **pp_values, size_t property_quantity, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size, size_t thread_quantity );
+
 // Accessors
 /** !
  * Search a binary tree for an element
@@ -133,6 +419,93 @@ int binary_tree_construct_balanced ( binary_tree **const pp_binary_tree, void **
  */
 int binary_tree_search ( const binary_tree *const p_binary_tree, const void *const p_key, void **pp_value );
 
+/** !
+ * Call a function on each value with a key in the interval [ p_lo, p_hi ], in 
+ * order. Only the O(log(N) + K) nodes on the search path and in the range are
+ * visited, and an explicit stack is used in place of recursion. A binary tree
+ * opened with binary_tree_open_mapped or binary_tree_open_lazy is an error. 
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_lo          the lower bound key
+ * @param p_hi          the upper bound key
+ * @param pfn_traverse  called for each value in the range
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_search_range ( const binary_tree *const p_binary_tree, const void *const p_lo, const void *const p_hi, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Search a binary tree for many keys at once. The lock is taken once, and up
+ * to BINARY_TREE_SEARCH_BATCH_WIDTH descents advance in lock step, so the cache
+ * misses of different keys overlap. A frozen or memory mapped binary tree is 
+ * searched for each key the way binary_tree_search does. A lazy binary tree 
+ * is an error, because each value is only valid until its next search. 
+ * 
+ * @param p_binary_tree the binary tree
+ * @param pp_keys       the list of keys
+ * @param key_quantity  the size of the list
+ * @param pp_values     return; the value of each key IF the key is in the binary tree ELSE null
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_search_batch ( const binary_tree *const p_binary_tree, const void *const *pp_keys, size_t key_quantity, void **pp_values );
+
+/** !
+ * Report the shape of a binary tree, and the costs of its operations. 
+ * 
+ * The height, the depth histogram, the node quantity, and the bytes used are 
+ * measured by walking the tree. The depth of the root is 0, and the last 
+ * bucket of the histogram counts every deeper node. Comparisons per search, 
+ * insert, and remove, and the time spent waiting for the lock, are only 
+ * counted IF the library is built with BINARY_TREE_STATS defined ELSE zero. 
+ * Each thread counts into its own slot, so counting does not contend. A 
+ * binary tree opened with binary_tree_open_mapped or binary_tree_open_lazy is
+ * an error. 
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_report      return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_stats ( const binary_tree *const p_binary_tree, binary_tree_stats_report *const p_report );
+
+/** !
+ * Count the keys in a binary tree that are less than a key, in O(height). The 
+ * binary tree must be constructed with BINARY_TREE_FLAG_ORDER_STATISTICS
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_key         the key
+ * @param p_rank        return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_rank ( const binary_tree *const p_binary_tree, const void *const p_key, size_t *const p_rank );
+
+/** !
+ * Find the value with the i'th smallest key in a binary tree, in O(height). 
+ * The binary tree must be constructed with BINARY_TREE_FLAG_ORDER_STATISTICS
+ * 
+ * @param p_binary_tree the binary tree
+ * @param index         the zero based index of the key, in order
+ * @param pp_value      return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_select ( const binary_tree *const p_binary_tree, size_t index, void **pp_value );
+
+/** !
+ * Count the keys of a binary tree in the interval [ p_lo, p_hi ], in O(height). 
+ * The binary tree must be constructed with BINARY_TREE_FLAG_ORDER_STATISTICS
+ * 
+ * @param p_binary_tree the binary tree
+ * @param p_lo          the lower bound key
+ * @param p_hi          the upper bound key
+ * @param p_count       return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_count_range ( const binary_tree *const p_binary_tree, const void *const p_lo, const void *const p_hi, size_t *const p_count );
+
 // Mutators
 /** !
  * Insert a property into a binary tree
@@ -155,9 +528,71 @@ int binary_tree_insert ( binary_tree *const p_binary_tree, const void *const p_v
  */
 int binary_tree_remove ( binary_tree *const p_binary_tree, const void *const p_key, const void **const p_value );
 
+/** !
+ * Build an immutable snapshot of a binary tree's keys and values in contiguous 
+ * arrays, laid out in breadth first (Eytzinger) order. binary_tree_search is 
+ * served from the snapshot until the next insert or remove discards it. 
+ * 
+ * Keys are copied into the snapshot IF key_size is not zero ELSE the snapshot
+ * stores the pointers returned by the key accessor. Copied keys are what make
+ * the snapshot fast, since the search never leaves the key array. 
+ * 
+ * @param p_binary_tree the binary tree
+ * @param key_size      the size of a key in bytes, or zero
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_freeze ( binary_tree *const p_binary_tree, size_t key_size );
+
+/** !
+ * Merge the values of another binary tree into a binary tree, and destroy the 
+ * other binary tree. 
+ * 
+ * Both binary trees are flattened in order, the values are merged in linear 
+ * time, and the binary tree is rebuilt balanced from the nodes of both binary 
+ * trees. IF both binary trees have a key, the binary tree's value is kept.
+ * 
+ * @param p_binary_tree the binary tree
+ * @param pp_other      pointer to the other binary tree pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_merge ( binary_tree *const p_binary_tree, binary_tree **const pp_other );
+
+/** !
+ * Move every value with a key greater than or equal to a key into a new 
+ * binary tree. 
+ * 
+ * The nodes are moved, not copied, so the split costs one walk from the root.
+ * Both binary trees share the slabs the nodes were carved from
+ * 
+ * @param p_binary_tree        the binary tree
+ * @param p_key                the key
+ * @param pp_binary_tree_right return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_split_at ( binary_tree *const p_binary_tree, const void *const p_key, binary_tree **const pp_binary_tree_right );
+
+/** !
+ * Move every value of another binary tree into a binary tree, and destroy the 
+ * other binary tree. Every key of the other binary tree must be greater than 
+ * every key of the binary tree. 
+ * 
+ * The nodes are moved, not copied, so the join costs one walk from the root
+ * 
+ * @param p_binary_tree        the binary tree
+ * @param pp_binary_tree_right pointer to the other binary tree pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_join ( binary_tree *const p_binary_tree, binary_tree **const pp_binary_tree_right );
+
 // Traversal
 /** !
- * Traverse a binary tree using the pre order technique
+ * Traverse a binary tree using the pre order technique. The traversal runs on 
+ * a snapshot, so IF the library is built with BINARY_TREE_SNAPSHOTS, inserts 
+ * and removes are not blocked while it runs. 
  * 
  * @param p_binary_tree pointer to binary tree
  * @param pfn_traverse  called for each node in the binary tree
@@ -167,7 +602,9 @@ int binary_tree_remove ( binary_tree *const p_binary_tree, const void *const p_k
 int binary_tree_traverse_preorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse );
 
 /** !
- * Traverse a binary tree using the in order technique
+ * Traverse a binary tree using the in order technique. The traversal runs on 
+ * a snapshot, so IF the library is built with BINARY_TREE_SNAPSHOTS, inserts 
+ * and removes are not blocked while it runs. 
  * 
  * @param p_binary_tree pointer to binary tree
  * @param pfn_traverse  called for each node in the binary tree
@@ -177,7 +614,9 @@ int binary_tree_traverse_preorder ( binary_tree *const p_binary_tree, fn_binary_
 int binary_tree_traverse_inorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse );
 
 /** !
- * Traverse a binary tree using the post order technique
+ * Traverse a binary tree using the post order technique. The traversal runs on 
+ * a snapshot, so IF the library is built with BINARY_TREE_SNAPSHOTS, inserts 
+ * and removes are not blocked while it runs. 
  * 
  * @param p_binary_tree pointer to binary tree
  * @param pfn_traverse  called for each node in the binary tree
@@ -186,9 +625,138 @@ int binary_tree_traverse_inorder ( binary_tree *const p_binary_tree, fn_binary_t
 */
 int binary_tree_traverse_postorder ( binary_tree *const p_binary_tree, fn_binary_tree_traverse *pfn_traverse );
 
+// Cursor
+/** !
+ * Construct a cursor over a binary tree. The cursor holds the binary tree's read
+ * lock until it is destroyed, so the calling thread must not modify the binary
+ * tree while it holds a cursor. A binary tree opened with 
+ * binary_tree_open_mapped or binary_tree_open_lazy is an error. 
+ * 
+ * @param pp_binary_tree_cursor return
+ * @param p_binary_tree         the binary tree
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_cursor_construct ( binary_tree_cursor **const pp_binary_tree_cursor, const binary_tree *const p_binary_tree );
+
+/** !
+ * Position a cursor on the first value with a key greater than or equal to 
+ * p_key IF p_key is not null ELSE on the first value
+ * 
+ * @param p_binary_tree_cursor the binary tree cursor
+ * @param p_key                the key
+ * @param pp_value             return
+ * 
+ * @return 1 on success, 0 if there is no such value
+ */
+int binary_tree_cursor_seek ( binary_tree_cursor *const p_binary_tree_cursor, const void *const p_key, void **pp_value );
+
+/** !
+ * Advance a cursor to the next value
+ * 
+ * @param p_binary_tree_cursor the binary tree cursor
+ * @param pp_value             return
+ * 
+ * @return 1 on success, 0 if the cursor is past the last value
+ */
+int binary_tree_cursor_next ( binary_tree_cursor *const p_binary_tree_cursor, void **pp_value );
+
+/** !
+ * Move a cursor to the previous value
+ * 
+ * @param p_binary_tree_cursor the binary tree cursor
+ * @param pp_value             return
+ * 
+ * @return 1 on success, 0 if the cursor is before the first value
+ */
+int binary_tree_cursor_prev ( binary_tree_cursor *const p_binary_tree_cursor, void **pp_value );
+
+/** !
+ * Release a binary tree cursor, and the binary tree's read lock
+ * 
+ * @param pp_binary_tree_cursor pointer to binary tree cursor pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_cursor_destroy ( binary_tree_cursor **const pp_binary_tree_cursor );
+
+// Snapshot
+/** !
+ * Take a point in time view of a binary tree, in O(1). 
+ * 
+ * While a snapshot is live, inserts and removes copy each shared node on their
+ * path instead of changing it, so the snapshot can be read without the binary 
+ * tree's lock. Replaced nodes are returned to the allocator once the last 
+ * snapshot is destroyed. Snapshots must be destroyed before the binary tree. 
+ * Memory mapped and lazy binary trees never change, and can not be snapshot. 
+ * 
+ * Copying on write needs a generation in every node, which costs 8 bytes per 
+ * node, so it is only built IF the library is built with BINARY_TREE_SNAPSHOTS.
+ * Otherwise a snapshot holds the binary tree's read lock until it is destroyed,
+ * so inserts and removes wait for it, and must not be made by the thread that 
+ * holds it. 
+ * 
+ * @param p_binary_tree           the binary tree
+ * @param pp_binary_tree_snapshot return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_snapshot_construct ( binary_tree *const p_binary_tree, binary_tree_snapshot **const pp_binary_tree_snapshot );
+
+/** !
+ * Traverse a binary tree snapshot using the pre order technique
+ * 
+ * @param p_binary_tree_snapshot the binary tree snapshot
+ * @param pfn_traverse           called for each node in the binary tree snapshot
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_snapshot_traverse_preorder ( const binary_tree_snapshot *const p_binary_tree_snapshot, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a binary tree snapshot using the in order technique
+ * 
+ * @param p_binary_tree_snapshot the binary tree snapshot
+ * @param pfn_traverse           called for each node in the binary tree snapshot
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_snapshot_traverse_inorder ( const binary_tree_snapshot *const p_binary_tree_snapshot, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a binary tree snapshot using the post order technique
+ * 
+ * @param p_binary_tree_snapshot the binary tree snapshot
+ * @param pfn_traverse           called for each node in the binary tree snapshot
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_snapshot_traverse_postorder ( const binary_tree_snapshot *const p_binary_tree_snapshot, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Write a binary tree snapshot to a file, in the format of binary_tree_serialize
+ * 
+ * @param p_binary_tree_snapshot the binary tree snapshot
+ * @param p_path                 path to the file
+ * @param pfn_serialize_node     a function for serializing nodes to the file
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_snapshot_serialize ( const binary_tree_snapshot *const p_binary_tree_snapshot, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node );
+
+/** !
+ * Release a binary tree snapshot
+ * 
+ * @param pp_binary_tree_snapshot pointer to binary tree snapshot pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_snapshot_destroy ( binary_tree_snapshot **const pp_binary_tree_snapshot );
+
 // Parser
 /** !
- * Construct a binary tree from a file
+ * Construct a binary tree from a file. A file with no nodes makes an empty
+ * binary tree. 
  * 
  * @param pp_binary_tree return
  * @param p_file         path to the file
@@ -199,9 +767,73 @@ int binary_tree_traverse_postorder ( binary_tree *const p_binary_tree, fn_binary
  */
 int binary_tree_parse ( binary_tree **const pp_binary_tree, const char *p_file, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, fn_binary_tree_parse *pfn_parse_node );
 
+/** !
+ * Parse a binary tree from a file on several threads. The records are split 
+ * into contiguous ranges, each thread parses its range through its own stream, 
+ * and children are linked by node pointer. The node parser must be safe to 
+ * call from several threads at once. 
+ * 
+ * @param pp_binary_tree        return
+ * @param p_file                path to the file
+ * @param pfn_is_equal          function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_tree_key_accessor function for accessing the key of a value IF parameter is not null ELSE default
+ * @param pfn_parse_node        a function for parsing nodes from the file
+ * @param thread_quantity       the quantity of threads IF not zero ELSE one per processor
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_parse_parallel ( binary_tree **const pp_binary_tree, const char *p_file, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, fn_binary_tree_parse *pfn_parse_node, size_t thread_quantity );
+
+/** !
+ * Open a file written by binary_tree_serialize without parsing it. The file is
+ * memory mapped, and searches and traversals follow the node pointers stored 
+ * in the file, so pages are only read when a query touches them. 
+ * 
+ * Each value is a pointer to a node's record in the file, as written by the 
+ * node serializer, so the key accessor must find the key in that record. The
+ * tree is read only; inserts, removes, and freezes fail. 
+ * 
+ * @param pp_binary_tree        return
+ * @param p_path                path to the file
+ * @param pfn_is_equal          function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_tree_key_accessor function for accessing the key of a record IF parameter is not null ELSE default
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_open_mapped ( binary_tree **const pp_binary_tree, const char *p_path, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor );
+
+/** !
+ * Open a file written by binary_tree_serialize, reading only the header and 
+ * the root record. Searches and traversals read each other record from the 
+ * file the first time they reach it, and keep it in a cache of a bounded 
+ * quantity of records. When the cache is full, a record that has not been 
+ * used since the clock hand last passed it is evicted. The root is never 
+ * evicted. 
+ * 
+ * As with binary_tree_open_mapped, each value is a pointer to a node's record,
+ * so the key accessor must find the key in that record. Records are copied out
+ * of the cache into a buffer owned by the calling thread, so threads may share
+ * the binary tree, but a value is only valid until the same thread next 
+ * searches or traverses a lazy binary tree. The tree is read only; inserts, 
+ * removes, and freezes fail. 
+ * 
+ * @param pp_binary_tree        return
+ * @param p_path                path to the file
+ * @param pfn_is_equal          function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_tree_key_accessor function for accessing the key of a record IF parameter is not null ELSE default
+ * @param cache_quantity        the most records to keep in memory IF not zero ELSE BINARY_TREE_LAZY_CACHE_QUANTITY
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_open_lazy ( binary_tree **const pp_binary_tree, const char *p_path, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_tree_key_accessor, size_t cache_quantity );
+
 // Serializer
 /** !
- * Write a binary tree to a file
+ * Write a binary tree to a file. Nodes are written in breadth first order, 
+ * through a BINARY_TREE_SERIALIZE_BUFFER_SIZE byte buffer, so the file is 
+ * written front to back in large blocks. The file is written from a snapshot,
+ * so IF the library is built with BINARY_TREE_SNAPSHOTS, inserts and removes 
+ * are not blocked while it is written. 
  * 
  * @param p_binary_tree      the binary tree 
  * @param p_path             path to the file
@@ -211,6 +843,26 @@ int binary_tree_parse ( binary_tree **const pp_binary_tree, const char *p_file,
  */
 int binary_tree_serialize ( binary_tree *const p_binary_tree, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node );
 
+/** !
+ * Bring a file up to date with a binary tree, writing only what changed since 
+ * the last checkpoint to the same path. 
+ * 
+ * The first checkpoint to a path writes every node, and from then on each 
+ * node keeps its record. Inserts and removes mark the records they change, 
+ * and a checkpoint rewrites those records and the header. Records freed by 
+ * removes are reused by later inserts. Before writing, the last records are 
+ * moved into any free records, and the file is truncated, so the file stays 
+ * dense with the root in the first record, in the format of 
+ * binary_tree_serialize, and its cost is proportional to the change. 
+ * 
+ * @param p_binary_tree      the binary tree
+ * @param p_path             path to the file
+ * @param pfn_serialize_node a function for serializing nodes to the file
+ * 
+ * @return 1 on success, 0 on error
+ */
+int binary_tree_checkpoint ( binary_tree *const p_binary_tree, const char *p_path, fn_binary_tree_serialize *pfn_serialize_node );
+
 // Destructors
 /** !
  * Deallocate a binary tree
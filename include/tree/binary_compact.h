@@ -0,0 +1,213 @@
+/** !
+ * Include header for compact binary search tree
+ *
+ * Nodes live in one contiguous pool, and refer to their children by 32 bit
+ * indices, so a node is a value pointer and two indices. The pool is kept
+ * dense, with the root in the first slot, so a node's index is its node
+ * pointer in the file, and the tree is serialized by writing the pool in
+ * order. Files are in the format of binary_tree_serialize.
+ *
+ * @file tree/binary_compact.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// sync submodule
+#include <sync/sync.h>
+
+// tree
+#include <tree/tree.h>
+#include <tree/binary.h>
+
+// Preprocessor definitions
+#define BINARY_COMPACT_TREE_NONE UINT32_MAX
+
+// Forward declarations
+struct binary_compact_tree_s;
+struct binary_compact_tree_node_s;
+
+// Type definitions
+/** !
+ *  @brief The type definition for a compact binary tree
+ */
+typedef struct binary_compact_tree_s binary_compact_tree;
+
+/** !
+ *  @brief The type definition for a compact binary tree node
+ */
+typedef struct binary_compact_tree_node_s binary_compact_tree_node;
+
+/** !
+ *  @brief The type definition for a function that serializes a value to a file
+ *
+ *  @param p_file  the file
+ *  @param p_value the value
+ *
+ *  @return 1 on success, 0 on error
+ */
+typedef int (fn_binary_compact_tree_serialize)(FILE *p_file, const void *p_value);
+
+/** !
+ *  @brief The type definition for a function that parses a value from a file
+ *
+ *  @param p_file   the file
+ *  @param pp_value return
+ *
+ *  @return 1 on success, 0 on error
+ */
+typedef int (fn_binary_compact_tree_parse)(FILE *p_file, void **pp_value);
+
+// Struct definitions
+struct binary_compact_tree_node_s
+{
+    void     *p_value;
+    uint32_t  left,
+              right;
+};
+
+struct binary_compact_tree_s
+{
+    mutex                     _lock;
+    binary_compact_tree_node *p_nodes;
+    uint32_t                  root;
+    size_t                    node_capacity;
+
+    struct
+    {
+        fn_tree_equal        *pfn_is_equal;
+        fn_tree_key_accessor *pfn_key_accessor;
+    } functions;
+
+    struct
+    {
+        unsigned long long node_quantity;
+        unsigned long long node_size;
+    } metadata;
+};
+
+// Constructors
+/** !
+ * Construct an empty compact binary tree
+ *
+ * @param pp_binary_compact_tree return
+ * @param pfn_is_equal           function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_key_accessor       function for accessing the key of a value IF parameter is not null ELSE default
+ * @param node_size              the size of a serialized node in bytes
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_construct ( binary_compact_tree **const pp_binary_compact_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, unsigned long long node_size );
+
+// Accessors
+/** !
+ * Search a compact binary tree for a key
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param p_key                 the key
+ * @param pp_value              return
+ *
+ * @return 1 on success, 0 on error or IF the key is not in the tree
+ */
+int binary_compact_tree_search ( binary_compact_tree *const p_binary_compact_tree, const void *const p_key, void **pp_value );
+
+// Mutators
+/** !
+ * Insert a value into a compact binary tree. The pool doubles when it is full
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param p_value               the value
+ *
+ * @return 1 on success, 0 on error or IF the key is already in the tree
+ */
+int binary_compact_tree_insert ( binary_compact_tree *const p_binary_compact_tree, const void *const p_value );
+
+/** !
+ * Remove a value from a compact binary tree. The last node of the pool is
+ * moved into the freed slot, so the pool stays dense
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param p_key                 the key
+ * @param pp_value              return IF not null
+ *
+ * @return 1 on success, 0 on error or IF the key is not in the tree
+ */
+int binary_compact_tree_remove ( binary_compact_tree *const p_binary_compact_tree, const void *const p_key, const void **const pp_value );
+
+// Traversal
+/** !
+ * Traverse a compact binary tree using the pre order technique
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param pfn_traverse          called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_traverse_preorder ( binary_compact_tree *const p_binary_compact_tree, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a compact binary tree using the in order technique
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param pfn_traverse          called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_traverse_inorder ( binary_compact_tree *const p_binary_compact_tree, fn_binary_tree_traverse *pfn_traverse );
+
+/** !
+ * Traverse a compact binary tree using the post order technique
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param pfn_traverse          called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_traverse_postorder ( binary_compact_tree *const p_binary_compact_tree, fn_binary_tree_traverse *pfn_traverse );
+
+// Parser
+/** !
+ * Construct a compact binary tree from a file. Records are read in order,
+ * straight into the pool
+ *
+ * @param pp_binary_compact_tree return
+ * @param p_path                 path to the file
+ * @param pfn_is_equal           function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_key_accessor       function for accessing the key of a value IF parameter is not null ELSE default
+ * @param pfn_parse_value        a function for parsing values from the file
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_parse ( binary_compact_tree **const pp_binary_compact_tree, const char *p_path, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, fn_binary_compact_tree_parse *pfn_parse_value );
+
+// Serializer
+/** !
+ * Write a compact binary tree to a file. The pool is written in order, and
+ * each node's children are its indices in the pool
+ *
+ * @param p_binary_compact_tree the compact binary tree
+ * @param p_path                path to the file
+ * @param pfn_serialize_value   a function for serializing values to the file
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_serialize ( binary_compact_tree *const p_binary_compact_tree, const char *p_path, fn_binary_compact_tree_serialize *pfn_serialize_value );
+
+// Destructors
+/** !
+ * Destroy and deallocate a compact binary tree
+ *
+ * @param pp_binary_compact_tree pointer to compact binary tree pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_compact_tree_destroy ( binary_compact_tree **const pp_binary_compact_tree );
@@ -0,0 +1,159 @@
+/** !
+ * Include header for lock free binary search tree
+ *
+ * An external binary search tree, after Natarajan and Mittal, "Fast Concurrent
+ * Lock-Free Binary Search Trees" (PPoPP 2014). Values live in leaves, and
+ * internal nodes only route. Inserts and removes change the tree with a single
+ * compare and swap on a child edge, and the two low bits of each edge mark a
+ * leaf that is being removed (flag), or an edge that must not change (tag).
+ *
+ * Removed nodes are reclaimed with epochs. A node is freed once every thread
+ * that was in the tree when it was removed has left the tree.
+ *
+ * @file tree/binary_lockfree.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// POSIX
+#include <pthread.h>
+
+// sync submodule
+#include <sync/sync.h>
+
+// tree
+#include <tree/tree.h>
+#include <tree/binary.h>
+
+// Preprocessor definitions
+#ifndef BINARY_LOCKFREE_TREE_RETIRE_THRESHOLD
+    #define BINARY_LOCKFREE_TREE_RETIRE_THRESHOLD 64
+#endif
+
+// Forward declarations
+struct binary_lockfree_tree_s;
+struct binary_lockfree_tree_node_s;
+
+// Type definitions
+/** !
+ *  @brief The type definition for a lock free binary tree
+ */
+typedef struct binary_lockfree_tree_s binary_lockfree_tree;
+
+/** !
+ *  @brief The type definition for a lock free binary tree node
+ */
+typedef struct binary_lockfree_tree_node_s binary_lockfree_tree_node;
+
+// Struct definitions
+struct binary_lockfree_tree_node_s
+{
+    uintptr_t                  left,
+                               right;
+    void                      *p_value;
+    const void                *p_key;
+    binary_lockfree_tree_node *p_next_retired;
+    unsigned long long         retired_epoch,
+                               infinity;
+    char                       _key[];
+};
+
+struct binary_lockfree_tree_s
+{
+    binary_lockfree_tree_node *p_root;
+
+    struct
+    {
+        fn_tree_equal        *pfn_is_equal;
+        fn_tree_key_accessor *pfn_key_accessor;
+    } functions;
+
+    size_t key_size;
+};
+
+// Constructors
+/** !
+ * Construct an empty lock free binary tree
+ *
+ * Routing nodes outlive the values they were split from, so they need their
+ * own copy of a key. IF key_size is not zero, key_size bytes of each key are
+ * copied into the tree ELSE the key accessor's pointers are kept, and must stay
+ * valid for the life of the tree.
+ *
+ * @param pp_binary_lockfree_tree return
+ * @param pfn_is_equal            function for testing equality of elements in set IF parameter is not null ELSE default
+ * @param pfn_key_accessor        function for accessing the key of a value IF parameter is not null ELSE default
+ * @param key_size                the size of a key in bytes IF keys are copied ELSE 0
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_construct ( binary_lockfree_tree **const pp_binary_lockfree_tree, fn_tree_equal *pfn_is_equal, fn_tree_key_accessor *pfn_key_accessor, size_t key_size );
+
+// Accessors
+/** !
+ * Search a lock free binary tree for a key. Never waits for other threads
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_key                  the key
+ * @param pp_value               return
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_search ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, void **pp_value );
+
+// Mutators
+/** !
+ * Insert a value into a lock free binary tree
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_value                the value
+ *
+ * @return 1 on success, 0 on error or IF the key is already in the tree
+ */
+int binary_lockfree_tree_insert ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_value );
+
+/** !
+ * Remove a value from a lock free binary tree
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param p_key                  the key
+ * @param pp_value               return IF not null
+ *
+ * @return 1 on success, 0 on error or IF the key is not in the tree
+ */
+int binary_lockfree_tree_remove ( binary_lockfree_tree *const p_binary_lockfree_tree, const void *const p_key, const void **const pp_value );
+
+// Traversal
+/** !
+ * Traverse a lock free binary tree in order. Concurrent inserts and removes
+ * may or may not be visited. pfn_traverse may search, insert into, and remove
+ * from any lock free binary tree; the nodes this traversal can reach stay
+ * allocated until it returns
+ *
+ * @param p_binary_lockfree_tree the lock free binary tree
+ * @param pfn_traverse           called for each value in the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_traverse_inorder ( binary_lockfree_tree *const p_binary_lockfree_tree, fn_binary_tree_traverse *pfn_traverse );
+
+// Destructors
+/** !
+ * Destroy and deallocate a lock free binary tree. No other thread may be using
+ * the tree. Removed nodes still waiting on their epoch are freed later
+ *
+ * @param pp_binary_lockfree_tree pointer to lock free binary tree pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+int binary_lockfree_tree_destroy ( binary_lockfree_tree **const pp_binary_lockfree_tree );
@@ -0,0 +1,411 @@
+/** !
+ * Type specialized binary search tree
+ *
+ * BINARY_TREE_DEFINE(name, key_type, cmp) stamps out a binary search tree
+ * named "name" whose nodes store a key_type key directly, and whose comparator
+ * is inlined. The generated functions have the same shape as the functions in
+ * tree/binary.h, without the key accessor and comparator indirection.
+ *
+ * The comparator is called as cmp(a, b) on two key_type values, and follows
+ * the fn_tree_equal convention; 0 if a == b else -1 if a > b else 1.
+ *
+ * Example:
+ *     BINARY_TREE_DEFINE(u64_tree, unsigned long long, BINARY_TREE_TYPED_COMPARE_SCALAR)
+ *
+ * @file tree/binary_typed.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// sync submodule
+#include <sync/sync.h>
+
+// tree
+#include <tree/tree.h>
+
+// Preprocessor definitions
+#ifndef BINARY_TREE_TYPED_SLAB_NODE_QUANTITY
+    #define BINARY_TREE_TYPED_SLAB_NODE_QUANTITY 4096
+#endif
+
+/** !
+ * Comparator for arithmetic keys
+ *
+ * @param a a
+ * @param b b
+ *
+ * @return 0 if a == b else -1 if a > b else 1
+ */
+#define BINARY_TREE_TYPED_COMPARE_SCALAR(a, b) ( ( (a) == (b) ) ? 0 : ( (a) < (b) ) ? 1 : -1 )
+
+/** !
+ * Comparator for null terminated string keys
+ *
+ * @param a a
+ * @param b b
+ *
+ * @return 0 if a == b else -1 if a > b else 1
+ */
+#define BINARY_TREE_TYPED_COMPARE_STRING(a, b) ( strcmp((b), (a)) )
+
+/** !
+ * Define a type specialized binary search tree
+ *
+ * @param name     the prefix of the generated types and functions
+ * @param key_type the type of a key
+ * @param cmp      a function or function like macro that compares two keys
+ */
+#define BINARY_TREE_DEFINE(name, key_type, cmp)                                                               \
+                                                                                                              \
+    /* Type definitions */                                                                                    \
+    typedef struct name##_node_s name##_node;                                                                 \
+    typedef struct name##_s      name;                                                                        \
+    typedef int (name##_fn_traverse)(key_type key, void *p_value);                                            \
+                                                                                                              \
+    /* Struct definitions */                                                                                  \
+    struct name##_node_s                                                                                      \
+    {                                                                                                         \
+        key_type     key;                                                                                     \
+        void        *p_value;                                                                                 \
+        name##_node *p_left,                                                                                  \
+                    *p_right;                                                                                 \
+    };                                                                                                        \
+                                                                                                              \
+    struct name##_s                                                                                           \
+    {                                                                                                         \
+        mutex        _lock;                                                                                   \
+        name##_node *p_root;                                                                                  \
+        size_t       node_quantity;                                                                           \
+        struct                                                                                                \
+        {                                                                                                     \
+            void        *p_slabs;                                                                             \
+            name##_node *p_free_list,                                                                         \
+                        *p_next,                                                                              \
+                        *p_end;                                                                               \
+        } allocator;                                                                                          \
+    };                                                                                                        \
+                                                                                                              \
+    /* Allocate a node from the slab allocator */                                                            \
+    static inline name##_node *name##_node_create ( name *p_tree )                                            \
+    {                                                                                                         \
+        name##_node *p_node = p_tree->allocator.p_free_list;                                                  \
+                                                                                                              \
+        /* Reuse a node from the free list */                                                                 \
+        if ( p_node ) p_tree->allocator.p_free_list = p_node->p_left;                                         \
+                                                                                                              \
+        /* Carve a node from the current slab */                                                              \
+        else                                                                                                  \
+        {                                                                                                     \
+            if ( p_tree->allocator.p_next == p_tree->allocator.p_end )                                        \
+            {                                                                                                 \
+                void *p_slab = TREE_REALLOC(0, sizeof(void *) + TREE_CACHE_LINE_SIZE +                        \
+                                               ( BINARY_TREE_TYPED_SLAB_NODE_QUANTITY * sizeof(name##_node) )); \
+                uintptr_t first = 0;                                                                          \
+                                                                                                              \
+                if ( p_slab == (void *) 0 ) return (void *) 0;                                                \
+                                                                                                              \
+                *(void **) p_slab = p_tree->allocator.p_slabs;                                                \
+                first = ( (uintptr_t) p_slab + sizeof(void *) + ( TREE_CACHE_LINE_SIZE - 1 ) ) &              \
+                        ~( (uintptr_t) TREE_CACHE_LINE_SIZE - 1 );                                            \
+                p_tree->allocator.p_slabs = p_slab;                                                           \
+                p_tree->allocator.p_next  = (name##_node *) first;                                            \
+                p_tree->allocator.p_end   = p_tree->allocator.p_next + BINARY_TREE_TYPED_SLAB_NODE_QUANTITY;  \
+            }                                                                                                 \
+                                                                                                              \
+            p_node = p_tree->allocator.p_next++;                                                              \
+        }                                                                                                     \
+                                                                                                              \
+        /* Zero set the node */                                                                               \
+        memset(p_node, 0, sizeof(name##_node));                                                               \
+                                                                                                              \
+        /* Increment the node quantity */                                                                     \
+        p_tree->node_quantity++;                                                                              \
+                                                                                                              \
+        /* Success */                                                                                         \
+        return p_node;                                                                                        \
+    }                                                                                                         \
+                                                                                                              \
+    /* Return a node to the free list */                                                                     \
+    static inline void name##_node_destroy ( name *p_tree, name##_node *p_node )                              \
+    {                                                                                                         \
+        p_node->p_left               = p_tree->allocator.p_free_list;                                         \
+        p_tree->allocator.p_free_list = p_node;                                                               \
+        p_tree->node_quantity--;                                                                              \
+    }                                                                                                         \
+                                                                                                              \
+    /* Construct an empty tree */                                                                             \
+    static inline int name##_construct ( name **const pp_tree )                                               \
+    {                                                                                                         \
+        name *p_tree = (void *) 0;                                                                            \
+                                                                                                              \
+        /* Argument check */                                                                                  \
+        if ( pp_tree == (void *) 0 ) return 0;                                                                \
+                                                                                                              \
+        /* Allocate the tree */                                                                               \
+        p_tree = TREE_REALLOC(0, sizeof(name));                                                               \
+                                                                                                              \
+        /* Error check */                                                                                     \
+        if ( p_tree == (void *) 0 ) return 0;                                                                 \
+                                                                                                              \
+        /* Zero set the tree */                                                                               \
+        memset(p_tree, 0, sizeof(name));                                                                      \
+                                                                                                              \
+        /* Construct a lock */                                                                                \
+        mutex_create(&p_tree->_lock);                                                                         \
+                                                                                                              \
+        /* Return a pointer to the caller */                                                                  \
+        *pp_tree = p_tree;                                                                                    \
+                                                                                                              \
+        /* Success */                                                                                         \
+        return 1;                                                                                             \
+    }                                                                                                         \
+                                                                                                              \
+    /* Search the tree for a key */                                                                           \
+    static inline int name##_search ( const name *const p_tree, const key_type key, void **pp_value )         \
+    {                                                                                                         \
+        name##_node *p_node = (void *) 0;                                                                     \
+        int          result = 0;                                                                              \
+                                                                                                              \
+        /* Argument check */                                                                                  \
+        if ( p_tree == (void *) 0 ) return 0;                                                                 \
+                                                                                                              \
+        /* Lock */                                                                                            \
+        mutex_lock(&p_tree->_lock);                                                                           \
+                                                                                                              \
+        /* Walk down the tree */                                                                              \
+        for ( p_node = p_tree->p_root; p_node; )                                                              \
+        {                                                                                                     \
+            int comparator_return = cmp(p_node->key, key);                                                    \
+                                                                                                              \
+            /* Found */                                                                                       \
+            if ( comparator_return == 0 )                                                                     \
+            {                                                                                                 \
+                if ( pp_value ) *pp_value = p_node->p_value;                                                  \
+                result = 1;                                                                                   \
+                break;                                                                                        \
+            }                                                                                                 \
+                                                                                                              \
+            /* Left or right */                                                                               \
+            p_node = ( comparator_return < 0 ) ? p_node->p_left : p_node->p_right;                            \
+        }                                                                                                     \
+                                                                                                              \
+        /* Unlock */                                                                                          \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+                                                                                                              \
+        /* Done */                                                                                            \
+        return result;                                                                                        \
+    }                                                                                                         \
+                                                                                                              \
+    /* Insert a key and a value into the tree */                                                              \
+    static inline int name##_insert ( name *const p_tree, const key_type key, const void *const p_value )     \
+    {                                                                                                         \
+        name##_node **pp_node = (void *) 0;                                                                   \
+                                                                                                              \
+        /* Argument check */                                                                                  \
+        if ( p_tree == (void *) 0 ) return 0;                                                                 \
+                                                                                                              \
+        /* Lock */                                                                                            \
+        mutex_lock(&p_tree->_lock);                                                                           \
+                                                                                                              \
+        /* Find the empty link */                                                                             \
+        for ( pp_node = &p_tree->p_root; *pp_node; )                                                          \
+        {                                                                                                     \
+            int comparator_return = cmp((*pp_node)->key, key);                                                \
+                                                                                                              \
+            /* Duplicate */                                                                                   \
+            if ( comparator_return == 0 ) goto done;                                                          \
+                                                                                                              \
+            /* Left or right */                                                                               \
+            pp_node = ( comparator_return < 0 ) ? &(*pp_node)->p_left : &(*pp_node)->p_right;                 \
+        }                                                                                                     \
+                                                                                                              \
+        /* Allocate a node */                                                                                 \
+        *pp_node = name##_node_create(p_tree);                                                                \
+                                                                                                              \
+        /* Error check */                                                                                     \
+        if ( *pp_node == (void *) 0 ) goto failed_to_allocate_node;                                           \
+                                                                                                              \
+        /* Store the key and the value */                                                                     \
+        (*pp_node)->key     = key;                                                                            \
+        (*pp_node)->p_value = (void *) p_value;                                                               \
+                                                                                                              \
+        done:                                                                                                 \
+                                                                                                              \
+        /* Unlock */                                                                                          \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+                                                                                                              \
+        /* Success */                                                                                         \
+        return 1;                                                                                             \
+                                                                                                              \
+        failed_to_allocate_node:                                                                              \
+                                                                                                              \
+        /* Unlock */                                                                                          \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+                                                                                                              \
+        /* Error */                                                                                           \
+        return 0;                                                                                             \
+    }                                                                                                         \
+                                                                                                              \
+    /* Remove a key from the tree */                                                                          \
+    static inline int name##_remove ( name *const p_tree, const key_type key, void **pp_value )               \
+    {                                                                                                         \
+        name##_node **pp_node = (void *) 0,                                                                   \
+                     *p_node  = (void *) 0;                                                                   \
+                                                                                                              \
+        /* Argument check */                                                                                  \
+        if ( p_tree == (void *) 0 ) return 0;                                                                 \
+                                                                                                              \
+        /* Lock */                                                                                            \
+        mutex_lock(&p_tree->_lock);                                                                           \
+                                                                                                              \
+        /* Find the link to the node */                                                                       \
+        for ( pp_node = &p_tree->p_root; *pp_node; )                                                          \
+        {                                                                                                     \
+            int comparator_return = cmp((*pp_node)->key, key);                                                \
+                                                                                                              \
+            /* Found */                                                                                       \
+            if ( comparator_return == 0 ) break;                                                              \
+                                                                                                              \
+            /* Left or right */                                                                               \
+            pp_node = ( comparator_return < 0 ) ? &(*pp_node)->p_left : &(*pp_node)->p_right;                 \
+        }                                                                                                     \
+                                                                                                              \
+        /* Not found */                                                                                       \
+        if ( *pp_node == (void *) 0 )                                                                         \
+        {                                                                                                     \
+            mutex_unlock(&p_tree->_lock);                                                                     \
+            return 0;                                                                                         \
+        }                                                                                                     \
+                                                                                                              \
+        /* Initialized data */                                                                                \
+        p_node = *pp_node;                                                                                    \
+                                                                                                              \
+        /* Return the value to the caller */                                                                  \
+        if ( pp_value ) *pp_value = p_node->p_value;                                                          \
+                                                                                                              \
+        /* Two children. Unlink the successor, and put it in place of the node */                             \
+        if ( p_node->p_left && p_node->p_right )                                                              \
+        {                                                                                                     \
+            name##_node **pp_successor = &p_node->p_right,                                                    \
+                         *p_successor  = (void *) 0;                                                          \
+                                                                                                              \
+            while ( (*pp_successor)->p_left ) pp_successor = &(*pp_successor)->p_left;                        \
+                                                                                                              \
+            p_successor           = *pp_successor;                                                            \
+            *pp_successor         = p_successor->p_right;                                                     \
+            p_successor->p_left   = p_node->p_left;                                                           \
+            p_successor->p_right  = p_node->p_right;                                                          \
+            *pp_node              = p_successor;                                                              \
+        }                                                                                                     \
+                                                                                                              \
+        /* Zero or one children */                                                                            \
+        else *pp_node = ( p_node->p_left ) ? p_node->p_left : p_node->p_right;                                \
+                                                                                                              \
+        /* Release the node */                                                                                \
+        name##_node_destroy(p_tree, p_node);                                                                  \
+                                                                                                              \
+        /* Unlock */                                                                                          \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+                                                                                                              \
+        /* Success */                                                                                         \
+        return 1;                                                                                             \
+    }                                                                                                         \
+                                                                                                              \
+    /* Traverse the tree using the pre order technique */                                                     \
+    static inline void name##_traverse_preorder_node ( name##_node *p_node, name##_fn_traverse *pfn_traverse ) \
+    {                                                                                                         \
+        if ( p_node == (void *) 0 ) return;                                                                   \
+        pfn_traverse(p_node->key, p_node->p_value);                                                           \
+        name##_traverse_preorder_node(p_node->p_left, pfn_traverse);                                          \
+        name##_traverse_preorder_node(p_node->p_right, pfn_traverse);                                         \
+    }                                                                                                         \
+                                                                                                              \
+    /* Traverse the tree using the in order technique */                                                      \
+    static inline void name##_traverse_inorder_node ( name##_node *p_node, name##_fn_traverse *pfn_traverse ) \
+    {                                                                                                         \
+        if ( p_node == (void *) 0 ) return;                                                                   \
+        name##_traverse_inorder_node(p_node->p_left, pfn_traverse);                                           \
+        pfn_traverse(p_node->key, p_node->p_value);                                                           \
+        name##_traverse_inorder_node(p_node->p_right, pfn_traverse);                                          \
+    }                                                                                                         \
+                                                                                                              \
+    /* Traverse the tree using the post order technique */                                                    \
+    static inline void name##_traverse_postorder_node ( name##_node *p_node, name##_fn_traverse *pfn_traverse ) \
+    {                                                                                                         \
+        if ( p_node == (void *) 0 ) return;                                                                   \
+        name##_traverse_postorder_node(p_node->p_left, pfn_traverse);                                         \
+        name##_traverse_postorder_node(p_node->p_right, pfn_traverse);                                        \
+        pfn_traverse(p_node->key, p_node->p_value);                                                           \
+    }                                                                                                         \
+                                                                                                              \
+    static inline int name##_traverse_preorder ( name *const p_tree, name##_fn_traverse *pfn_traverse )       \
+    {                                                                                                         \
+        if ( p_tree == (void *) 0 || pfn_traverse == (void *) 0 ) return 0;                                   \
+        mutex_lock(&p_tree->_lock);                                                                           \
+        name##_traverse_preorder_node(p_tree->p_root, pfn_traverse);                                          \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+        return 1;                                                                                             \
+    }                                                                                                         \
+                                                                                                              \
+    static inline int name##_traverse_inorder ( name *const p_tree, name##_fn_traverse *pfn_traverse )        \
+    {                                                                                                         \
+        if ( p_tree == (void *) 0 || pfn_traverse == (void *) 0 ) return 0;                                   \
+        mutex_lock(&p_tree->_lock);                                                                           \
+        name##_traverse_inorder_node(p_tree->p_root, pfn_traverse);                                           \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+        return 1;                                                                                             \
+    }                                                                                                         \
+                                                                                                              \
+    static inline int name##_traverse_postorder ( name *const p_tree, name##_fn_traverse *pfn_traverse )      \
+    {                                                                                                         \
+        if ( p_tree == (void *) 0 || pfn_traverse == (void *) 0 ) return 0;                                   \
+        mutex_lock(&p_tree->_lock);                                                                           \
+        name##_traverse_postorder_node(p_tree->p_root, pfn_traverse);                                         \
+        mutex_unlock(&p_tree->_lock);                                                                         \
+        return 1;                                                                                             \
+    }                                                                                                         \
+                                                                                                              \
+    /* Deallocate the tree */                                                                                 \
+    static inline int name##_destroy ( name **const pp_tree )                                                 \
+    {                                                                                                         \
+        name *p_tree = (void *) 0;                                                                            \
+                                                                                                              \
+        /* Argument check */                                                                                  \
+        if ( pp_tree == (void *) 0 ) return 0;                                                                \
+                                                                                                              \
+        /* Initialized data */                                                                                \
+        p_tree = *pp_tree;                                                                                    \
+                                                                                                              \
+        /* Fast exit */                                                                                       \
+        if ( p_tree == (void *) 0 ) return 1;                                                                 \
+                                                                                                              \
+        /* No more pointer for caller */                                                                      \
+        *pp_tree = (void *) 0;                                                                                \
+                                                                                                              \
+        /* Release every slab of nodes */                                                                     \
+        while ( p_tree->allocator.p_slabs )                                                                   \
+        {                                                                                                     \
+            void *p_slab = p_tree->allocator.p_slabs;                                                         \
+            p_tree->allocator.p_slabs = *(void **) p_slab;                                                    \
+            p_slab = TREE_REALLOC(p_slab, 0);                                                                 \
+        }                                                                                                     \
+                                                                                                              \
+        /* Destroy the lock */                                                                                \
+        mutex_destroy(&p_tree->_lock);                                                                        \
+                                                                                                              \
+        /* Release the tree */                                                                                \
+        p_tree = TREE_REALLOC(p_tree, 0);                                                                     \
+                                                                                                              \
+        /* Success */                                                                                         \
+        return 1;                                                                                             \
+    }
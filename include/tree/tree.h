@@ -30,6 +30,18 @@
     #define TREE_REALLOC(p, sz) realloc(p,sz)
 #endif
 
+// Cache line size in bytes
+#ifndef TREE_CACHE_LINE_SIZE
+    #define TREE_CACHE_LINE_SIZE 64
+#endif
+
+// Prefetch macro
+#if defined(__GNUC__) || defined(__clang__)
+    #define TREE_PREFETCH(p) __builtin_prefetch(p)
+#else
+    #define TREE_PREFETCH(p) ((void)(p))
+#endif
+
 // Type definitions
 
 /** !
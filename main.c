@@ -175,6 +175,16 @@ int binary_tree_example_parser ( FILE *p_file, binary_tree_node *p_binary_tree_n
  */
 int binary_tree_print_node ( void *p_value );
 
+/** !
+ * Print a b tree property to standard out
+ * 
+ * @param p_key   the key
+ * @param p_value the value
+ * 
+ * @return 1 on success, 0 on error
+ */
+int b_tree_print_property ( void *p_key, void *p_value );
+
 /** !
  * Convert text to two bit values. 
  * A -> 00, C -> 01, G-> 10, and T -> 11.
@@ -446,7 +456,7 @@ int tree_b_example ( int argc, const char *argv[] )
     remove("resources/output.b_tree");
 
     // Construct a B tree
-    if ( b_tree_construct(&p_b_tree, "resources/output.b_tree", 0, 2, 64) == 0 ) goto failed_to_create_b_tree;
+    if ( b_tree_construct(&p_b_tree, "resources/output.b_tree", 0, 2, 64, 0) == 0 ) goto failed_to_create_b_tree;
 
     b_tree_insert(p_b_tree, (void *) 1);
     b_tree_insert(p_b_tree, (void *) 2);
@@ -454,7 +464,7 @@ int tree_b_example ( int argc, const char *argv[] )
     b_tree_insert(p_b_tree, (void *) 4);
     b_tree_insert(p_b_tree, (void *) 5);
     b_tree_insert(p_b_tree, (void *) 6);
-    b_tree_traverse_inorder(p_b_tree, (void *)1);
+    b_tree_traverse_inorder(p_b_tree, b_tree_print_property);
 
     return 1;
 
@@ -853,6 +863,19 @@ int binary_tree_print_node ( void *p_value )
     return 1;
 }
 
+int b_tree_print_property ( void *p_key, void *p_value )
+{
+
+    // Unused
+    (void) p_value;
+
+    // Print the property
+    log_info("%zu\n", (size_t) p_key);
+
+    // Success
+    return 1;
+}
+
 size_t load_file ( const char *path, void *buffer, bool binary_mode )
 {
 
@@ -0,0 +1,1020 @@
+/** !
+ * Tree benchmark program
+ *
+ * Each benchmark prints a table to standard out. Run with no arguments to run
+ * every benchmark, or name the benchmarks to run.
+ *
+ *     read-scaling : binary_tree_search on 1 .. N threads, with and without
+ *                    BINARY_TREE_FLAG_READER_WRITER
+ *     batch        : binary_tree_search_batch against a loop of binary_tree_search
+ *     typed        : BINARY_TREE_DEFINE trees against binary_tree, for u64 and
+ *                    short string keys
+ *     lockfree     : binary_lockfree_tree against a reader writer binary_tree,
+ *                    on 1 .. 64 threads, at several read / write ratios
+ *     scapegoat    : sorted inserts, with and without BINARY_TREE_FLAG_SCAPEGOAT
+ *
+ * @file tree_bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// POSIX
+#include <pthread.h>
+#include <unistd.h>
+
+// log
+#include <log/log.h>
+
+// tree
+#include <tree/tree.h>
+#include <tree/binary.h>
+#include <tree/binary_typed.h>
+#include <tree/binary_lockfree.h>
+
+// Preprocessor defines
+#define TREE_BENCH_KEY_QUANTITY        ( 1 << 20 )
+#define TREE_BENCH_OPERATION_QUANTITY  ( 1 << 22 )
+#define TREE_BENCH_BATCH_SIZE          256
+#define TREE_BENCH_THREAD_QUANTITY     64
+#define TREE_BENCH_STRING_LENGTH       16
+#define TREE_BENCH_SORTED_QUANTITY     ( 1 << 14 )
+
+// Enumeration definitions
+enum tree_benches_e
+{
+    TREE_BENCH_READ_SCALING = 0,
+    TREE_BENCH_BATCH        = 1,
+    TREE_BENCH_TYPED        = 2,
+    TREE_BENCH_LOCKFREE     = 3,
+    TREE_BENCH_SCAPEGOAT    = 4,
+    TREE_BENCHES_QUANTITY   = 5
+};
+
+// Structure definitions
+struct tree_bench_thread_s
+{
+    binary_tree          *p_binary_tree;
+    binary_lockfree_tree *p_binary_lockfree_tree;
+    size_t                operation_quantity;
+    unsigned long long    key_quantity,
+                          seed;
+    int                   read_percent;
+    pthread_t             _thread;
+};
+
+// Type definitions
+typedef struct tree_bench_thread_s tree_bench_thread;
+
+// Type specialized binary trees
+BINARY_TREE_DEFINE(tree_bench_u64_tree, unsigned long long, BINARY_TREE_TYPED_COMPARE_SCALAR)
+BINARY_TREE_DEFINE(tree_bench_string_tree, const char *, BINARY_TREE_TYPED_COMPARE_STRING)
+
+// Forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Parse command line arguments
+ *
+ * @param argc          the argc parameter of the entry point
+ * @param argv          the argv parameter of the entry point
+ * @param benches_to_run return
+ *
+ * @return void on success, program abort on failure
+ */
+void parse_command_line_arguments ( int argc, const char *argv[], bool *benches_to_run );
+
+/** !
+ * Read thread scaling benchmark
+ *
+ * @return 1 on success, 0 on error
+ */
+int tree_bench_read_scaling ( void );
+
+/** !
+ * Batched search benchmark
+ *
+ * @return 1 on success, 0 on error
+ */
+int tree_bench_batch ( void );
+
+/** !
+ * Type specialized binary tree benchmark
+ *
+ * @return 1 on success, 0 on error
+ */
+int tree_bench_typed ( void );
+
+/** !
+ * Lock free binary tree benchmark
+ *
+ * @return 1 on success, 0 on error
+ */
+int tree_bench_lockfree ( void );
+
+/** !
+ * Scapegoat binary tree benchmark
+ *
+ * @return 1 on success, 0 on error
+ */
+int tree_bench_scapegoat ( void );
+
+/** !
+ * Run a quantity of threads against a binary tree OR a lock free binary tree,
+ * and time them
+ *
+ * @param p_binary_tree          the binary tree IF not null
+ * @param p_binary_lockfree_tree the lock free binary tree IF not null
+ * @param thread_quantity        the quantity of threads
+ * @param read_percent           the percent of operations that are searches
+ * @param p_seconds              return
+ *
+ * @return 1 on success, 0 on error
+ */
+int tree_bench_threads_run ( binary_tree *p_binary_tree, binary_lockfree_tree *p_binary_lockfree_tree, size_t thread_quantity, int read_percent, double *p_seconds );
+
+/** !
+ * The entry point of a benchmark thread. Searches IF a random draw is less than
+ * the read percent ELSE inserts or removes a random key
+ *
+ * @param p_parameter the tree_bench_thread
+ *
+ * @return null
+ */
+void *tree_bench_thread_run ( void *p_parameter );
+
+/** !
+ * Step a xorshift random number generator
+ *
+ * @param p_state the state of the generator
+ *
+ * @return the next random number
+ */
+unsigned long long tree_bench_random ( unsigned long long *p_state );
+
+/** !
+ * Get a monotonic timestamp
+ *
+ * @return the timestamp in seconds
+ */
+double tree_bench_time ( void );
+
+/** !
+ * Compare two null terminated strings
+ *
+ * @param p_a pointer to a
+ * @param p_b pointer to b
+ *
+ * @return 0 if a == b else -1 if a > b else 1
+ */
+int tree_bench_string_comparator ( const void *const p_a, const void *const p_b );
+
+// Entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // Initialized data
+    bool benches_to_run[TREE_BENCHES_QUANTITY] = { 0 };
+
+    // Parse command line arguments
+    parse_command_line_arguments(argc, argv, benches_to_run);
+
+    // Initialize tree
+    if ( tree_init() == 0 ) goto failed_to_initialize_tree;
+
+    // Formatting
+    log_info("╭────────────╮\n");
+    log_info("│ tree bench │\n");
+    log_info("╰────────────╯\n");
+
+    // Run the read thread scaling benchmark
+    if ( benches_to_run[TREE_BENCH_READ_SCALING] )
+
+        // Error check
+        if ( tree_bench_read_scaling() == 0 ) goto failed_to_run_bench;
+
+    // Run the batched search benchmark
+    if ( benches_to_run[TREE_BENCH_BATCH] )
+
+        // Error check
+        if ( tree_bench_batch() == 0 ) goto failed_to_run_bench;
+
+    // Run the type specialized binary tree benchmark
+    if ( benches_to_run[TREE_BENCH_TYPED] )
+
+        // Error check
+        if ( tree_bench_typed() == 0 ) goto failed_to_run_bench;
+
+    // Run the lock free binary tree benchmark
+    if ( benches_to_run[TREE_BENCH_LOCKFREE] )
+
+        // Error check
+        if ( tree_bench_lockfree() == 0 ) goto failed_to_run_bench;
+
+    // Run the scapegoat binary tree benchmark
+    if ( benches_to_run[TREE_BENCH_SCAPEGOAT] )
+
+        // Error check
+        if ( tree_bench_scapegoat() == 0 ) goto failed_to_run_bench;
+
+    // Success
+    return EXIT_SUCCESS;
+
+    // Error handling
+    {
+
+        failed_to_initialize_tree:
+
+            // Write an error message to standard out
+            printf("Failed to initialize tree!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_bench:
+
+            // Print an error message
+            printf("Failed to run benchmark!\n");
+
+            // Error
+            return EXIT_FAILURE;
+    }
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // Argument check
+    if ( argv0 == (void *) 0 ) exit(EXIT_FAILURE);
+
+    // Print a usage message to standard out
+    printf("Usage: %s [read-scaling] [batch] [typed] [lockfree] [scapegoat]\n", argv0);
+
+    // Done
+    return;
+}
+
+void parse_command_line_arguments ( int argc, const char *argv[], bool *benches_to_run )
+{
+
+    // Initialized data
+    const char *benches[TREE_BENCHES_QUANTITY] =
+    {
+        [TREE_BENCH_READ_SCALING] = "read-scaling",
+        [TREE_BENCH_BATCH]        = "batch",
+        [TREE_BENCH_TYPED]        = "typed",
+        [TREE_BENCH_LOCKFREE]     = "lockfree",
+        [TREE_BENCH_SCAPEGOAT]    = "scapegoat"
+    };
+
+    // If no command line arguments are supplied, run all the benchmarks
+    if ( argc == 1 ) goto all_benches;
+
+    // Iterate through each command line argument
+    for (int i = 1; i < argc; i++)
+    {
+
+        // Initialized data
+        size_t j = 0;
+
+        // Find the benchmark
+        while ( j < TREE_BENCHES_QUANTITY && strcmp(argv[i], benches[j]) ) j++;
+
+        // Error check
+        if ( j == TREE_BENCHES_QUANTITY ) goto invalid_arguments;
+
+        // Set the benchmark flag
+        benches_to_run[j] = true;
+    }
+
+    // Success
+    return;
+
+    // Set each benchmark flag
+    all_benches:
+    {
+
+        // For each benchmark ...
+        for (size_t i = 0; i < TREE_BENCHES_QUANTITY; i++)
+
+            // ... set the benchmark flag
+            benches_to_run[i] = true;
+
+        // Success
+        return;
+    }
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            invalid_arguments:
+
+                // Print a usage message to standard out
+                print_usage(argv[0]);
+
+                // Abort
+                exit(EXIT_FAILURE);
+        }
+    }
+}
+
+int tree_bench_read_scaling ( void )
+{
+
+    // Initialized data
+    binary_tree *p_mutex_tree         = (void *) 0,
+                *p_reader_writer_tree = (void *) 0;
+    long         processors           = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t       thread_quantity_max  = ( processors > 1 ) ? (size_t) processors : 1;
+    double       mutex_base           = 0,
+                 reader_writer_base   = 0;
+
+    // Formatting
+    log_info("╭──────────────────────╮\n");
+    log_info("│ read thread scaling  │\n");
+    log_info("╰──────────────────────╯\n");
+    printf("%d searches of %d keys, split across the threads. %ld processors online.\n\n", TREE_BENCH_OPERATION_QUANTITY, TREE_BENCH_KEY_QUANTITY, processors);
+
+    // Construct a binary tree with a mutex, and one with a reader writer lock
+    if ( binary_tree_construct_with_flags(&p_mutex_tree        , 0, 0, sizeof(void *), BINARY_TREE_FLAG_NONE         ) == 0 ) goto failed_to_construct_binary_tree;
+    if ( binary_tree_construct_with_flags(&p_reader_writer_tree, 0, 0, sizeof(void *), BINARY_TREE_FLAG_READER_WRITER) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Insert every other key of the key space in a random order
+    for (unsigned long long i = 0, state = 1; i < TREE_BENCH_KEY_QUANTITY; i++)
+    {
+
+        // Initialized data
+        void *p_value = (void *) (uintptr_t) ( ( ( tree_bench_random(&state) % ( 2 * TREE_BENCH_KEY_QUANTITY ) ) | 1 ) );
+
+        // Insert the key
+        binary_tree_insert(p_mutex_tree, p_value);
+        binary_tree_insert(p_reader_writer_tree, p_value);
+    }
+
+    // Formatting
+    printf("threads | mutex Mops/s | speedup | reader writer Mops/s | speedup\n");
+    printf("--------+--------------+---------+----------------------+--------\n");
+
+    // Double the threads, up to the processors online, and at least 2
+    for (size_t thread_quantity = 1; thread_quantity <= thread_quantity_max || thread_quantity <= 2; thread_quantity *= 2)
+    {
+
+        // Initialized data
+        double mutex_seconds         = 0,
+               reader_writer_seconds = 0,
+               mutex_rate            = 0,
+               reader_writer_rate    = 0;
+
+        // Run the threads
+        if ( tree_bench_threads_run(p_mutex_tree        , (void *) 0, thread_quantity, 100, &mutex_seconds        ) == 0 ) goto failed_to_run_threads;
+        if ( tree_bench_threads_run(p_reader_writer_tree, (void *) 0, thread_quantity, 100, &reader_writer_seconds) == 0 ) goto failed_to_run_threads;
+
+        // Compute the rates
+        mutex_rate         = TREE_BENCH_OPERATION_QUANTITY / mutex_seconds / 1e6;
+        reader_writer_rate = TREE_BENCH_OPERATION_QUANTITY / reader_writer_seconds / 1e6;
+
+        // Store the single thread rates
+        if ( thread_quantity == 1 ) mutex_base = mutex_rate, reader_writer_base = reader_writer_rate;
+
+        // Print the row
+        printf("%7zu | %12.2f | %6.2fx | %20.2f | %6.2fx\n", thread_quantity, mutex_rate, mutex_rate / mutex_base, reader_writer_rate, reader_writer_rate / reader_writer_base);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Clean up
+    binary_tree_destroy(&p_mutex_tree);
+    binary_tree_destroy(&p_reader_writer_tree);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_mutex_tree ) binary_tree_destroy(&p_mutex_tree);
+
+                // Error
+                return 0;
+
+            failed_to_run_threads:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to run benchmark threads in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                binary_tree_destroy(&p_mutex_tree);
+                binary_tree_destroy(&p_reader_writer_tree);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tree_bench_batch ( void )
+{
+
+    // Initialized data
+    binary_tree         *p_binary_tree = (void *) 0;
+    const void         **pp_keys       = TREE_REALLOC(0, TREE_BENCH_OPERATION_QUANTITY * sizeof(void *));
+    void               **pp_values     = TREE_REALLOC(0, TREE_BENCH_BATCH_SIZE * sizeof(void *));
+    unsigned long long   state         = 1,
+                         checksum      = 0;
+    double               start         = 0,
+                         single        = 0,
+                         batch         = 0;
+
+    // Error check
+    if ( pp_keys == (void *) 0 || pp_values == (void *) 0 ) goto no_mem;
+
+    // Formatting
+    log_info("╭──────────────────╮\n");
+    log_info("│ batched search   │\n");
+    log_info("╰──────────────────╯\n");
+    printf("%d searches of %d keys, in batches of %d keys.\n\n", TREE_BENCH_OPERATION_QUANTITY, TREE_BENCH_KEY_QUANTITY, TREE_BENCH_BATCH_SIZE);
+
+    // Construct a binary tree
+    if ( binary_tree_construct(&p_binary_tree, 0, 0, sizeof(void *)) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Insert the keys in a random order
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++)
+
+        // Insert a key
+        binary_tree_insert(p_binary_tree, (void *) (uintptr_t) ( ( tree_bench_random(&state) % ( 2 * TREE_BENCH_KEY_QUANTITY ) ) | 1 ));
+
+    // Draw the keys to search for. Half are in the binary tree
+    for (size_t i = 0; i < TREE_BENCH_OPERATION_QUANTITY; i++)
+
+        // Draw a key
+        pp_keys[i] = (void *) (uintptr_t) ( 1 + tree_bench_random(&state) % ( 2 * TREE_BENCH_KEY_QUANTITY ) );
+
+    // Search for each key, one call per key
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_OPERATION_QUANTITY; i++)
+    {
+
+        // Initialized data
+        void *p_value = (void *) 0;
+
+        // Search
+        if ( binary_tree_search(p_binary_tree, pp_keys[i], &p_value) ) checksum += (uintptr_t) p_value;
+    }
+    single = tree_bench_time() - start;
+
+    // Search for each key, one call per batch
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_OPERATION_QUANTITY; i += TREE_BENCH_BATCH_SIZE)
+    {
+
+        // Search
+        binary_tree_search_batch(p_binary_tree, &pp_keys[i], TREE_BENCH_BATCH_SIZE, pp_values);
+
+        // Consume the values
+        for (size_t j = 0; j < TREE_BENCH_BATCH_SIZE; j++) checksum -= (uintptr_t) pp_values[j];
+    }
+    batch = tree_bench_time() - start;
+
+    // Print the table
+    printf("method                   | ns / key | speedup\n");
+    printf("-------------------------+----------+--------\n");
+    printf("binary_tree_search       | %8.1f | %6.2fx\n", single * 1e9 / TREE_BENCH_OPERATION_QUANTITY, 1.0);
+    printf("binary_tree_search_batch | %8.1f | %6.2fx\n", batch * 1e9 / TREE_BENCH_OPERATION_QUANTITY, single / batch);
+    printf("\n%s\n\n", ( checksum == 0 ) ? "Both methods found the same values" : "The methods found different values!");
+
+    // Clean up
+    binary_tree_destroy(&p_binary_tree);
+    pp_keys   = TREE_REALLOC(pp_keys, 0);
+    pp_values = TREE_REALLOC(pp_values, 0);
+
+    // Success
+    return ( checksum == 0 );
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                pp_keys   = TREE_REALLOC(pp_keys, 0);
+                pp_values = TREE_REALLOC(pp_values, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( pp_keys   ) pp_keys   = TREE_REALLOC(pp_keys, 0);
+                if ( pp_values ) pp_values = TREE_REALLOC(pp_values, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tree_bench_typed ( void )
+{
+
+    // Initialized data
+    binary_tree            *p_u64_tree        = (void *) 0,
+                           *p_string_tree     = (void *) 0;
+    tree_bench_u64_tree    *p_u64_typed       = (void *) 0;
+    tree_bench_string_tree *p_string_typed    = (void *) 0;
+    unsigned long long     *p_keys            = TREE_REALLOC(0, TREE_BENCH_KEY_QUANTITY * sizeof(unsigned long long));
+    char                   *p_strings         = TREE_REALLOC(0, TREE_BENCH_KEY_QUANTITY * TREE_BENCH_STRING_LENGTH);
+    unsigned long long      state             = 1;
+    double                  start             = 0,
+                            generic_insert    = 0,
+                            generic_search    = 0,
+                            typed_insert      = 0,
+                            typed_search      = 0;
+    size_t                  found             = 0;
+
+    // Error check
+    if ( p_keys == (void *) 0 || p_strings == (void *) 0 ) goto no_mem;
+
+    // Formatting
+    log_info("╭────────────────────────────╮\n");
+    log_info("│ type specialized trees     │\n");
+    log_info("╰────────────────────────────╯\n");
+    printf("%d keys, inserted in a random order, then searched in a random order.\n\n", TREE_BENCH_KEY_QUANTITY);
+
+    // Draw the keys, and make a short string from each key
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++)
+    {
+
+        // Draw a key
+        p_keys[i] = 1 + tree_bench_random(&state) % ( 4ULL * TREE_BENCH_KEY_QUANTITY );
+
+        // Make a string
+        snprintf(&p_strings[i * TREE_BENCH_STRING_LENGTH], TREE_BENCH_STRING_LENGTH, "key%llu", p_keys[i]);
+    }
+
+    // Construct the binary trees
+    if ( binary_tree_construct(&p_u64_tree, 0, 0, sizeof(void *)) == 0 ) goto failed_to_construct_binary_tree;
+    if ( binary_tree_construct(&p_string_tree, tree_bench_string_comparator, 0, TREE_BENCH_STRING_LENGTH) == 0 ) goto failed_to_construct_binary_tree;
+    if ( tree_bench_u64_tree_construct(&p_u64_typed) == 0 ) goto failed_to_construct_binary_tree;
+    if ( tree_bench_string_tree_construct(&p_string_typed) == 0 ) goto failed_to_construct_binary_tree;
+
+    // Formatting
+    printf("keys   | tree                | insert ns / key | search ns / key\n");
+    printf("-------+---------------------+-----------------+----------------\n");
+
+    // Time the generic binary tree with u64 keys
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) binary_tree_insert(p_u64_tree, (void *) (uintptr_t) p_keys[i]);
+    generic_insert = tree_bench_time() - start;
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) { void *p_value = (void *) 0; found += (size_t) binary_tree_search(p_u64_tree, (void *) (uintptr_t) p_keys[TREE_BENCH_KEY_QUANTITY - 1 - i], &p_value); }
+    generic_search = tree_bench_time() - start;
+
+    // Time the type specialized binary tree with u64 keys
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) tree_bench_u64_tree_insert(p_u64_typed, p_keys[i], (void *) (uintptr_t) p_keys[i]);
+    typed_insert = tree_bench_time() - start;
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) { void *p_value = (void *) 0; found -= (size_t) tree_bench_u64_tree_search(p_u64_typed, p_keys[TREE_BENCH_KEY_QUANTITY - 1 - i], &p_value); }
+    typed_search = tree_bench_time() - start;
+
+    // Print the rows
+    printf("u64    | binary_tree         | %15.1f | %15.1f\n", generic_insert * 1e9 / TREE_BENCH_KEY_QUANTITY, generic_search * 1e9 / TREE_BENCH_KEY_QUANTITY);
+    printf("u64    | BINARY_TREE_DEFINE  | %15.1f | %15.1f\n", typed_insert * 1e9 / TREE_BENCH_KEY_QUANTITY, typed_search * 1e9 / TREE_BENCH_KEY_QUANTITY);
+
+    // Time the generic binary tree with string keys
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) binary_tree_insert(p_string_tree, &p_strings[i * TREE_BENCH_STRING_LENGTH]);
+    generic_insert = tree_bench_time() - start;
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) { void *p_value = (void *) 0; found += (size_t) binary_tree_search(p_string_tree, &p_strings[( TREE_BENCH_KEY_QUANTITY - 1 - i ) * TREE_BENCH_STRING_LENGTH], &p_value); }
+    generic_search = tree_bench_time() - start;
+
+    // Time the type specialized binary tree with string keys
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) tree_bench_string_tree_insert(p_string_typed, &p_strings[i * TREE_BENCH_STRING_LENGTH], &p_strings[i * TREE_BENCH_STRING_LENGTH]);
+    typed_insert = tree_bench_time() - start;
+    start = tree_bench_time();
+    for (size_t i = 0; i < TREE_BENCH_KEY_QUANTITY; i++) { void *p_value = (void *) 0; found -= (size_t) tree_bench_string_tree_search(p_string_typed, &p_strings[( TREE_BENCH_KEY_QUANTITY - 1 - i ) * TREE_BENCH_STRING_LENGTH], &p_value); }
+    typed_search = tree_bench_time() - start;
+
+    // Print the rows
+    printf("string | binary_tree         | %15.1f | %15.1f\n", generic_insert * 1e9 / TREE_BENCH_KEY_QUANTITY, generic_search * 1e9 / TREE_BENCH_KEY_QUANTITY);
+    printf("string | BINARY_TREE_DEFINE  | %15.1f | %15.1f\n", typed_insert * 1e9 / TREE_BENCH_KEY_QUANTITY, typed_search * 1e9 / TREE_BENCH_KEY_QUANTITY);
+    printf("\n%s\n\n", ( found == 0 ) ? "Both trees found the same keys" : "The trees found different keys!");
+
+    // Clean up
+    binary_tree_destroy(&p_u64_tree);
+    binary_tree_destroy(&p_string_tree);
+    tree_bench_u64_tree_destroy(&p_u64_typed);
+    tree_bench_string_tree_destroy(&p_string_typed);
+    p_keys    = TREE_REALLOC(p_keys, 0);
+    p_strings = TREE_REALLOC(p_strings, 0);
+
+    // Success
+    return ( found == 0 );
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_u64_tree     ) binary_tree_destroy(&p_u64_tree);
+                if ( p_string_tree  ) binary_tree_destroy(&p_string_tree);
+                if ( p_u64_typed    ) tree_bench_u64_tree_destroy(&p_u64_typed);
+                if ( p_string_typed ) tree_bench_string_tree_destroy(&p_string_typed);
+                p_keys    = TREE_REALLOC(p_keys, 0);
+                p_strings = TREE_REALLOC(p_strings, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Call to function \"realloc\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_keys    ) p_keys    = TREE_REALLOC(p_keys, 0);
+                if ( p_strings ) p_strings = TREE_REALLOC(p_strings, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tree_bench_lockfree ( void )
+{
+
+    // Initialized data
+    binary_tree          *p_binary_tree          = (void *) 0;
+    binary_lockfree_tree *p_binary_lockfree_tree = (void *) 0;
+    int                   read_percents[]        = { 100, 90, 50, 0 };
+
+    // Formatting
+    log_info("╭──────────────────────────╮\n");
+    log_info("│ lock free binary tree    │\n");
+    log_info("╰──────────────────────────╯\n");
+    printf("%d operations on %d keys, split across the threads. Writes insert or remove a random key.\n\n", TREE_BENCH_OPERATION_QUANTITY, TREE_BENCH_KEY_QUANTITY);
+
+    // Formatting
+    printf("reads | threads | reader writer Mops/s | lock free Mops/s\n");
+    printf("------+---------+----------------------+-----------------\n");
+
+    // For each read percent
+    for (size_t r = 0; r < sizeof(read_percents) / sizeof(*read_percents); r++)
+    {
+
+        // Construct a reader writer binary tree, and a lock free binary tree
+        if ( binary_tree_construct_with_flags(&p_binary_tree, 0, 0, sizeof(void *), BINARY_TREE_FLAG_READER_WRITER) == 0 ) goto failed_to_construct_binary_tree;
+        if ( binary_lockfree_tree_construct(&p_binary_lockfree_tree, 0, 0, 0) == 0 ) goto failed_to_construct_binary_tree;
+
+        // Insert every other key of the key space in a random order. Writes
+        // insert and remove equally, so the trees stay about this size
+        for (unsigned long long i = 0, state = 1; i < TREE_BENCH_KEY_QUANTITY; i++)
+        {
+
+            // Initialized data
+            void *p_value = (void *) (uintptr_t) ( ( tree_bench_random(&state) % ( 2 * TREE_BENCH_KEY_QUANTITY ) ) | 1 );
+
+            // Insert the key
+            binary_tree_insert(p_binary_tree, p_value);
+            binary_lockfree_tree_insert(p_binary_lockfree_tree, p_value);
+        }
+
+        // Double the threads, up to the maximum
+        for (size_t thread_quantity = 1; thread_quantity <= TREE_BENCH_THREAD_QUANTITY; thread_quantity *= 2)
+        {
+
+            // Initialized data
+            double locked_seconds   = 0,
+                   lockfree_seconds = 0;
+
+            // Run the threads
+            if ( tree_bench_threads_run(p_binary_tree, (void *) 0, thread_quantity, read_percents[r], &locked_seconds) == 0 ) goto failed_to_run_threads;
+            if ( tree_bench_threads_run((void *) 0, p_binary_lockfree_tree, thread_quantity, read_percents[r], &lockfree_seconds) == 0 ) goto failed_to_run_threads;
+
+            // Print the row
+            printf("%4d%% | %7zu | %20.2f | %16.2f\n", read_percents[r], thread_quantity, TREE_BENCH_OPERATION_QUANTITY / locked_seconds / 1e6, TREE_BENCH_OPERATION_QUANTITY / lockfree_seconds / 1e6);
+        }
+
+        // Clean up
+        binary_tree_destroy(&p_binary_tree);
+        binary_lockfree_tree_destroy(&p_binary_lockfree_tree);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_binary_tree ) binary_tree_destroy(&p_binary_tree);
+
+                // Error
+                return 0;
+
+            failed_to_run_threads:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to run benchmark threads in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                binary_tree_destroy(&p_binary_tree);
+                binary_lockfree_tree_destroy(&p_binary_lockfree_tree);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tree_bench_scapegoat ( void )
+{
+
+    // Initialized data
+    struct
+    {
+        const char *p_name;
+        int         flags;
+        size_t      key_quantity;
+    } runs[] =
+    {
+        { "plain"    , BINARY_TREE_FLAG_NONE     , TREE_BENCH_SORTED_QUANTITY },
+        { "scapegoat", BINARY_TREE_FLAG_SCAPEGOAT, TREE_BENCH_SORTED_QUANTITY },
+        { "scapegoat", BINARY_TREE_FLAG_SCAPEGOAT, TREE_BENCH_KEY_QUANTITY    }
+    };
+
+    // Formatting
+    log_info("╭────────────────────────╮\n");
+    log_info("│ scapegoat binary tree  │\n");
+    log_info("╰────────────────────────╯\n");
+    printf("Keys inserted in ascending order, then searched in ascending order.\n\n");
+
+    // Formatting
+    printf("mode      | keys    | height  | insert ns / key | search ns / key\n");
+    printf("----------+---------+---------+-----------------+----------------\n");
+
+    // For each run
+    for (size_t r = 0; r < sizeof(runs) / sizeof(*runs); r++)
+    {
+
+        // Initialized data
+        binary_tree              *p_binary_tree = (void *) 0;
+        binary_tree_stats_report  _report       = { 0 };
+        double                    start         = 0,
+                                  insert        = 0,
+                                  search        = 0;
+
+        // Construct a binary tree
+        if ( binary_tree_construct_with_flags(&p_binary_tree, 0, 0, sizeof(void *), runs[r].flags) == 0 ) goto failed_to_construct_binary_tree;
+
+        // Insert the keys in ascending order
+        start = tree_bench_time();
+        for (size_t i = 1; i <= runs[r].key_quantity; i++) binary_tree_insert(p_binary_tree, (void *) (uintptr_t) i);
+        insert = tree_bench_time() - start;
+
+        // Search for the keys in ascending order
+        start = tree_bench_time();
+        for (size_t i = 1; i <= runs[r].key_quantity; i++) { void *p_value = (void *) 0; binary_tree_search(p_binary_tree, (void *) (uintptr_t) i, &p_value); }
+        search = tree_bench_time() - start;
+
+        // Measure the height
+        binary_tree_stats(p_binary_tree, &_report);
+
+        // Print the row
+        printf("%-9s | %7zu | %7zu | %15.1f | %15.1f\n", runs[r].p_name, runs[r].key_quantity, _report.height, insert * 1e9 / (double) runs[r].key_quantity, search * 1e9 / (double) runs[r].key_quantity);
+
+        // Clean up
+        binary_tree_destroy(&p_binary_tree);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Tree errors
+        {
+            failed_to_construct_binary_tree:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Failed to construct binary tree in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tree_bench_threads_run ( binary_tree *p_binary_tree, binary_lockfree_tree *p_binary_lockfree_tree, size_t thread_quantity, int read_percent, double *p_seconds )
+{
+
+    // Initialized data
+    tree_bench_thread  _threads[TREE_BENCH_THREAD_QUANTITY] = { 0 };
+    size_t             started                              = 0;
+    double             start                                = 0;
+
+    // Argument check
+    if ( thread_quantity > TREE_BENCH_THREAD_QUANTITY ) goto too_many_threads;
+
+    // Start the clock
+    start = tree_bench_time();
+
+    // Start each thread
+    for (; started < thread_quantity; started++)
+    {
+
+        // Populate the thread
+        _threads[started] = (tree_bench_thread)
+        {
+            .p_binary_tree          = p_binary_tree,
+            .p_binary_lockfree_tree = p_binary_lockfree_tree,
+            .operation_quantity     = TREE_BENCH_OPERATION_QUANTITY / thread_quantity,
+            .key_quantity           = TREE_BENCH_KEY_QUANTITY,
+            .seed                   = 0x9e3779b97f4a7c15ULL * ( started + 1 ),
+            .read_percent           = read_percent
+        };
+
+        // Start the thread
+        if ( pthread_create(&_threads[started]._thread, (void *) 0, tree_bench_thread_run, &_threads[started]) != 0 ) goto failed_to_create_thread;
+    }
+
+    // Wait for each thread
+    for (size_t i = 0; i < thread_quantity; i++) pthread_join(_threads[i]._thread, (void *) 0);
+
+    // Stop the clock
+    *p_seconds = tree_bench_time() - start;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            too_many_threads:
+                #ifndef NDEBUG
+                    log_error("[tree] [bench] Parameter \"thread_quantity\" must not exceed %d in call to function \"%s\"\n", TREE_BENCH_THREAD_QUANTITY, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // POSIX errors
+        {
+            failed_to_create_thread:
+                #ifndef NDEBUG
+                    log_error("[POSIX] Call to function \"pthread_create\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Wait for the threads that started
+                for (size_t i = 0; i < started; i++) pthread_join(_threads[i]._thread, (void *) 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void *tree_bench_thread_run ( void *p_parameter )
+{
+
+    // Initialized data
+    tree_bench_thread  *p_thread = p_parameter;
+    unsigned long long  state    = p_thread->seed;
+
+    // Run each operation
+    for (size_t i = 0; i < p_thread->operation_quantity; i++)
+    {
+
+        // Initialized data
+        unsigned long long  draw    = tree_bench_random(&state);
+        void               *p_key   = (void *) (uintptr_t) ( 1 + ( draw >> 8 ) % ( 2 * p_thread->key_quantity ) ),
+                           *p_value = (void *) 0;
+
+        // Search
+        if ( (int) ( draw % 100 ) < p_thread->read_percent )
+        {
+            if ( p_thread->p_binary_tree ) binary_tree_search(p_thread->p_binary_tree, p_key, &p_value);
+            else                           binary_lockfree_tree_search(p_thread->p_binary_lockfree_tree, p_key, &p_value);
+        }
+
+        // Insert
+        else if ( draw & 128 )
+        {
+            if ( p_thread->p_binary_tree ) binary_tree_insert(p_thread->p_binary_tree, p_key);
+            else                           binary_lockfree_tree_insert(p_thread->p_binary_lockfree_tree, p_key);
+        }
+
+        // Remove
+        else
+        {
+            if ( p_thread->p_binary_tree ) binary_tree_remove(p_thread->p_binary_tree, p_key, (void *) 0);
+            else                           binary_lockfree_tree_remove(p_thread->p_binary_lockfree_tree, p_key, (void *) 0);
+        }
+    }
+
+    // Done
+    return (void *) 0;
+}
+
+unsigned long long tree_bench_random ( unsigned long long *p_state )
+{
+
+    // Initialized data
+    unsigned long long x = *p_state;
+
+    // Step the generator
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    // Store the state
+    *p_state = x;
+
+    // Success
+    return x;
+}
+
+double tree_bench_time ( void )
+{
+
+    // Initialized data
+    struct timespec _time = { 0 };
+
+    // Read the monotonic clock
+    clock_gettime(CLOCK_MONOTONIC, &_time);
+
+    // Success
+    return (double) _time.tv_sec + (double) _time.tv_nsec * 1e-9;
+}
+
+int tree_bench_string_comparator ( const void *const p_a, const void *const p_b )
+{
+
+    // Success
+    return strcmp(p_b, p_a);
+}